@@ -8,12 +8,17 @@
 namespace srilakshmikanthanp::clipbirdesk {
 
 /**
- * @brief Get the certificate from App Home
+ * @brief Get the certificate from App Home or null
+ * configuration if it is not usable
  */
 QSslConfiguration Application::getOldSslConfiguration() {
-  auto two_months      = std::chrono::milliseconds(constants::getAppCertExpiryInterval());
   auto& storage        = storage::Storage::instance();
 
+  // if there is no certificate or key
+  if (!storage.hasHostCert() || !storage.hasHostKey()) {
+    return QSslConfiguration();
+  }
+
   // read the certificate and key
   QSslCertificate cert = storage.getHostCert();
   QSslKey key          = storage.getHostKey();
@@ -24,23 +29,18 @@ QSslConfiguration Application::getOldSslConfiguration() {
 
   // Name is updated
   if (name != QString::fromStdString(constants::getMDnsServiceName())) {
-    return getNewSslConfiguration();
+    return QSslConfiguration();
+  }
+
+  // if the certificate is already expired
+  if (cert.expiryDate() <= QDateTime::currentDateTime()) {
+    return QSslConfiguration();
   }
 
   // set the certificate and key
   sslConfig.setLocalCertificate(cert);
   sslConfig.setPrivateKey(key);
 
-  // if the configuration is null
-  if (cert.isNull() || key.isNull() || sslConfig.isNull()) {
-    throw std::runtime_error("Can't Create QSslConfiguration");
-  }
-
-  // if the certificate is going to expiry
-  if (cert.expiryDate() - QDateTime::currentDateTime() < two_months) {
-    return getNewSslConfiguration();
-  }
-
   // set peer verify
   sslConfig.setPeerVerifyMode(QSslSocket::VerifyPeer);
 
@@ -49,37 +49,114 @@ QSslConfiguration Application::getOldSslConfiguration() {
 }
 
 /**
- * @brief Get the certificate by creating new one
+ * @brief Is the certificate going to expiry
  */
-QSslConfiguration Application::getNewSslConfiguration() {
+bool Application::isCertificateExpiring(const QSslCertificate &cert) {
+  auto two_months = std::chrono::milliseconds(constants::getAppCertExpiryInterval());
+  return cert.expiryDate() - QDateTime::currentDateTime() < two_months;
+}
+
+/**
+ * @brief Generate the new certificate on a worker thread
+ */
+void Application::renewSslConfiguration() {
+  // if already generating
+  if (identityWatcher->isRunning()) {
+    return;
+  }
+
+  // selected key algorithm
+  auto type = types::enums::KeyType(storage::Storage::instance().getHostKeyType());
+
   // generate the certificate and key
-  auto sslConfig = utility::functions::getQSslConfiguration();
+  identityWatcher->setFuture(QtConcurrent::run([type] {
+    return utility::functions::getQSslConfiguration(type);
+  }));
+}
+
+/**
+ * @brief Renew the certificate if it is going to expiry or generate
+ * it if the earlier attempt failed, identities of an older key type
+ * are replaced here by the selected one, so paired devices
+ * re-authenticate only on the usual renewal
+ */
+void Application::checkSslConfiguration() {
+  auto& storage = storage::Storage::instance();
+
+  // if there is no usable certificate yet
+  if (!isIdentityReady) {
+    return this->renewSslConfiguration();
+  }
+
+  // if the certificate is going to expiry
+  if (storage.hasHostCert() && isCertificateExpiring(storage.getHostCert())) {
+    this->renewSslConfiguration();
+  }
+}
+
+/**
+ * @brief Store and use the generated certificate
+ */
+void Application::handleSslConfigurationReady() {
+  QSslConfiguration sslConfig;
+
+  // get the generated configuration
+  try {
+    sslConfig = identityWatcher->result();
+  } catch (const std::exception &e) {
+    qWarning() << LOG(std::string("Can't generate the certificate: ") + e.what());
+    return this->handleSslConfigurationFailed(QString::fromStdString(e.what()));
+  }
 
   // write the certificate and key
-  auto& storage  = storage::Storage::instance();
+  auto& storage = storage::Storage::instance();
   storage.setHostCert(sslConfig.localCertificate());
   storage.setHostKey(sslConfig.privateKey());
 
-  // return the configuration
-  return sslConfig;
+  // use the new certificate for new connections
+  controller->setSslConfiguration(sslConfig);
+
+  // if networking is already started
+  if (isIdentityReady) {
+    return;
+  }
+
+  // start the networking
+  isIdentityReady = true;
+
+  // start the host selected meanwhile
+  if (pendingTab.has_value()) {
+    this->handleTabChange(*std::exchange(pendingTab, std::nullopt));
+  }
 }
 
 /**
- * @brief Get the certificate from App Home
- * or generate new one and store it
+ * @brief Retry the failed certificate generation and tell the
+ * user if networking waits for it
  */
-QSslConfiguration Application::getSslConfiguration() {
-  auto& storage = storage::Storage::instance();
-  QSslConfiguration config;
+void Application::handleSslConfigurationFailed(QString error) {
+  // try again after a while
+  QTimer::singleShot(
+    constants::getAppCertRetryInterval(),
+    this, &Application::checkSslConfiguration
+  );
 
-  if (!storage.hasHostCert() || !storage.hasHostKey()) {
-    config = getNewSslConfiguration();
-  } else {
-    config = getOldSslConfiguration();
+  // the current certificate is still usable
+  if (isIdentityReady) {
+    return;
   }
 
-  // return the configuration
-  return config;
+  // Just Show the error info to user via Dialog
+  auto message = QObject::tr("Unable to create the device identity, retrying: %1").arg(error);
+
+  // Title of the Notification
+  auto title = constants::getAppName();
+
+  // icon for the dialog
+  auto icon = QIcon(QString::fromStdString(constants::getAppLogo()));
+
+  // show notification
+  trayIcon->showMessage(title, message, icon);
 }
 
 /**
@@ -103,6 +180,14 @@ void Application::handleConnectionError(QString error) {
  * @brief On Tab Changed for Client
  */
 void Application::handleTabChange(ui::gui::widgets::Clipbird::Tabs tab) {
+  // start the host once the certificate is ready
+  if (!isIdentityReady) {
+    this->trayMenu->setQrCodeEnabled(false);
+    this->trayMenu->setConnectEnabled(false);
+    this->pendingTab = tab;
+    return;
+  }
+
   if (tab == ui::gui::widgets::Clipbird::Tabs::Client) {
     this->trayMenu->setQrCodeEnabled(false);
     this->trayMenu->setConnectEnabled(true);
@@ -329,9 +414,6 @@ void Application::openHistory() {
   // set the title
   history->setWindowTitle(constants::getAppName());
 
-  // set history
-  history->setHistory(controller->getHistory());
-
   // set size
   history->setFixedSize(constants::getAppWindowSize());
 
@@ -384,8 +466,11 @@ void Application::setQssFile(Qt::ColorScheme scheme) {
  * @brief Construct a new Application object
  */
 Application::Application(int &argc, char **argv) : SingleApplication(argc, argv) {
+  // use the stored certificate if usable
+  auto sslConfig = this->getOldSslConfiguration();
+
   // create the objects of the class
-  controller = new controller::ClipBird(this->getSslConfiguration());
+  controller = new controller::ClipBird(sslConfig);
   hotkey     = new QHotkey(QKeySequence(constants::getAppHistoryShortcut()), true, this);
   clipbird   = new ui::gui::widgets::Clipbird();
   history    = new ui::gui::widgets::History();
@@ -523,17 +608,61 @@ Application::Application(int &argc, char **argv) : SingleApplication(argc, argv)
     controller, &controller::ClipBird::deleteHistoryAt
   );
 
-  // connect signal for history change
+  // set the loaded history, changes arrive as they happen
+  history->setHistory(controller->getHistoryCount(), [this](int row, bool pageIn, QVector<QPair<QString, quint64>> *hashes) {
+    return pageIn ? controller->getHistoryAt(row) : controller->peekHistoryAt(row, hashes);
+  });
+
+  // show the memory use of the history
+  history->setMemoryBudget(controller->getHistoryMemoryBudget());
+  history->setResidentBytes(controller->getHistoryResidentBytes());
+
+  connect(
+    controller, &controller::ClipBird::OnHistoryResidentBytesChanged,
+    history, &ui::gui::widgets::History::setResidentBytes
+  );
+
+  // log the memory use of the history
+  connect(
+    controller, &controller::ClipBird::OnHistoryResidentBytesChanged,
+    [](quint64 bytes) { qDebug() << META_DATA << "History resident bytes:" << bytes; }
+  );
+
+  // store and apply the budget set by the user
   connect(
-    controller, &controller::ClipBird::OnHistoryChanged,
-    history, &ui::gui::widgets::History::setHistory
+    history, &ui::gui::widgets::History::onMemoryBudgetChanged,
+    controller, &controller::ClipBird::setHistoryMemoryBudget
+  );
+
+  // connect signals for history change
+  connect(
+    controller, &controller::ClipBird::OnHistoryItemInserted,
+    history, &ui::gui::widgets::History::insertClip
+  );
+
+  connect(
+    controller, &controller::ClipBird::OnHistoryItemRemoved,
+    history, &ui::gui::widgets::History::removeClip
+  );
+
+  connect(
+    controller, &controller::ClipBird::OnHistoryItemChanged,
+    history, &ui::gui::widgets::History::updateClip
+  );
+
+  // connect signal for history search
+  connect(
+    history, &ui::gui::widgets::History::onSearchChanged,
+    [=](const QString &query) {
+      history->setFilter(controller->searchHistory(query));
+    }
   );
 
   // connect signal for Clipboard Copy
   connect(
     history, &ui::gui::widgets::History::onClipSelected,
     [=](auto i) {
-      controller->setClipboard(controller->getHistory().at(i));
+      controller->setClipboardFromHistory(i);
     }
   );
 
@@ -603,6 +732,31 @@ Application::Application(int &argc, char **argv) : SingleApplication(argc, argv)
     QHostInfo::lookupHost(ipv4, this, slot);
   });
 
+  // use the generated certificate
+  QObject::connect(
+    identityWatcher, &QFutureWatcher<QSslConfiguration>::finished,
+    this, &Application::handleSslConfigurationReady
+  );
+
+  // renew the certificate before it expires
+  QObject::connect(
+    renewTimer, &QTimer::timeout,
+    this, &Application::checkSslConfiguration
+  );
+
+  // networking starts now or when the certificate is generated
+  isIdentityReady = !sslConfig.isNull();
+
+  // generate in the background if not usable or going to expiry
+  if (!isIdentityReady) {
+    this->renewSslConfiguration();
+  } else {
+    this->checkSslConfiguration();
+  }
+
+  // check the certificate periodically
+  renewTimer->start(constants::getAppCertRenewInterval());
+
   // if host is lastly server
   if (controller->isLastlyHostIsServer()) {
     clipbird->setTabAsServer();
@@ -9,6 +9,7 @@
 #include <QAbstractNativeEventFilter>
 #include <QApplication>
 #include <QFile>
+#include <QFutureWatcher>
 #include <QGraphicsDropShadowEffect>
 #include <QGuiApplication>
 #include <QHostInfo>
@@ -17,11 +18,15 @@
 #include <QNetworkProxy>
 #include <QStyleHints>
 #include <QSystemTrayIcon>
+#include <QTimer>
+#include <QtConcurrent>
 #include <SingleApplication>
 #include <QHotkey>
 
 // C++ Headers
 #include <csignal>
+#include <optional>
+#include <utility>
 
 // Project Headers
 #include "constants/constants.hpp"
@@ -42,20 +47,37 @@ class Application : public SingleApplication {
   private:  // Member Functions
 
   /**
-   * @brief Get the certificate from App Home
+   * @brief Get the certificate from App Home or null
+   * configuration if it is not usable
    */
   QSslConfiguration getOldSslConfiguration();
 
   /**
-   * @brief Get the certificate by creating new one
+   * @brief Is the certificate going to expiry
    */
-  QSslConfiguration getNewSslConfiguration();
+  bool isCertificateExpiring(const QSslCertificate &cert);
 
   /**
-   * @brief Get the certificate from App Home
-   * or generate new one and store it
+   * @brief Generate the new certificate on a worker thread
    */
-  QSslConfiguration getSslConfiguration();
+  void renewSslConfiguration();
+
+  /**
+   * @brief Renew the certificate if it is going to expiry or
+   * generate it if the earlier attempt failed
+   */
+  void checkSslConfiguration();
+
+  /**
+   * @brief Store and use the generated certificate
+   */
+  void handleSslConfigurationReady();
+
+  /**
+   * @brief Retry the failed certificate generation and tell the
+   * user if networking waits for it
+   */
+  void handleSslConfigurationFailed(QString error);
 
   /**
    * @brief handle onConnectionError
@@ -137,6 +159,13 @@ class Application : public SingleApplication {
 
   QHotkey *hotkey;
 
+ private:  // Host identity
+
+  QFutureWatcher<QSslConfiguration> *identityWatcher = new QFutureWatcher<QSslConfiguration>(this);
+  QTimer *renewTimer = new QTimer(this);
+  std::optional<ui::gui::widgets::Clipbird::Tabs> pendingTab;
+  bool isIdentityReady = false;
+
  private:  // Disable Copy, Move and Assignment
 
   Q_DISABLE_COPY_MOVE(Application);
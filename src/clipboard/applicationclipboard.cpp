@@ -6,9 +6,181 @@ namespace srilakshmikanthanp::clipbirdesk::clipboard {
  */
 void ApplicationClipboard::onClipboardChangeImpl(QClipboard::Mode mode) {
   if (mode != QClipboard::Mode::Clipboard) return;
-  if (!QApplication::clipboard()->ownsClipboard()) {
-    Q_UNUSED(QtConcurrent::run([this]() { emit OnClipboardChange(this->get()); }));
+  if (m_clipboard->ownsClipboard()) return;
+
+  // get the mime data on this thread, the worker holds it so a
+  // newer selection does not free it while it is being read
+  const auto mimeData = m_clipboard->sharedMimeData(QClipboard::Mode::Clipboard);
+
+  // if mime data is not supported or it is the promise we set
+  if (mimeData == nullptr || qobject_cast<const LazyMimeData*>(mimeData.get())) return;
+
+  Q_UNUSED(QtConcurrent::run([this, mimeData]() {
+    // read the items and image
+    QImage image;
+    auto items = this->read(mimeData.get(), image);
+
+    // same as the last applied or sent snapshot
+    const auto fingerprint = this->fingerprint(items, image);
+    if (this->exchangeFingerprint(fingerprint)) return;
+
+    // encode the image only for the new content
+    if (!image.isNull()) this->insertImage(items, image);
+
+    // notify the listeners
+    emit OnClipboardChange(items);
+  }));
+}
+
+/**
+ * @brief Read the items of the mime data, the image is
+ * returned as is so it can be fingerprinted before encoding
+ *
+ * @param mimeData mime data to read
+ * @param image image of the mime data if any
+ * @return items except image
+ */
+QVector<QPair<QString, QByteArray>> ApplicationClipboard::read(const QMimeData* mimeData, QImage& image) const {
+  // Default clipboard data & mime data
+  QVector<QPair<QString, QByteArray>> items;
+
+  // has Urls the files copied in file manager
+  if (mimeData->hasUrls()) {
+    items.append({MIME_TYPE_URLS, mimeData->data(MIME_TYPE_URLS)});
+  }
+
+  // has HTML
+  if (mimeData->hasHtml()) {
+    items.append({MIME_TYPE_HTML, mimeData->html().toUtf8()});
+  }
+
+  // has Image
+  if (mimeData->hasImage()) {
+    image = qvariant_cast<QImage>(mimeData->imageData());
+  }
+
+  // has Text
+  if (mimeData->hasText()) {
+    items.append({MIME_TYPE_TEXT, mimeData->text().toUtf8()});
+  }
+
+  // return the data
+  return items;
+}
+
+/**
+ * @brief Encode the image and add it before the text
+ *
+ * @param items items to add the image
+ * @param image image to add
+ */
+void ApplicationClipboard::insertImage(QVector<QPair<QString, QByteArray>>& items, const QImage& image) const {
+  // position of the text
+  const auto text = std::find_if(items.begin(), items.end(), [this](const auto& item) {
+    return item.first == MIME_TYPE_TEXT;
+  });
+
+  // insert the image
+  items.insert(text, this->encodeImage(image));
+}
+
+/**
+ * @brief Compute the fingerprint of the snapshot, the image
+ * is hashed by its pixels so the fingerprint does not depend
+ * on the codec the image is encoded with
+ *
+ * @param items items except image
+ * @param image image of the snapshot
+ * @param promised hashes of the promised items except image
+ * @return quint64 fingerprint
+ */
+quint64 ApplicationClipboard::fingerprint(
+  const QVector<QPair<QString, QByteArray>>& items,
+  const QImage& image,
+  const QVector<QPair<QString, quint64>>& promised
+) const {
+  // using xxh3 to hash the payloads
+  using utility::functions::xxh3;
+
+  // hashes of the items
+  QVector<QPair<QString, quint64>> hashes(promised);
+
+  // hash the payloads
+  for (const auto& [mime, data] : items) {
+    hashes.append({mime, xxh3(data)});
+  }
+
+  // hash the pixels in the common format
+  if (!image.isNull()) {
+    const auto rgba   = image.convertToFormat(QImage::Format_RGBA8888);
+    const auto pixels = QByteArray::fromRawData(reinterpret_cast<const char*>(rgba.constBits()), rgba.sizeInBytes());
+    hashes.append({MIME_TYPE_IMAGE, xxh3(pixels) ^ (quint64(rgba.width()) << 32 | quint64(rgba.height()))});
+  }
+
+  // return the fingerprint
+  return utility::functions::fingerprint(hashes);
+}
+
+/**
+ * @brief Check the fingerprint with the last snapshot and make
+ * it the last snapshot
+ *
+ * @param fingerprint fingerprint of the current snapshot
+ * @return true if same as the last snapshot
+ */
+bool ApplicationClipboard::exchangeFingerprint(quint64 fingerprint) {
+  // lock the snapshot
+  QMutexLocker locker(&m_lock);
+
+  // the applied image is read back so fingerprint it now on this worker
+  if (!m_appliedImage.second.isEmpty()) {
+    const auto image = this->decodeImage(m_appliedImage.first, m_appliedImage.second);
+    m_fingerprint    = this->fingerprint(m_appliedItems, image, m_appliedHashes);
   }
+
+  // forget the applied snapshot
+  m_appliedItems.clear();
+  m_appliedHashes.clear();
+  m_appliedImage = {};
+  ++m_appliedSerial;
+
+  // compare and set
+  const auto same = m_fingerprint == fingerprint;
+  m_fingerprint   = fingerprint;
+
+  // return the result
+  return same;
+}
+
+/**
+ * @brief Decode the image payload
+ *
+ * @param mime mime type of the image
+ * @param data encoded image
+ * @return QImage
+ */
+QImage ApplicationClipboard::decodeImage(const QString& mime, const QByteArray& data) const {
+  if (mime == MIME_TYPE_QOI) {
+    return utility::functions::decodeQoi(data);
+  } else {
+    return QImage::fromData(data, IMAGE_TYPE_PNG);
+  }
+}
+
+/**
+ * @brief Encode the image with the current codec
+ *
+ * @param image image to encode
+ * @return mime type and data
+ */
+QPair<QString, QByteArray> ApplicationClipboard::encodeImage(const QImage& image) const {
+  // QOI is lossless and encodes an order of magnitude faster
+  if (m_imageCodec == types::enums::ImageCodec::QOI) {
+    return {MIME_TYPE_QOI, utility::functions::encodeQoi(image)};
+  }
+
+  // PNG with fast zlib level
+  return {MIME_TYPE_PNG, utility::functions::encodePng(image)};
 }
 
 /**
@@ -32,33 +204,18 @@ ApplicationClipboard::ApplicationClipboard(QObject* parent) : QObject(parent) {
  * @return mime type and data
  */
 QVector<QPair<QString, QByteArray>> ApplicationClipboard::get() const {
-  // Default clipboard data & mime data
-  QVector<QPair<QString, QByteArray>> items;
-
   // get the mime data
   const auto mimeData = m_clipboard->mimeData(QClipboard::Mode::Clipboard);
 
   // if mime data is not supported
-  if (mimeData == nullptr) return items;
-
-  // has HTML
-  if (mimeData->hasHtml()) {
-    items.append({MIME_TYPE_HTML, mimeData->html().toUtf8()});
-  }
+  if (mimeData == nullptr) return {};
 
-  // has Image
-  if (mimeData->hasImage()) {
-    auto image = qvariant_cast<QImage>(mimeData->imageData());
-    QByteArray data; QBuffer buffer(&data);
-    buffer.open(QIODevice::WriteOnly);
-    image.save(&buffer, IMAGE_TYPE_PNG);
-    items.append({MIME_TYPE_PNG, data});
-  }
+  // read the items and image
+  QImage image;
+  auto items = this->read(mimeData, image);
 
-  // has Text
-  if (mimeData->hasText()) {
-    items.append({MIME_TYPE_TEXT, mimeData->text().toUtf8()});
-  }
+  // encode the image
+  if (!image.isNull()) this->insertImage(items, image);
 
   // return the data
   return items;
@@ -78,28 +235,122 @@ void ApplicationClipboard::clear() {
  * @param data data to be set
  */
 void ApplicationClipboard::set(const QVector<QPair<QString, QByteArray>> data) {
-  // create the mime data object
-  QMimeData *mimeData = new QMimeData();
+  // items that are put on the clipboard
+  QVector<QPair<QString, QByteArray>> items;
+  QPair<QString, QByteArray> image;
 
   // set the data
   for (const auto& [mime, data] : data) {
-    // has Image png
-    if (mime == MIME_TYPE_PNG) {
-      mimeData->setImageData(QImage::fromData(data, IMAGE_TYPE_PNG));
+    // has Image kept encoded until pasted
+    if (mime == MIME_TYPE_PNG || mime == MIME_TYPE_QOI) {
+      image = {mime, data};
+    }
+
+    // has Urls, HTML or Text
+    if (mime == MIME_TYPE_URLS || mime == MIME_TYPE_HTML || mime == MIME_TYPE_TEXT) {
+      items.append({mime, data});
     }
+  }
+
+  // the change notified for this content is not sent back
+  {
+    QMutexLocker locker(&m_lock);
+    m_appliedItems  = items;
+    m_appliedHashes.clear();
+    m_appliedImage  = image;
+    m_fingerprint   = image.second.isEmpty() ? this->fingerprint(items, QImage()) : 0;
+    ++m_appliedSerial;
+  }
+
+  // the image is decoded by the mime data on request
+  if (!image.second.isEmpty()) items.append(image);
+
+  // set the mime data
+  m_clipboard->setMimeData(new LazyMimeData(items, {}, nullptr), QClipboard::Mode::Clipboard);
+}
+
+/**
+ * @brief Set the clipboard data where some of the items are
+ * only promised, the promised items are fetched with the
+ * fetcher when an application pastes them
+ *
+ * @param items known items
+ * @param promised promised mime types with payload hash
+ * @param fetcher function to fetch the promised payload
+ */
+void ApplicationClipboard::setLazy(
+  const QVector<QPair<QString, QByteArray>> items,
+  const QVector<QPair<QString, quint64>> promised,
+  LazyMimeData::Fetcher fetcher
+) {
+  // items except image, promised hashes except image
+  QVector<QPair<QString, QByteArray>> known;
+  QVector<QPair<QString, quint64>> hashes;
+  QPair<QString, QByteArray> image;
+  QStringList mimes;
 
-    // has HTML
-    if (mime == MIME_TYPE_HTML) {
-      mimeData->setHtml(QString::fromUtf8(data));
+  // known image is kept encoded until read back
+  for (const auto& [mime, data] : items) {
+    if (mime == MIME_TYPE_PNG || mime == MIME_TYPE_QOI) {
+      image = {mime, data};
+    } else {
+      known.append({mime, data});
     }
+  }
 
-    // has Text
-    if (mime == MIME_TYPE_TEXT) {
-      mimeData->setText(QString::fromUtf8(data));
+  // promised image is recorded once it is fetched
+  bool imagePromised = false;
+  for (const auto& [mime, hash] : promised) {
+    if (mime == MIME_TYPE_PNG || mime == MIME_TYPE_QOI) {
+      imagePromised = true;
+    } else {
+      hashes.append({mime, hash});
     }
+    mimes.append(mime);
+  }
+
+  // the change notified for this content is not sent back, the
+  // image is fingerprinted by its pixels like the read back one
+  quint64 serial;
+  {
+    QMutexLocker locker(&m_lock);
+    m_appliedItems  = known;
+    m_appliedHashes = hashes;
+    m_appliedImage  = image;
+    m_fingerprint   = image.second.isEmpty() && !imagePromised ? this->fingerprint(known, QImage(), hashes) : 0;
+    serial          = ++m_appliedSerial;
   }
 
+  // record the fetched image of this snapshot
+  const auto record = [this, serial, fetcher](const QString& mime, LazyMimeData::Callback done) {
+    fetcher(mime, [=](const QByteArray& data) {
+      if ((mime == MIME_TYPE_PNG || mime == MIME_TYPE_QOI) && !data.isEmpty()) {
+        QMutexLocker locker(&m_lock);
+        if (m_appliedSerial == serial) m_appliedImage = {mime, data};
+      }
+      done(data);
+    });
+  };
+
   // set the mime data
-  m_clipboard->setMimeData(mimeData, QClipboard::Mode::Clipboard);
+  m_clipboard->setMimeData(new LazyMimeData(items, mimes, record), QClipboard::Mode::Clipboard);
+}
+
+/**
+ * @brief Set the codec used to encode the images
+ *
+ * @param codec image codec
+ */
+void ApplicationClipboard::setImageCodec(types::enums::ImageCodec codec) {
+  this->m_imageCodec = codec;
+}
+
+/**
+ * @brief Get the codec used to encode the images
+ *
+ * @return types::enums::ImageCodec
+ */
+types::enums::ImageCodec ApplicationClipboard::getImageCodec() const {
+  return this->m_imageCodec;
 }
 }  // namespace srilakshmikanthanp::clipbirdesk::clipboard
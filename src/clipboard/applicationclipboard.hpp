@@ -10,6 +10,8 @@
 #include <QImageReader>
 #include <QList>
 #include <QMimeData>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QObject>
 #include <QPair>
 #include <QString>
@@ -17,9 +19,16 @@
 #include <QVector>
 #include <QtConcurrent>
 
+// C++ header
+#include <algorithm>
+
 // project header
+#include "clipboard/lazymimedata.hpp"
 #include "clipboard/platformclipboard.hpp"
+#include "types/enums/enums.hpp"
 #include "types/except/except.hpp"
+#include "utility/functions/hash/hash.hpp"
+#include "utility/functions/qoi/qoi.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::clipboard {
 
@@ -40,6 +49,29 @@ class ApplicationClipboard : public QObject {
 
   PlatformClipboard *m_clipboard = PlatformClipboard::instance();
 
+  /// @brief codec used to encode the images
+  types::enums::ImageCodec m_imageCodec = types::enums::ImageCodec::PNG;
+
+  /// @brief guards the fingerprint of the last snapshot
+  QMutex m_lock;
+
+  /// @brief fingerprint of the last applied or sent snapshot
+  quint64 m_fingerprint = 0;
+
+  /// @brief items of the last applied snapshot except the image
+  QVector<QPair<QString, QByteArray>> m_appliedItems;
+
+  /// @brief encoded image of the last applied snapshot it is
+  /// decoded to fingerprint only if the snapshot is read back
+  QPair<QString, QByteArray> m_appliedImage;
+
+  /// @brief hashes of the promised items of the last applied
+  /// snapshot except the image
+  QVector<QPair<QString, quint64>> m_appliedHashes;
+
+  /// @brief serial of the last applied snapshot
+  quint64 m_appliedSerial = 0;
+
  private:  // just for Qt
 
   /// @brief Qt meta object
@@ -54,16 +86,83 @@ class ApplicationClipboard : public QObject {
   /// @brief Slot to notify the clipboard change
   void onClipboardChangeImpl(QClipboard::Mode mode);
 
+ private:  // private functions
+
+  /**
+   * @brief Read the items of the mime data, the image is
+   * returned as is so it can be fingerprinted before encoding
+   *
+   * @param mimeData mime data to read
+   * @param image image of the mime data if any
+   * @return items except image
+   */
+  QVector<QPair<QString, QByteArray>> read(const QMimeData* mimeData, QImage& image) const;
+
+  /**
+   * @brief Encode the image and add it before the text
+   *
+   * @param items items to add the image
+   * @param image image to add
+   */
+  void insertImage(QVector<QPair<QString, QByteArray>>& items, const QImage& image) const;
+
+  /**
+   * @brief Compute the fingerprint of the snapshot, the image
+   * is hashed by its pixels so the fingerprint does not depend
+   * on the codec the image is encoded with
+   *
+   * @param items items except image
+   * @param image image of the snapshot
+   * @param promised hashes of the promised items except image
+   * @return quint64 fingerprint
+   */
+  quint64 fingerprint(
+    const QVector<QPair<QString, QByteArray>>& items,
+    const QImage& image,
+    const QVector<QPair<QString, quint64>>& promised = {}
+  ) const;
+
+  /**
+   * @brief Check the fingerprint with the last snapshot and make
+   * it the last snapshot
+   *
+   * @param fingerprint fingerprint of the current snapshot
+   * @return true if same as the last snapshot
+   */
+  bool exchangeFingerprint(quint64 fingerprint);
+
+  /**
+   * @brief Decode the image payload
+   *
+   * @param mime mime type of the image
+   * @param data encoded image
+   * @return QImage
+   */
+  QImage decodeImage(const QString& mime, const QByteArray& data) const;
+
  private:  // mime types
 
   const QString MIME_TYPE_TEXT  = "text/plain";
   const QString MIME_TYPE_PNG   = "image/png";
+  const QString MIME_TYPE_QOI   = "image/qoi";
   const QString MIME_TYPE_HTML  = "text/html";
+  const QString MIME_TYPE_URLS  = "text/uri-list";
+  const QString MIME_TYPE_IMAGE = "application/x-qt-image";
 
  private: // image type
 
   const char* IMAGE_TYPE_PNG = "PNG";
 
+ private:  // private functions
+
+  /**
+   * @brief Encode the image with the current codec
+   *
+   * @param image image to encode
+   * @return mime type and data
+   */
+  QPair<QString, QByteArray> encodeImage(const QImage &image) const;
+
  public:  // constructor
 
   /**
@@ -88,11 +187,43 @@ class ApplicationClipboard : public QObject {
   void clear();
 
   /**
-   * @brief Set the clipboard data to the clipboard
+   * @brief Set the clipboard data to the clipboard, the images
+   * are kept encoded and decoded only when a consumer asks
    *
    * @param mime mime type of the data
    * @param data data to be set
    */
   void set(const QVector<QPair<QString, QByteArray>> data);
+
+  /**
+   * @brief Set the clipboard data where some of the items are
+   * only promised, the promised items are fetched with the
+   * fetcher when an application pastes them
+   *
+   * @param items known items
+   * @param promised promised mime types with payload hash
+   * @param fetcher function to fetch the promised payload
+   */
+  void setLazy(
+    const QVector<QPair<QString, QByteArray>> items,
+    const QVector<QPair<QString, quint64>> promised,
+    LazyMimeData::Fetcher fetcher
+  );
+
+  /**
+   * @brief Set the codec used to encode the images, Every
+   * receiver decodes both PNG and QOI but only the peers
+   * with QOI support can read QOI so PNG is the default
+   *
+   * @param codec image codec
+   */
+  void setImageCodec(types::enums::ImageCodec codec);
+
+  /**
+   * @brief Get the codec used to encode the images
+   *
+   * @return types::enums::ImageCodec
+   */
+  types::enums::ImageCodec getImageCodec() const;
 };
 }  // namespace srilakshmikanthanp::clipbirdesk::clipboard
@@ -0,0 +1,416 @@
+#include "datacontrol.hpp"
+
+#ifdef WITH_WAYLAND
+
+namespace srilakshmikanthanp::clipbirdesk::clipboard {
+//--------------------------- DataControlDeviceManager --------------------------//
+
+/**
+ * @brief Construct a new Data Control Device Manager object
+ */
+DataControlDeviceManager::DataControlDeviceManager()
+    : QWaylandClientExtensionTemplate<DataControlDeviceManager>(2) {
+  // Nothing to do
+}
+
+/**
+ * @brief Destroy the Data Control Device Manager object
+ */
+DataControlDeviceManager::~DataControlDeviceManager() {
+  if (isActive()) destroy();
+}
+
+//------------------------------ DataControlOffer -------------------------------//
+
+/**
+ * @brief Read the pipe until the writer closes it, the bytes are
+ * read directly into the result without intermediate buffers
+ *
+ * @param fd read end of the pipe in non blocking mode
+ * @param data read data
+ * @return true if read until end
+ */
+bool DataControlOffer::readData(int fd, QByteArray& data) {
+  // poll the pipe
+  pollfd pfd = {fd, POLLIN, 0};
+
+  // bytes read so far
+  qsizetype used = 0;
+
+  // read until end of file
+  while (true) {
+    // wait for the writer
+    const auto ready = poll(&pfd, 1, 1000);
+
+    // interrupted
+    if (ready < 0 && errno == EINTR) continue;
+
+    // error or the writer is stuck
+    if (ready <= 0) return false;
+
+    // grow the buffer the new bytes are not initialized
+    if (used == data.size()) {
+      data.resize(qMax<qsizetype>(64 * 1024, data.size() * 2));
+    }
+
+    // read directly into the buffer
+    const auto n = read(fd, data.data() + used, data.size() - used);
+
+    // end of file
+    if (n == 0) break;
+
+    // not yet available or interrupted
+    if (n < 0 && (errno == EAGAIN || errno == EINTR)) continue;
+
+    // error
+    if (n < 0) return false;
+
+    // update the used
+    used += n;
+  }
+
+  // shrink to the read size
+  data.resize(used);
+
+  // done
+  return true;
+}
+
+/**
+ * @brief Mime type offered
+ */
+void DataControlOffer::zwlr_data_control_offer_v1_offer(const QString& mime) {
+  m_formats.append(mime);
+}
+
+/**
+ * @brief Receive the data of the mime type from the source
+ */
+QVariant DataControlOffer::retrieveData(const QString& mime, QMetaType type) const {
+  // if not offered
+  if (!hasFormat(mime)) return QVariant();
+
+  // mime type to receive
+  auto receiveMime = mime;
+
+  // the image is received as png or any offered image type
+  if (mime == MIME_TYPE_IMAGE) {
+    const auto images = m_formats.filter(QRegularExpression("^image/"));
+    receiveMime = images.contains(MIME_TYPE_PNG) ? MIME_TYPE_PNG : images.constFirst();
+  }
+
+  // the text may be offered only with charset
+  if (mime == MIME_TYPE_TEXT && !m_formats.contains(MIME_TYPE_TEXT)) {
+    receiveMime = MIME_TYPE_UTF8;
+  }
+
+  // pipe to receive the data
+  int fds[2];
+
+  // create the pipe
+  if (pipe2(fds, O_CLOEXEC | O_NONBLOCK) != 0) {
+    return QVariant();
+  }
+
+  // request the source to write the data
+  const_cast<DataControlOffer*>(this)->receive(receiveMime, fds[1]);
+
+  // the source has its own copy of the fd
+  close(fds[1]);
+
+  // send the request now as the event loop may be blocked
+  if (auto app = qGuiApp->nativeInterface<QNativeInterface::QWaylandApplication>()) {
+    wl_display_flush(app->display());
+  }
+
+  // read the data
+  QByteArray data;
+  const auto ok = readData(fds[0], data);
+
+  // close the pipe
+  close(fds[0]);
+
+  // if failed
+  if (!ok) return QVariant();
+
+  // decode the image
+  if (mime == MIME_TYPE_IMAGE) {
+    return QImage::fromData(data);
+  }
+
+  // QMimeData converts the bytes to the requested type
+  return data;
+}
+
+/**
+ * @brief Construct a new Data Control Offer object
+ *
+ * @param id offer
+ */
+DataControlOffer::DataControlOffer(struct ::zwlr_data_control_offer_v1* id)
+    : QtWayland::zwlr_data_control_offer_v1(id) {
+  // Nothing to do
+}
+
+/**
+ * @brief Destroy the Data Control Offer object
+ */
+DataControlOffer::~DataControlOffer() {
+  destroy();
+}
+
+/**
+ * @brief Get the offered formats, the image is exposed as
+ * application/x-qt-image if any image is offered
+ */
+QStringList DataControlOffer::formats() const {
+  // formats
+  auto formats = m_formats;
+
+  // expose the image
+  if (!m_formats.filter(QRegularExpression("^image/")).isEmpty()) {
+    formats.append(MIME_TYPE_IMAGE);
+  }
+
+  // expose the text
+  if (m_formats.contains(MIME_TYPE_UTF8) && !m_formats.contains(MIME_TYPE_TEXT)) {
+    formats.append(MIME_TYPE_TEXT);
+  }
+
+  // return the formats
+  return formats;
+}
+
+/**
+ * @brief Has the format
+ */
+bool DataControlOffer::hasFormat(const QString& mime) const {
+  return formats().contains(mime);
+}
+
+//------------------------------ DataControlSource ------------------------------//
+
+/**
+ * @brief Produce the data and write it to the fd in background,
+ * the fd is closed once the last holder releases it
+ *
+ * @param fd write end of the pipe
+ * @param data function that produces the data
+ */
+void DataControlSource::writeData(std::shared_ptr<int> fd, std::function<QByteArray()> data) {
+  // write in background the reader may be slow or this process
+  Q_UNUSED(QtConcurrent::run([fd, data]() {
+    // encode on the background thread
+    const auto bytes = data();
+
+    // blocking writes on the background thread
+    fcntl(*fd, F_SETFL, fcntl(*fd, F_GETFL) & ~O_NONBLOCK);
+
+    // bytes written so far
+    qsizetype wrote = 0;
+
+    // write until all the data is written or reader is closed
+    while (wrote < bytes.size()) {
+      const auto n = write(*fd, bytes.constData() + wrote, bytes.size() - wrote);
+      if (n < 0 && errno == EINTR) continue;
+      if (n <= 0) break;
+      wrote += n;
+    }
+  }));
+}
+
+/**
+ * @brief Send the data of the mime type to the fd
+ */
+void DataControlSource::zwlr_data_control_source_v1_send(const QString& mime, int32_t fd) {
+  // closed once written or when the payload never arrives
+  const auto pipe = std::shared_ptr<int>(new int(fd), [](int* fd) {
+    close(*fd); delete fd;
+  });
+
+  // the promised payload is fetched from the peer without
+  // blocking the loop and written once it arrives
+  if (auto lazy = qobject_cast<LazyMimeData*>(m_mimeData.get())) {
+    // the image may be kept as qoi that only clipbird reads
+    if (mime == MIME_TYPE_PNG && !lazy->hasFormat(MIME_TYPE_PNG)) {
+      return lazy->fetch(MIME_TYPE_QOI, [pipe](const QByteArray& qoi) {
+        writeData(pipe, [qoi] {
+          return qoi.isEmpty() ? QByteArray() : utility::functions::encodePng(utility::functions::decodeQoi(qoi));
+        });
+      });
+    }
+
+    // the text is kept without charset
+    const auto fetchMime = mime == MIME_TYPE_UTF8 && !lazy->hasFormat(MIME_TYPE_UTF8) ? MIME_TYPE_TEXT : mime;
+
+    // write the payload once fetched
+    return lazy->fetch(fetchMime, [pipe](const QByteArray& data) {
+      writeData(pipe, [data] { return data; });
+    });
+  }
+
+  // the image is encoded in background
+  if (mime == MIME_TYPE_PNG && !m_mimeData->hasFormat(MIME_TYPE_PNG) && m_mimeData->hasImage()) {
+    return writeData(pipe, [image = qvariant_cast<QImage>(m_mimeData->imageData())] {
+      return utility::functions::encodePng(image);
+    });
+  }
+
+  // data to send
+  const auto data = mime == MIME_TYPE_UTF8 ? m_mimeData->text().toUtf8() : m_mimeData->data(mime);
+
+  // write the data
+  writeData(pipe, [data] { return data; });
+}
+
+/**
+ * @brief Selection is replaced
+ */
+void DataControlSource::zwlr_data_control_source_v1_cancelled() {
+  emit OnCancelled();
+}
+
+/**
+ * @brief Construct a new Data Control Source object and
+ * offer the formats of the mime data
+ *
+ * @param id source
+ * @param mimeData mime data, the source takes ownership
+ */
+DataControlSource::DataControlSource(struct ::zwlr_data_control_source_v1* id, QMimeData* mimeData)
+    : QtWayland::zwlr_data_control_source_v1(id),
+      m_mimeData(mimeData, [](QMimeData* mimeData) { if (mimeData) mimeData->deleteLater(); }) {
+  // formats to offer
+  QStringList formats;
+
+  // the internal formats are offered as standard types
+  for (const auto& format : m_mimeData->formats()) {
+    if (format == MIME_TYPE_IMAGE) {
+      formats.append(MIME_TYPE_PNG);
+    } else if (format == MIME_TYPE_TEXT) {
+      formats.append({MIME_TYPE_TEXT, MIME_TYPE_UTF8});
+    } else {
+      formats.append(format);
+    }
+  }
+
+  // remove the duplicates
+  formats.removeDuplicates();
+
+  // offer the formats
+  for (const auto& format : formats) offer(format);
+}
+
+/**
+ * @brief Destroy the Data Control Source object
+ */
+DataControlSource::~DataControlSource() {
+  destroy();
+}
+
+/**
+ * @brief Get the mime data of the selection
+ */
+std::shared_ptr<QMimeData> DataControlSource::mimeData() const {
+  return m_mimeData;
+}
+
+//------------------------------ DataControlDevice ------------------------------//
+
+/**
+ * @brief New offer is introduced
+ */
+void DataControlDevice::zwlr_data_control_device_v1_data_offer(struct ::zwlr_data_control_offer_v1* id) {
+  // owned by the device once it is the selection
+  new DataControlOffer(id);
+}
+
+/**
+ * @brief Selection changed
+ */
+void DataControlDevice::zwlr_data_control_device_v1_selection(struct ::zwlr_data_control_offer_v1* id) {
+  // the previous offer is deleted on this thread once the last reader releases it
+  const auto deleter = [](DataControlOffer* offer) { if (offer) offer->deleteLater(); };
+
+  // get the offer of the id
+  if (id == nullptr) {
+    m_offer.reset();
+  } else {
+    m_offer.reset(dynamic_cast<DataControlOffer*>(QtWayland::zwlr_data_control_offer_v1::fromObject(id)), deleter);
+  }
+
+  // notify the listeners
+  emit OnSelectionChanged();
+}
+
+/**
+ * @brief Primary selection changed, it is left to Qt
+ */
+void DataControlDevice::zwlr_data_control_device_v1_primary_selection(struct ::zwlr_data_control_offer_v1* id) {
+  if (id != nullptr) delete dynamic_cast<DataControlOffer*>(QtWayland::zwlr_data_control_offer_v1::fromObject(id));
+}
+
+/**
+ * @brief Construct a new Data Control Device object
+ *
+ * @param id device
+ */
+DataControlDevice::DataControlDevice(struct ::zwlr_data_control_device_v1* id)
+    : QtWayland::zwlr_data_control_device_v1(id) {
+  // Nothing to do
+}
+
+/**
+ * @brief Destroy the Data Control Device object
+ */
+DataControlDevice::~DataControlDevice() {
+  destroy();
+}
+
+/**
+ * @brief Set the selection
+ *
+ * @param source source of the selection
+ */
+void DataControlDevice::setSelection(std::unique_ptr<DataControlSource> source) {
+  // forget the source once an other client takes the selection
+  QObject::connect(source.get(), &DataControlSource::OnCancelled, this, [this, ptr = source.get()] {
+    if (m_source.get() == ptr) m_source.release()->deleteLater();
+  });
+
+  // set the selection
+  set_selection(source->object());
+
+  // keep the source
+  m_source = std::move(source);
+}
+
+/**
+ * @brief Clear the selection
+ */
+void DataControlDevice::clearSelection() {
+  set_selection(nullptr);
+  m_source.reset();
+}
+
+/**
+ * @brief Get the selection set by this client
+ *
+ * @return mime data or nullptr
+ */
+std::shared_ptr<QMimeData> DataControlDevice::ownSelection() const {
+  return m_source ? m_source->mimeData() : nullptr;
+}
+
+/**
+ * @brief Get the selection received from the compositor, it
+ * stays valid while held even if the selection changes
+ *
+ * @return mime data or nullptr
+ */
+std::shared_ptr<QMimeData> DataControlDevice::receivedSelection() const {
+  return m_offer;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::clipboard
+
+#endif  // WITH_WAYLAND
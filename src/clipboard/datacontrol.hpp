@@ -0,0 +1,307 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+#ifdef WITH_WAYLAND
+
+// Qt header
+#include <QBuffer>
+#include <QByteArray>
+#include <QGuiApplication>
+#include <QImage>
+#include <QMimeData>
+#include <QObject>
+#include <QRegularExpression>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QtConcurrent>
+#include <QtGui/qguiapplication_platform.h>
+#include <QtWaylandClient/QWaylandClientExtension>
+
+// C++ header
+#include <functional>
+#include <memory>
+
+// Platform header
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <wayland-client.h>
+
+// Generated protocol header
+#include "qwayland-wlr-data-control-unstable-v1.h"
+
+// project header
+#include "clipboard/lazymimedata.hpp"
+#include "utility/functions/qoi/qoi.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::clipboard {
+/**
+ * @brief Global zwlr_data_control_manager_v1 of the compositor, it
+ * is active only if the compositor supports the data control
+ */
+class DataControlDeviceManager
+    : public QWaylandClientExtensionTemplate<DataControlDeviceManager>,
+      public QtWayland::zwlr_data_control_manager_v1 {
+ private:  // just for Qt
+
+  /// @brief Qt meta object
+  Q_OBJECT
+
+ public:
+
+  /**
+   * @brief Construct a new Data Control Device Manager object
+   */
+  DataControlDeviceManager();
+
+  /**
+   * @brief Destroy the Data Control Device Manager object
+   */
+  ~DataControlDeviceManager() override;
+};
+
+/**
+ * @brief Selection offered by an other client, the payload of the
+ * mime type is read through a pipe only when it is requested
+ */
+class DataControlOffer : public QMimeData, public QtWayland::zwlr_data_control_offer_v1 {
+ private:  // just for Qt
+
+  /// @brief Qt meta object
+  Q_OBJECT
+
+ private:  // disable copy and move
+
+  Q_DISABLE_COPY_MOVE(DataControlOffer)
+
+ private:  // members
+
+  /// @brief mime types offered
+  QStringList m_formats;
+
+ private:  // mime types
+
+  const QString MIME_TYPE_TEXT  = "text/plain";
+  const QString MIME_TYPE_UTF8  = "text/plain;charset=utf-8";
+  const QString MIME_TYPE_PNG   = "image/png";
+  const QString MIME_TYPE_IMAGE = "application/x-qt-image";
+
+ private:  // private functions
+
+  /**
+   * @brief Read the pipe until the writer closes it, the bytes are
+   * read directly into the result without intermediate buffers
+   *
+   * @param fd read end of the pipe in non blocking mode
+   * @param data read data
+   * @return true if read until end
+   */
+  static bool readData(int fd, QByteArray& data);
+
+ protected:  // protocol events
+
+  /**
+   * @brief Mime type offered
+   */
+  void zwlr_data_control_offer_v1_offer(const QString& mime) override;
+
+ protected:  // QMimeData
+
+  /**
+   * @brief Receive the data of the mime type from the source
+   */
+  QVariant retrieveData(const QString& mime, QMetaType type) const override;
+
+ public:
+
+  /**
+   * @brief Construct a new Data Control Offer object
+   *
+   * @param id offer
+   */
+  explicit DataControlOffer(struct ::zwlr_data_control_offer_v1* id);
+
+  /**
+   * @brief Destroy the Data Control Offer object
+   */
+  ~DataControlOffer() override;
+
+  /**
+   * @brief Get the offered formats, the image is exposed as
+   * application/x-qt-image if any image is offered
+   */
+  QStringList formats() const override;
+
+  /**
+   * @brief Has the format
+   */
+  bool hasFormat(const QString& mime) const override;
+};
+
+/**
+ * @brief Selection that is set by this client, the payload is
+ * taken from the mime data on main thread, the promised payload
+ * once it arrives from the peer, and written to the pipe in
+ * background so a slow reader does not block
+ */
+class DataControlSource : public QObject, public QtWayland::zwlr_data_control_source_v1 {
+ signals:  // signals
+  /// @brief Selection is replaced by an other client
+  void OnCancelled();
+
+ private:  // just for Qt
+
+  /// @brief Qt meta object
+  Q_OBJECT
+
+ private:  // disable copy and move
+
+  Q_DISABLE_COPY_MOVE(DataControlSource)
+
+ private:  // members
+
+  /// @brief mime data of the selection, shared with the readers
+  std::shared_ptr<QMimeData> m_mimeData;
+
+ private:  // mime types
+
+  const QString MIME_TYPE_TEXT  = "text/plain";
+  const QString MIME_TYPE_UTF8  = "text/plain;charset=utf-8";
+  const QString MIME_TYPE_PNG   = "image/png";
+  const QString MIME_TYPE_QOI   = "image/qoi";
+  const QString MIME_TYPE_IMAGE = "application/x-qt-image";
+
+ private:  // private functions
+
+  /**
+   * @brief Produce the data and write it to the fd in background,
+   * the fd is closed once the last holder releases it
+   *
+   * @param fd write end of the pipe
+   * @param data function that produces the data
+   */
+  static void writeData(std::shared_ptr<int> fd, std::function<QByteArray()> data);
+
+ protected:  // protocol events
+
+  /**
+   * @brief Send the data of the mime type to the fd
+   */
+  void zwlr_data_control_source_v1_send(const QString& mime, int32_t fd) override;
+
+  /**
+   * @brief Selection is replaced
+   */
+  void zwlr_data_control_source_v1_cancelled() override;
+
+ public:
+
+  /**
+   * @brief Construct a new Data Control Source object and
+   * offer the formats of the mime data
+   *
+   * @param id source
+   * @param mimeData mime data, the source takes ownership
+   */
+  DataControlSource(struct ::zwlr_data_control_source_v1* id, QMimeData* mimeData);
+
+  /**
+   * @brief Destroy the Data Control Source object
+   */
+  ~DataControlSource() override;
+
+  /**
+   * @brief Get the mime data of the selection
+   */
+  std::shared_ptr<QMimeData> mimeData() const;
+};
+
+/**
+ * @brief Data control device of the seat, it receives the
+ * selection of all the clients without keyboard focus
+ */
+class DataControlDevice : public QObject, public QtWayland::zwlr_data_control_device_v1 {
+ signals:  // signals
+  /// @brief Selection changed
+  void OnSelectionChanged();
+
+ private:  // just for Qt
+
+  /// @brief Qt meta object
+  Q_OBJECT
+
+ private:  // disable copy and move
+
+  Q_DISABLE_COPY_MOVE(DataControlDevice)
+
+ private:  // members
+
+  /// @brief selection set by this client
+  std::unique_ptr<DataControlSource> m_source;
+
+  /// @brief selection received from the compositor, shared with
+  /// the readers so replacing it does not free it while read
+  std::shared_ptr<DataControlOffer> m_offer;
+
+ protected:  // protocol events
+
+  /**
+   * @brief New offer is introduced
+   */
+  void zwlr_data_control_device_v1_data_offer(struct ::zwlr_data_control_offer_v1* id) override;
+
+  /**
+   * @brief Selection changed
+   */
+  void zwlr_data_control_device_v1_selection(struct ::zwlr_data_control_offer_v1* id) override;
+
+  /**
+   * @brief Primary selection changed, it is left to Qt
+   */
+  void zwlr_data_control_device_v1_primary_selection(struct ::zwlr_data_control_offer_v1* id) override;
+
+ public:
+
+  /**
+   * @brief Construct a new Data Control Device object
+   *
+   * @param id device
+   */
+  explicit DataControlDevice(struct ::zwlr_data_control_device_v1* id);
+
+  /**
+   * @brief Destroy the Data Control Device object
+   */
+  ~DataControlDevice() override;
+
+  /**
+   * @brief Set the selection
+   *
+   * @param source source of the selection
+   */
+  void setSelection(std::unique_ptr<DataControlSource> source);
+
+  /**
+   * @brief Clear the selection
+   */
+  void clearSelection();
+
+  /**
+   * @brief Get the selection set by this client
+   *
+   * @return mime data or nullptr
+   */
+  std::shared_ptr<QMimeData> ownSelection() const;
+
+  /**
+   * @brief Get the selection received from the compositor, it
+   * stays valid while held even if the selection changes
+   *
+   * @return mime data or nullptr
+   */
+  std::shared_ptr<QMimeData> receivedSelection() const;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::clipboard
+
+#endif  // WITH_WAYLAND
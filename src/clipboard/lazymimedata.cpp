@@ -0,0 +1,182 @@
+#include "lazymimedata.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::clipboard {
+/**
+ * @brief Get the payload of the mime type, start the fetch if
+ * it is promised and not yet fetched, the platform reads the
+ * clipboard synchronously so the payload is served on a read
+ * after it is fetched
+ *
+ * @param mime mime type
+ * @return QByteArray payload or empty if not available yet
+ */
+QByteArray LazyMimeData::payload(const QString &mime) const {
+  // start the fetch, it may complete right away
+  if (!m_payloads.contains(mime)) {
+    this->fetch(mime, [](const QByteArray &) {});
+  }
+
+  // known or empty until fetched
+  return m_payloads.value(mime);
+}
+
+/**
+ * @brief Remember the fetched payload and call the callbacks
+ * that are waiting for it
+ *
+ * @param mime mime type
+ * @param data payload or empty on failure
+ */
+void LazyMimeData::resolve(const QString &mime, const QByteArray &data) const {
+  // remember the payload
+  if (!data.isEmpty()) {
+    m_payloads.insert(mime, data);
+  }
+
+  // notify the waiting callbacks
+  for (const auto &callback : m_fetching.take(mime)) {
+    callback(data);
+  }
+}
+
+/**
+ * @brief Decode the image, the decoded image is not kept so
+ * only the encoded bytes stay in memory, it is decoded in place
+ * since a nested event loop could delete this mime data while
+ * the platform is reading it
+ *
+ * @param mime mime type of the image
+ * @param data encoded image
+ * @return QImage decoded image
+ */
+QImage LazyMimeData::decodeImage(const QString &mime, const QByteArray &data) const {
+  // if no data
+  if (data.isEmpty()) return QImage();
+
+  // decode the qoi image
+  if (mime == MIME_TYPE_QOI) {
+    return utility::functions::decodeQoi(data);
+  }
+
+  // decode the png image
+  return QImage::fromData(data, IMAGE_TYPE_PNG);
+}
+
+/**
+ * @brief has the payload of the mime type either known or
+ * promised
+ */
+bool LazyMimeData::hasPayload(const QString &mime) const {
+  return m_payloads.contains(mime) || m_promised.contains(mime) || m_fetching.contains(mime);
+}
+
+/**
+ * @brief Retrieve the data of the mime type
+ */
+QVariant LazyMimeData::retrieveData(const QString &mime, QMetaType type) const {
+  // if the image is requested decode it
+  if (mime == MIME_TYPE_IMAGE) {
+    if (hasPayload(MIME_TYPE_PNG)) {
+      return decodeImage(MIME_TYPE_PNG, payload(MIME_TYPE_PNG));
+    }
+
+    if (hasPayload(MIME_TYPE_QOI)) {
+      return decodeImage(MIME_TYPE_QOI, payload(MIME_TYPE_QOI));
+    }
+
+    return QVariant();
+  }
+
+  // if not available
+  if (!hasPayload(mime)) {
+    return QVariant();
+  }
+
+  // QMimeData converts the bytes to the requested type
+  return payload(mime);
+}
+
+/**
+ * @brief Construct a new Lazy Mime Data object
+ *
+ * @param items known items
+ * @param promised promised mime types
+ * @param fetcher function to fetch the promised payload
+ */
+LazyMimeData::LazyMimeData(
+  const QVector<QPair<QString, QByteArray>> &items,
+  const QStringList &promised,
+  Fetcher fetcher
+) : m_promised(promised), m_fetcher(fetcher) {
+  for (const auto &[mime, data] : items) m_payloads.insert(mime, data);
+}
+
+/**
+ * @brief Get the formats that are available
+ */
+QStringList LazyMimeData::formats() const {
+  // formats that are available
+  QStringList formats;
+
+  // known, promised and being fetched
+  const auto mimes = QStringList(m_payloads.keys()) + m_promised + QStringList(m_fetching.keys());
+
+  // add the formats
+  for (const auto &mime : mimes) {
+    // qoi is only known to clipbird so expose as image
+    if (mime != MIME_TYPE_QOI) formats.append(mime);
+
+    // images are also available as decoded image
+    if (mime == MIME_TYPE_PNG || mime == MIME_TYPE_QOI) {
+      formats.append(MIME_TYPE_IMAGE);
+    }
+  }
+
+  // remove duplicates
+  formats.removeDuplicates();
+
+  // return the formats
+  return formats;
+}
+
+/**
+ * @brief has the format
+ */
+bool LazyMimeData::hasFormat(const QString &mime) const {
+  return formats().contains(mime);
+}
+
+/**
+ * @brief Fetch the payload of the mime type without blocking,
+ * the callback is called with the payload or empty if it is
+ * not available, right away if it is already known
+ *
+ * @param mime mime type
+ * @param callback callback with the payload
+ */
+void LazyMimeData::fetch(const QString &mime, Callback callback) const {
+  // if already known
+  if (m_payloads.contains(mime)) {
+    return callback(m_payloads.value(mime));
+  }
+
+  // if the fetch is in flight
+  if (m_fetching.contains(mime)) {
+    return m_fetching[mime].append(callback);
+  }
+
+  // if not promised
+  if (!m_promised.contains(mime) || !m_fetcher) {
+    return callback(QByteArray());
+  }
+
+  // fetch only once even if it failed
+  m_promised.removeOne(mime);
+  m_fetching.insert(mime, {callback});
+
+  // the mime data may be replaced before the payload arrives
+  m_fetcher(mime, [self = QPointer<const LazyMimeData>(this), mime](const QByteArray &data) {
+    if (self) self->resolve(mime, data);
+  });
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::clipboard
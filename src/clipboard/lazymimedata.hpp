@@ -0,0 +1,156 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QByteArray>
+#include <QImage>
+#include <QMap>
+#include <QMimeData>
+#include <QPair>
+#include <QPointer>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+
+// C++ header
+#include <functional>
+
+// project header
+#include "utility/functions/qoi/qoi.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::clipboard {
+/**
+ * @brief Mime data that holds the items that are already known
+ * and only the mime type of the items that are promised by the
+ * peer, the promised payload is fetched without blocking when an
+ * application first reads the format and served once fetched,
+ * images are kept encoded and only decoded when requested
+ */
+class LazyMimeData : public QMimeData {
+ public:  // typedefs
+
+  /// @brief function that is called with the payload or empty if not available
+  using Callback = std::function<void(const QByteArray&)>;
+
+  /// @brief function that fetch the promised payload by mime type without blocking
+  using Fetcher = std::function<void(const QString&, Callback)>;
+
+ private:  // just for Qt
+
+  /// @brief Qt meta object
+  Q_OBJECT
+
+ private:  // disable copy and move
+
+  Q_DISABLE_COPY_MOVE(LazyMimeData)
+
+ private:  // members
+
+  /// @brief payloads that are known or already fetched
+  mutable QMap<QString, QByteArray> m_payloads;
+
+  /// @brief mime types that are promised
+  mutable QStringList m_promised;
+
+  /// @brief callbacks of the fetches in flight by mime type
+  mutable QMap<QString, QList<Callback>> m_fetching;
+
+  /// @brief function to fetch the promised payload
+  Fetcher m_fetcher;
+
+ private:  // mime types
+
+  const QString MIME_TYPE_TEXT  = "text/plain";
+  const QString MIME_TYPE_PNG   = "image/png";
+  const QString MIME_TYPE_QOI   = "image/qoi";
+  const QString MIME_TYPE_HTML  = "text/html";
+  const QString MIME_TYPE_IMAGE = "application/x-qt-image";
+
+ private: // image type
+
+  const char* IMAGE_TYPE_PNG = "PNG";
+
+ private:  // private functions
+
+  /**
+   * @brief Get the payload of the mime type, start the fetch if
+   * it is promised and not yet fetched
+   *
+   * @param mime mime type
+   * @return QByteArray payload or empty if not available yet
+   */
+  QByteArray payload(const QString &mime) const;
+
+  /**
+   * @brief Remember the fetched payload and call the callbacks
+   * that are waiting for it
+   *
+   * @param mime mime type
+   * @param data payload or empty on failure
+   */
+  void resolve(const QString &mime, const QByteArray &data) const;
+
+  /**
+   * @brief Decode the image, the decoded image is not kept so
+   * only the encoded bytes stay in memory
+   *
+   * @param mime mime type of the image
+   * @param data encoded image
+   * @return QImage decoded image
+   */
+  QImage decodeImage(const QString &mime, const QByteArray &data) const;
+
+  /**
+   * @brief has the payload of the mime type either known or
+   * promised
+   */
+  bool hasPayload(const QString &mime) const;
+
+ protected:  // override
+
+  /**
+   * @brief Retrieve the data of the mime type
+   */
+  QVariant retrieveData(const QString &mime, QMetaType type) const override;
+
+ public:  // constructor
+
+  /**
+   * @brief Construct a new Lazy Mime Data object
+   *
+   * @param items known items
+   * @param promised promised mime types
+   * @param fetcher function to fetch the promised payload
+   */
+  LazyMimeData(
+    const QVector<QPair<QString, QByteArray>> &items,
+    const QStringList &promised,
+    Fetcher fetcher
+  );
+
+  /**
+   * @brief Destroy the Lazy Mime Data object
+   */
+  virtual ~LazyMimeData() = default;
+
+  /**
+   * @brief Get the formats that are available
+   */
+  QStringList formats() const override;
+
+  /**
+   * @brief has the format
+   */
+  bool hasFormat(const QString &mime) const override;
+
+  /**
+   * @brief Fetch the payload of the mime type without blocking,
+   * the callback is called with the payload or empty if it is
+   * not available, right away if it is already known
+   *
+   * @param mime mime type
+   * @param callback callback with the payload
+   */
+  void fetch(const QString &mime, Callback callback) const;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::clipboard
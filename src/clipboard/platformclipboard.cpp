@@ -27,6 +27,15 @@ PlatformClipboard *PlatformClipboard::instance() {
   return instance;
 }
 
+bool PlatformClipboard::ownsClipboard() const {
+  return qGuiApp->clipboard()->ownsClipboard();
+}
+
+std::shared_ptr<const QMimeData> PlatformClipboard::sharedMimeData(QClipboard::Mode mode) const {
+  // the mime data is owned by the Qt clipboard
+  return std::shared_ptr<const QMimeData>(mimeData(mode), [](const QMimeData *) {});
+}
+
 QString PlatformClipboard::text(QClipboard::Mode mode) {
   return instance()->mimeData(mode)->text();
 }
@@ -5,6 +5,8 @@
 #include <QMimeData>
 #include <QObject>
 
+#include <memory>
+
 namespace srilakshmikanthanp::clipbirdesk::clipboard {
 class PlatformClipboard : public QObject {
  public:
@@ -25,6 +27,18 @@ class PlatformClipboard : public QObject {
    */
   virtual const QMimeData *mimeData(QClipboard::Mode mode) const   = 0;
 
+  /**
+   * Returns the current mime data that stays valid while it is
+   * held so it can be read on an other thread, the default wraps
+   * mimeData() so an override of mimeData() must not call it
+   */
+  virtual std::shared_ptr<const QMimeData> sharedMimeData(QClipboard::Mode mode) const;
+
+  /**
+   * Returns true if the clipboard is set by this application
+   */
+  virtual bool ownsClipboard() const;
+
   /**
    * Returns the text content of the Clipboard
    */
@@ -1,19 +1,114 @@
 #include "waylandclipboard.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::clipboard {
+#ifdef WITH_WAYLAND
+void WaylandClipboard::onManagerActiveChanged() {
+  // the device is gone with the manager
+  if (!m_manager->isActive()) {
+    return m_device.reset();
+  }
+
+  // already created
+  if (m_device) return;
+
+  // get the seat of the application
+  auto app  = qGuiApp->nativeInterface<QNativeInterface::QWaylandApplication>();
+  auto seat = app ? app->seat() : nullptr;
+
+  // if no seat
+  if (seat == nullptr) return;
+
+  // create the device
+  m_device = std::make_unique<DataControlDevice>(m_manager->get_data_device(seat));
+
+  // notify the selection change without focus
+  connect(m_device.get(), &DataControlDevice::OnSelectionChanged, this, [this] {
+    emit changed(QClipboard::Mode::Clipboard);
+  });
+}
+#endif
+
 WaylandClipboard::WaylandClipboard(QObject *parent) : PlatformClipboard(parent) {
-  // Wayland does not support signals for clipboard change
+#ifdef WITH_WAYLAND
+  // the reader may close the pipe before all data is written
+  ::signal(SIGPIPE, SIG_IGN);
+
+  // create the manager
+  m_manager = std::make_unique<DataControlDeviceManager>();
+
+  // create the device once the compositor announces the manager
+  connect(
+    m_manager.get(), &DataControlDeviceManager::activeChanged,
+    this, &WaylandClipboard::onManagerActiveChanged
+  );
+
+  // bind the global
+  m_manager->initialize();
+
+  // Fallback to Qt which notifies only when the window has focus
+  connect(qGuiApp->clipboard(), &QClipboard::changed, this, [this](QClipboard::Mode mode) {
+    if (!m_device) emit changed(mode);
+  });
+#else
+  // Fallback to Qt which notifies only when the window has focus
+  connect(qGuiApp->clipboard(), &QClipboard::changed, this, &PlatformClipboard::changed);
+#endif
 }
 
+WaylandClipboard::~WaylandClipboard() = default;
+
 void WaylandClipboard::setMimeData(QMimeData *mime, QClipboard::Mode mode) {
+#ifdef WITH_WAYLAND
+  if (m_device && mode == QClipboard::Mode::Clipboard) {
+    auto source = m_manager->create_data_source();
+    return m_device->setSelection(std::make_unique<DataControlSource>(source, mime));
+  }
+#endif
+
   qGuiApp->clipboard()->setMimeData(mime, mode);
 }
 
 void WaylandClipboard::clear(QClipboard::Mode mode) {
+#ifdef WITH_WAYLAND
+  if (m_device && mode == QClipboard::Mode::Clipboard) {
+    return m_device->clearSelection();
+  }
+#endif
+
   qGuiApp->clipboard()->clear(mode);
 }
 
 const QMimeData *WaylandClipboard::mimeData(QClipboard::Mode mode) const {
+#ifdef WITH_WAYLAND
+  // own selection is not read back through the pipe
+  if (m_device && mode == QClipboard::Mode::Clipboard) {
+    if (auto own = m_device->ownSelection()) return own.get();
+    return m_device->receivedSelection().get();
+  }
+#endif
+
   return qGuiApp->clipboard()->mimeData(mode);
 }
+
+std::shared_ptr<const QMimeData> WaylandClipboard::sharedMimeData(QClipboard::Mode mode) const {
+#ifdef WITH_WAYLAND
+  // own selection is not read back through the pipe
+  if (m_device && mode == QClipboard::Mode::Clipboard) {
+    if (auto own = m_device->ownSelection()) return own;
+    return m_device->receivedSelection();
+  }
+#endif
+
+  // the mime data is owned by the Qt clipboard, not through
+  // the base class as it calls back into mimeData
+  return std::shared_ptr<const QMimeData>(qGuiApp->clipboard()->mimeData(mode), [](const QMimeData *) {});
+}
+
+bool WaylandClipboard::ownsClipboard() const {
+#ifdef WITH_WAYLAND
+  if (m_device) return m_device->ownSelection() != nullptr;
+#endif
+
+  return PlatformClipboard::ownsClipboard();
+}
 }  // namespace srilakshmikanthanp::clipbirdesk::clipboard
@@ -1,16 +1,48 @@
 #pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
 
+// C++ header
+#include <memory>
+
+// project header
+#include "clipboard/datacontrol.hpp"
 #include "clipboard/platformclipboard.hpp"
 
+#ifdef WITH_WAYLAND
+#include <signal.h>
+#endif
+
 namespace srilakshmikanthanp::clipbirdesk::clipboard {
 
+/**
+ * @brief Clipboard on Wayland, it uses the wlr data control protocol
+ * if the compositor supports it so the selection is received without
+ * focus, otherwise it falls back to the Qt clipboard
+ */
 class WaylandClipboard : public PlatformClipboard {
+#ifdef WITH_WAYLAND
+ private:  // members
+
+  /// @brief data control manager
+  std::unique_ptr<DataControlDeviceManager> m_manager;
+
+  /// @brief data control device of the seat
+  std::unique_ptr<DataControlDevice> m_device;
+
+ private:  // private functions
+
+  /// @brief create the device once the manager is active
+  void onManagerActiveChanged();
+#endif
+
  public:
 
   WaylandClipboard(QObject *parent);
+  ~WaylandClipboard() override;
   void setMimeData(QMimeData *mime, QClipboard::Mode mode) override;
   void clear(QClipboard::Mode mode) override;
   const QMimeData *mimeData(QClipboard::Mode mode) const override;
+  std::shared_ptr<const QMimeData> sharedMimeData(QClipboard::Mode mode) const override;
+  bool ownsClipboard() const override;
 };
 
 }  // namespace srilakshmikanthanp::clipbirdesk::clipboard
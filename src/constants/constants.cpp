@@ -1,4 +1,5 @@
 #include "constants.hpp"
+#include "types/enums/enums.hpp"
 #include <iostream>
 
 namespace srilakshmikanthanp::clipbirdesk::constants {
@@ -18,10 +19,27 @@ const char* getAppUUID() {
 }
 
 /**
- * @brief App Max History Size
+ * @brief App Max History Size used when it is not configured, large
+ * payloads beyond the memory budget are kept on the disk only
  * @return int
  */
 int getAppMaxHistorySize() {
+  return 200;
+}
+
+/**
+ * @brief Max number of sent items a host keeps promised
+ * @return int
+ */
+int getAppMaxPromises() {
+  return 20;
+}
+
+/**
+ * @brief Max number of received file streams kept on the disk
+ * @return int
+ */
+int getAppMaxReceivedStreams() {
   return 20;
 }
 
@@ -72,6 +90,27 @@ std::string getAppLogFile() {
   return (std::filesystem::path(getAppHome()) / "clipbird.log").string();
 }
 
+/**
+ * @brief Get App Staging Directory where the received files are written
+ */
+std::string getAppStagingDir() {
+  return (std::filesystem::path(getAppHome()) / "staging").string();
+}
+
+/**
+ * @brief Get App History Directory where the history store lives
+ */
+std::string getAppHistoryDir() {
+  return (std::filesystem::path(getAppHome()) / "history").string();
+}
+
+/**
+ * @brief Get App Thumbnail Directory where the history thumbnails are cached
+ */
+std::string getAppThumbnailDir() {
+  return (std::filesystem::path(getAppHome()) / "thumbnails").string();
+}
+
 /**
  * @brief Get the App Window Size
  * @return QSize
@@ -124,6 +163,47 @@ const char* getMDnsServiceType() {
   return "_clipbird._tcp";
 }
 
+/**
+ * @brief Get the protocol version advertised with the service, servers
+ * with another version are not compatible
+ */
+quint32 getAppProtocolVersion() {
+  return 1;
+}
+
+/**
+ * @brief Get the feature bits advertised with the service
+ */
+quint32 getAppFeatures() {
+  return types::enums::Feature::LAZY_SYNC
+       | types::enums::Feature::FILE_STREAM
+       | types::enums::Feature::HISTORY_SYNC
+       | types::enums::Feature::QOI_IMAGE;
+}
+
+/**
+ * @brief Used to get the max time to wait for a service resolve
+ */
+int getMDnsResolveTimeout() {
+  return 5 * 1000;
+}
+
+/**
+ * @brief Used to get the time a resolved service target is reused, the
+ * resolve callback has no TTL so the RFC 6762 SRV record TTL is used
+ */
+long long getMDnsResolveCacheTTL() {
+  return 120LL * 1000LL;
+}
+
+/**
+ * @brief Used to get the time to wait for the other address family
+ * after the addresses of one family are resolved
+ */
+int getMDnsAddressGraceTime() {
+  return 150;
+}
+
 /**
  * @brief Get the Organization Name
  *
@@ -140,6 +220,58 @@ long long getAppCertExpiryInterval() {
   return 60LL * 60LL * 24LL * 60LL * 1000LL;
 }
 
+/**
+ * @brief Used to get the interval to check whether the certificate should be renewed
+ */
+int getAppCertRenewInterval() {
+  return 60 * 60 * 6 * 1000;
+}
+
+/**
+ * @brief Used to get the delay before the failed certificate generation is retried
+ */
+int getAppCertRetryInterval() {
+  return 30 * 1000;
+}
+
+/**
+ * @brief Used to get the delay before the connection to the next
+ * address of the server is attempted, RFC 8305 recommends 250 ms
+ */
+int getAppConnectAttemptDelay() {
+  return 250;
+}
+
+/**
+ * @brief Used to get the max time to race the addresses of the server
+ */
+int getAppConnectRaceTimeout() {
+  return 10 * 1000;
+}
+
+/**
+ * @brief Used to get the time the last known endpoint of a server
+ * is dialed at startup after it was last connected
+ */
+long long getAppEndpointCacheTTL() {
+  return 7LL * 24LL * 60LL * 60LL * 1000LL;
+}
+
+/**
+ * @brief Used to get the number of server endpoints remembered
+ */
+qsizetype getAppEndpointCacheSize() {
+  return 8;
+}
+
+/**
+ * @brief Used to get the max time the last known endpoint of a
+ * server is dialed before the discovery takes over
+ */
+int getAppCachedDialTimeout() {
+  return 2 * 1000;
+}
+
 /**
  *  @brief Used to get the max read idle time
  */
@@ -160,4 +292,87 @@ long long getAppMaxWriteIdleTime() {
 const char* getAppHistoryShortcut()  {
   return "Ctrl+Alt+C";
 }
+
+/**
+ * @brief Used to get the size in bytes above which the clipboard
+ * items are promised instead of sent with the lazy sync
+ */
+quint32 getAppLazySyncThreshold() {
+  return 64 * 1024;
+}
+
+/**
+ * @brief Used to get the max time to wait for a promised payload
+ */
+long long getAppLazyFetchTimeout() {
+  return 10 * 1000;
+}
+
+/**
+ * @brief Used to get the size of the chunk the files are streamed in
+ */
+quint32 getAppFileChunkSize() {
+  return 1024 * 1024;
+}
+
+/**
+ * @brief Used to get the number of chunks that can be queued on the
+ * socket before the file sender waits for them to be written
+ */
+quint32 getAppFileWindowSize() {
+  return 4;
+}
+
+/**
+ * @brief Used to get the disk space that is left free when the
+ * received files are pre allocated
+ */
+quint64 getAppMinFreeDiskSpace() {
+  return quint64(512) * 1024 * 1024;
+}
+
+/**
+ * @brief Used to get the size after which the history store starts
+ * a new segment file
+ */
+quint64 getAppHistorySegmentSize() {
+  return 64 * 1024 * 1024;
+}
+
+/**
+ * @brief Used to get the number of leading characters of a history
+ * entry that are searchable
+ */
+qsizetype getAppSearchTextLimit() {
+  return 64 * 1024;
+}
+
+/**
+ * @brief Used to get the default bytes of history payloads kept in memory
+ */
+quint64 getAppHistoryMemoryBudget() {
+  return 64 * 1024 * 1024;
+}
+
+/**
+ * @brief Used to get the size from which a history payload is spilled
+ * to the history store when over the memory budget
+ */
+quint64 getAppHistorySpillThreshold() {
+  return 64 * 1024;
+}
+
+/**
+ * @brief Used to get the bytes of thumbnails kept in memory
+ */
+qsizetype getAppThumbnailMemoryCache() {
+  return 16 * 1024 * 1024;
+}
+
+/**
+ * @brief Used to get the number of thumbnails kept on the disk
+ */
+qsizetype getAppThumbnailDiskCache() {
+  return 1024;
+}
 }  // namespace srilakshmikanthanp::clipbirdesk::config
@@ -25,11 +25,24 @@ const char* getAppVersion();
 const char* getAppUUID();
 
 /**
- * @brief App Max History Size
+ * @brief App Max History Size used when it is not configured, large
+ * payloads beyond the memory budget are kept on the disk only
  * @return int
  */
 int getAppMaxHistorySize();
 
+/**
+ * @brief Max number of sent items a host keeps promised
+ * @return int
+ */
+int getAppMaxPromises();
+
+/**
+ * @brief Max number of received file streams kept on the disk
+ * @return int
+ */
+int getAppMaxReceivedStreams();
+
 /**
  * @brief Get the Application Name
  * @return const char*
@@ -65,6 +78,21 @@ std::string getAppHome();
  */
 std::string getAppLogFile();
 
+/**
+ * @brief Get App Staging Directory where the received files are written
+ */
+std::string getAppStagingDir();
+
+/**
+ * @brief Get App History Directory where the history store lives
+ */
+std::string getAppHistoryDir();
+
+/**
+ * @brief Get App Thumbnail Directory where the history thumbnails are cached
+ */
+std::string getAppThumbnailDir();
+
 /**
  * @brief Get the App Home Page
  *
@@ -105,6 +133,34 @@ std::string getMDnsServiceName();
  */
 const char* getMDnsServiceType();
 
+/**
+ * @brief Get the protocol version advertised with the service, servers
+ * with another version are not compatible
+ */
+quint32 getAppProtocolVersion();
+
+/**
+ * @brief Get the feature bits advertised with the service
+ */
+quint32 getAppFeatures();
+
+/**
+ * @brief Used to get the max time to wait for a service resolve
+ */
+int getMDnsResolveTimeout();
+
+/**
+ * @brief Used to get the time a resolved service target is reused, the
+ * resolve callback has no TTL so the RFC 6762 SRV record TTL is used
+ */
+long long getMDnsResolveCacheTTL();
+
+/**
+ * @brief Used to get the time to wait for the other address family
+ * after the addresses of one family are resolved
+ */
+int getMDnsAddressGraceTime();
+
 /**
  * @brief Get the App Org Name object
  *
@@ -117,6 +173,44 @@ const char* getAppOrgName();
  */
 long long getAppCertExpiryInterval();
 
+/**
+ * @brief Used to get the interval to check whether the certificate should be renewed
+ */
+int getAppCertRenewInterval();
+
+/**
+ * @brief Used to get the delay before the failed certificate generation is retried
+ */
+int getAppCertRetryInterval();
+
+/**
+ * @brief Used to get the delay before the connection to the next
+ * address of the server is attempted, RFC 8305 recommends 250 ms
+ */
+int getAppConnectAttemptDelay();
+
+/**
+ * @brief Used to get the max time to race the addresses of the server
+ */
+int getAppConnectRaceTimeout();
+
+/**
+ * @brief Used to get the time the last known endpoint of a server
+ * is dialed at startup after it was last connected
+ */
+long long getAppEndpointCacheTTL();
+
+/**
+ * @brief Used to get the number of server endpoints remembered
+ */
+qsizetype getAppEndpointCacheSize();
+
+/**
+ * @brief Used to get the max time the last known endpoint of a
+ * server is dialed before the discovery takes over
+ */
+int getAppCachedDialTimeout();
+
 /**
  *  @brief Used to get the max read idle time
  */
@@ -131,4 +225,65 @@ long long getAppMaxWriteIdleTime();
  * @brief Used to get Keyboard shortcut for Clipbird history
  */
 const char* getAppHistoryShortcut();
+
+/**
+ * @brief Used to get the size in bytes above which the clipboard
+ * items are promised instead of sent with the lazy sync
+ */
+quint32 getAppLazySyncThreshold();
+
+/**
+ * @brief Used to get the max time to wait for a promised payload
+ */
+long long getAppLazyFetchTimeout();
+
+/**
+ * @brief Used to get the size of the chunk the files are streamed in
+ */
+quint32 getAppFileChunkSize();
+
+/**
+ * @brief Used to get the number of chunks that can be queued on the
+ * socket before the file sender waits for them to be written
+ */
+quint32 getAppFileWindowSize();
+
+/**
+ * @brief Used to get the disk space that is left free when the
+ * received files are pre allocated
+ */
+quint64 getAppMinFreeDiskSpace();
+
+/**
+ * @brief Used to get the size after which the history store starts
+ * a new segment file
+ */
+quint64 getAppHistorySegmentSize();
+
+/**
+ * @brief Used to get the number of leading characters of a history
+ * entry that are searchable
+ */
+qsizetype getAppSearchTextLimit();
+
+/**
+ * @brief Used to get the default bytes of history payloads kept in memory
+ */
+quint64 getAppHistoryMemoryBudget();
+
+/**
+ * @brief Used to get the size from which a history payload is spilled
+ * to the history store when over the memory budget
+ */
+quint64 getAppHistorySpillThreshold();
+
+/**
+ * @brief Used to get the bytes of thumbnails kept in memory
+ */
+qsizetype getAppThumbnailMemoryCache();
+
+/**
+ * @brief Used to get the number of thumbnails kept on the disk
+ */
+qsizetype getAppThumbnailDiskCache();
 }  // namespace srilakshmikanthanp::clipbirdesk::config
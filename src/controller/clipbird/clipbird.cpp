@@ -20,13 +20,10 @@ void ClipBird::handleClientStateChanged(types::Device client, bool connected) {
   auto &store = storage::Storage::instance();
 
   // store the client certificate
-  store.setClientCert(client.name, cert.toPem());
+  store.setClientCert(client.name, cert);
 
-  // add ca certificates
-  this->m_sslConfig.addCaCertificate(cert);
-
-  // set new config for Server
-  std::get<Server>(m_host).setSslConfiguration(this->m_sslConfig);
+  // add ca certificate if new
+  this->addCaCertificate(cert);
 }
 
 /**
@@ -51,9 +48,13 @@ void ClipBird::handleServerStatusChanged(bool status, types::Device host) {
     connect(&m_clipboard, signal, client, slot);
     auto cert = client->getConnectedServerCertificate();
     auto name = host.name;
-    store.setServerCert(name, cert.toPem());
-    this->m_sslConfig.addCaCertificate(cert);
-    client->setSslConfiguration(this->m_sslConfig);
+    store.setServerCert(name, cert);
+    store.setServerEndpoint(
+      name, client->getServerAddresses(host), host.port,
+      storage::TrustStore::fingerprintOf(cert)
+    );
+    this->addCaCertificate(cert);
+    client->sendHistorySummary(this->historySummary(), this->historyFree());
     return;
   }
 
@@ -62,7 +63,7 @@ void ClipBird::handleServerStatusChanged(bool status, types::Device host) {
 
   // Get all server
   for (auto s : client->getServerList()) {
-    if (host != s && store.hasServerCert(s.name)) {
+    if (host != s && this->isTrustedServer(s)) {
       return client->connectToServerSecured(s);
     }
   }
@@ -83,30 +84,173 @@ void ClipBird::handleServerFound(types::Device server) {
   // if already connected then return
   if (connectedServer.has_value()) return;
 
-  // get the client and store the server
+  // get the client
   auto *client = &std::get<Client>(m_host);
-  auto &store  = storage::Storage::instance();
 
-  // if the server is not found then return
-  if (store.hasServerCert(server.name)) {
+  // the trusted server found replaces the dial of the last known
+  // endpoint that has not reached it, other dials are waited for
+  if (client->isConnectingCached()) {
+    if (!client->isConnecting() || !this->isTrustedServer(server)) return;
+    client->cancelCachedServer();
+  } else if (client->isConnecting()) {
+    return;
+  }
+
+  // connect the pinned server without trial handshake
+  if (this->isTrustedServer(server)) {
     client->connectToServerSecured(server);
   }
 }
 
+/**
+ * @brief Is the server pinned by its advertised certificate, servers
+ * that advertise nothing are trusted by name
+ */
+bool ClipBird::isTrustedServer(const types::Device &server) {
+  // get the store
+  auto &store  = storage::Storage::instance();
+
+  // advertised fingerprint of the server
+  auto fingerprint = std::get<Client>(m_host).getServerFingerprint(server);
+
+  // if advertised then it should match the pinned one
+  if (fingerprint.has_value()) {
+    return store.isServerTrusted(server.name, *fingerprint);
+  } else {
+    return store.hasServerCert(server.name);
+  }
+}
+
+/**
+ * @brief Handle the last known server not reachable, connect
+ * the trusted server that the discovery found meanwhile
+ */
+void ClipBird::handleCachedServerFailed(types::Device server) {
+  // if the host is not client then throw error
+  if (!std::holds_alternative<Client>(m_host)) {
+    throw std::runtime_error("Host is not client");
+  }
+
+  // log the failure
+  qInfo() << (LOG("Last known server is not reachable: " + server.name.toStdString()));
+
+  // get the client
+  auto *client = &std::get<Client>(m_host);
+
+  // Get all server
+  for (auto s : client->getServerList()) {
+    if (this->isTrustedServer(s)) {
+      return client->connectToServerSecured(s);
+    }
+  }
+}
+
+/**
+ * @brief Connect to the most recent server that is still trusted
+ * on its last known addresses without waiting for the discovery
+ */
+void ClipBird::connectToCachedServer() {
+  // if the host is not client then throw error
+  if (!std::holds_alternative<Client>(m_host)) {
+    throw std::runtime_error("Host is not client");
+  }
+
+  // get the client and store
+  auto *client = &std::get<Client>(m_host);
+  auto &store  = storage::Storage::instance();
+
+  // most recent first
+  for (const auto &endpoint : store.getServerEndpoints()) {
+    // the certificate may be changed or forgotten
+    if (!store.isServerTrusted(endpoint.name, endpoint.fingerprint)) {
+      continue;
+    }
+
+    // the server with its primary address
+    const auto server = types::Device({endpoint.addresses.constFirst(), endpoint.port, endpoint.name});
+
+    // dial the server
+    return client->connectToCachedServer(server, endpoint.addresses);
+  }
+}
+
 /**
  * @brief Handle the sync request (From server)
  */
 void ClipBird::handleSyncRequest(QVector<QPair<QString, QByteArray>> data) {
-  // remove last
-  if (this->m_history.size() + 1 > constants::getAppMaxHistorySize()) {
-    this->m_history.pop_back();
+  // using fingerprint to detect the duplicate
+  using utility::functions::fingerprint;
+
+  // add to history
+  this->pushHistory(data, fingerprint(data));
+}
+
+/**
+ * @brief Handle the promise request
+ */
+void ClipBird::handlePromiseRequest(quint64 id, QVector<QPair<QString, QByteArray>> items, QVector<QPair<QString, quint64>> promised) {
+  // set the clipboard
+  m_clipboard.setLazy(items, promised, this->fetcherOf(id, promised));
+
+  // the promised items are added once fetched
+  if (items.isEmpty()) return;
+
+  // add the known items to history, if not the latest already
+  if (!this->pushHistory(items, fingerprintOf(items, promised))) return;
+
+  // the inserted front is of the promise
+  auto &front    = this->m_history[0];
+  front.promise  = id;
+  front.promised = promised;
+}
+
+/**
+ * @brief Handle the history summary of the client (From Server)
+ */
+void ClipBird::handleHistorySummary(types::Device client, QVector<quint64> entries, quint32 free) {
+  // if the host is not server then throw error
+  if (!std::holds_alternative<Server>(m_host)) {
+    throw std::runtime_error("Host is not server");
   }
 
-  // add to front
-  this->m_history.push_front(data);
+  // send the summary of the server and the missing entries
+  std::get<Server>(m_host).syncHistory(
+    client, this->missingHistory(entries, free), this->historySummary(), this->historyFree()
+  );
+}
 
-  // emit the signal
-  emit OnHistoryChanged(m_history);
+/**
+ * @brief Handle the history entry that is missing here, the
+ * entry is placed by recency and never evicts a local entry
+ */
+void ClipBird::handleHistoryEntry(quint64 id, QVector<QPair<QString, QByteArray>> items, QVector<QPair<QString, quint64>> promised, QVector<quint64> history) {
+  // fingerprint of the entry and of the known items, an entry
+  // whose promised items were never fetched has the later one
+  const auto print   = fingerprintOf(items, promised);
+  const auto partial = utility::functions::fingerprint(items);
+
+  // if the entry is already in the history
+  for (qsizetype i = 0; i < m_history.size(); ++i) {
+    const auto fingerprint = m_history.at(i).fingerprint;
+    if (fingerprint == print || (!items.isEmpty() && fingerprint == partial)) return;
+  }
+
+  // the catch-up only fills the free capacity
+  if (m_history.size() >= m_history.capacity()) return;
+
+  // place the entry by recency
+  const auto index = this->historyIndexOf(print, history);
+
+  // add to history
+  this->insertHistory(index, items, print);
+
+  // the inserted entry is of the promise
+  auto &entry    = this->m_history[index];
+  entry.promise  = id;
+  entry.promised = promised;
+
+  // the entry has the largest id so the newer ones are renewed
+  if (index > 0) QTimer::singleShot(0, this, &ClipBird::orderStoredHistory);
 }
 
 /**
@@ -124,16 +268,8 @@ void ClipBird::handleAuthRequest(types::Device host) {
   // get the store instance
   auto &store = storage::Storage::instance();
 
-  // is store not has the certificate
-  if (!store.hasClientCert(host.name)) {
-    return emit OnAuthRequest(host);
-  }
-
-  // get the certificate from the store
-  auto c = store.getClientCert(host.name);
-
-  // if the certificate is not same then emit the signal
-  if (c != cert.toPem()) {
+  // if the certificate is not the one trusted then emit the signal
+  if (!store.isClientTrusted(host.name, cert)) {
     return emit OnAuthRequest(host);
   } else {
     return this->authSuccess(host);
@@ -141,7 +277,8 @@ void ClipBird::handleAuthRequest(types::Device host) {
 }
 
 /**
- * @brief Set the SSL Configuration object
+ * @brief Set the SSL Configuration object used by the
+ * host for the new connections
  */
 void ClipBird::setSslConfiguration(QSslConfiguration config) {
   // storage instance
@@ -151,20 +288,588 @@ void ClipBird::setSslConfiguration(QSslConfiguration config) {
   QList<QSslCertificate> caCerts;
 
   // set all ca Client certs from store
-  for (auto certByte : store.getAllClientCert()) {
-    caCerts.append(QSslCertificate(certByte, QSsl::Pem));
-  }
+  caCerts.append(store.getAllClientCert());
 
   // set all ca Server certs from store
-  for (auto certByte : store.getAllServerCert()) {
-    caCerts.append(QSslCertificate(certByte, QSsl::Pem));
+  caCerts.append(store.getAllServerCert());
+
+  // set the ssl configuration
+  this->m_sslConfig = config;
+
+  // set ca certificates
+  this->setCaCertificates(caCerts);
+
+  // set new config for the host
+  this->applySslConfiguration();
+}
+
+/**
+ * @brief Set the CA certificates without duplicates
+ */
+void ClipBird::setCaCertificates(const QList<QSslCertificate> &certs) {
+  // unique certificates
+  QList<QSslCertificate> unique;
+
+  // forget the old certificates
+  this->m_caFingerprints.clear();
+
+  // keep the first of the same fingerprint
+  for (const auto &cert : certs) {
+    const auto fingerprint = storage::TrustStore::fingerprintOf(cert);
+    if (this->m_caFingerprints.contains(fingerprint)) continue;
+    this->m_caFingerprints.insert(fingerprint);
+    unique.append(cert);
   }
 
   // set ca certificates
-  config.setCaCertificates(caCerts);
+  this->m_sslConfig.setCaCertificates(unique);
+}
 
-  // set the ssl configuration
-  this->m_sslConfig = config;
+/**
+ * @brief Add the CA certificate if not already added and
+ * apply the configuration to the host
+ */
+void ClipBird::addCaCertificate(const QSslCertificate &cert) {
+  // fingerprint of the certificate
+  const auto fingerprint = storage::TrustStore::fingerprintOf(cert);
+
+  // if already added
+  if (this->m_caFingerprints.contains(fingerprint)) return;
+
+  // add the certificate
+  this->m_caFingerprints.insert(fingerprint);
+  this->m_sslConfig.addCaCertificate(cert);
+
+  // set new config for the host
+  this->applySslConfiguration();
+}
+
+/**
+ * @brief Apply the SSL Configuration to the host
+ */
+void ClipBird::applySslConfiguration() {
+  // if the host is server then set the ssl configuration
+  if (std::holds_alternative<Server>(m_host)) {
+    std::get<Server>(m_host).setSslConfiguration(this->m_sslConfig);
+  }
+
+  // if the host is client then set the ssl configuration
+  if (std::holds_alternative<Client>(m_host)) {
+    std::get<Client>(m_host).setSslConfiguration(this->m_sslConfig);
+  }
+}
+
+/**
+ * @brief Fetch the promised payload from the group without
+ * blocking, verify it with the promised hash and add it to
+ * the history, the callback gets the payload or empty
+ */
+void ClipBird::fetchPayload(quint64 id, const QString &mime, quint64 hash, clipboard::LazyMimeData::Callback callback) {
+  // verify the payload and add it to the history
+  auto done = [self = QPointer<ClipBird>(this), id, mime, hash, callback](const QByteArray &payload) {
+    // if failed to fetch or gone
+    if (payload.isEmpty() || !self) {
+      return callback(payload);
+    }
+
+    // verify the payload
+    if (utility::functions::xxh3(payload) != hash) {
+      qWarning() << (LOG("Promised payload hash mismatch"));
+      return callback(QByteArray());
+    }
+
+    // add to the history
+    self->recordPayload(id, mime, payload);
+
+    // return the payload
+    callback(payload);
+  };
+
+  // fetch from the server
+  if (std::holds_alternative<Server>(m_host)) {
+    return std::get<Server>(m_host).fetchPayload(id, mime, done);
+  }
+
+  // fetch from the client
+  if (std::holds_alternative<Client>(m_host)) {
+    return std::get<Client>(m_host).fetchPayload(id, mime, done);
+  }
+
+  // no host to fetch from
+  callback(QByteArray());
+}
+
+/**
+ * @brief Add the fetched payload to the history entry of the
+ * promise or as new entry if the entry is gone
+ */
+void ClipBird::recordPayload(quint64 id, const QString &mime, const QByteArray &payload) {
+  // if an entry of history is of the promise then append
+  for (int i = 0; i < this->m_history.size(); ++i) {
+    // if not of the promise
+    if (this->m_history.at(i).promise != id) continue;
+
+    // items of the entry
+    auto items  = this->pageInHistory(i);
+    auto &entry = this->m_history[i];
+
+    // if already fetched
+    for (const auto &[m, data] : items) {
+      if (m == mime) return;
+    }
+
+    // the item is no longer promised
+    entry.promised.removeIf([&](const auto &item) { return item.first == mime; });
+
+    // append the payload
+    items.append({mime, payload});
+    this->m_historyResident += payloadBytes(items) - payloadBytes(entry.items);
+    entry.items       = items;
+    entry.spilled     = false;
+    entry.fingerprint = fingerprintOf(items, entry.promised);
+    this->updateStoredHistory(entry);
+    this->spillHistory();
+    emit OnHistoryItemChanged(i, items);
+    return;
+  }
+
+  // items of the promise fetched so far
+  const QVector<QPair<QString, QByteArray>> items = {{mime, payload}};
+
+  // add to history, the inserted front is of the promise
+  if (this->pushHistory(items, utility::functions::fingerprint(items))) {
+    this->m_history[0].promise = id;
+  }
+}
+
+/**
+ * @brief Fetcher of the clipboard that fetches the promised
+ * items when an application pastes them
+ */
+clipboard::LazyMimeData::Fetcher ClipBird::fetcherOf(quint64 id, const QVector<QPair<QString, quint64>> &promised) {
+  return [self = QPointer<ClipBird>(this), id, promised](const QString &mime, clipboard::LazyMimeData::Callback callback) {
+    for (const auto &[m, hash] : promised) {
+      if (self && m == mime) return self->fetchPayload(id, mime, hash, callback);
+    }
+
+    callback(QByteArray());
+  };
+}
+
+/**
+ * @brief Add the items as newest history entry unless the
+ * newest entry has the same fingerprint
+ *
+ * @return true if inserted
+ */
+bool ClipBird::pushHistory(const QVector<QPair<QString, QByteArray>> &data, quint64 print) {
+  // same content as the latest history is not added again
+  if (!m_history.isEmpty() && m_history.at(0).fingerprint == print) {
+    return false;
+  }
+
+  // evict the oldest when full
+  if (m_history.size() == m_history.capacity()) {
+    const auto evicted = this->m_history.takeAt(m_history.size() - 1);
+    this->m_historyResident -= payloadBytes(evicted.items);
+    this->removeStoredHistory(evicted.id);
+    emit OnHistoryItemRemoved(m_history.size());
+  }
+
+  // add as newest
+  this->insertHistory(0, data, print);
+
+  // inserted
+  return true;
+}
+
+/**
+ * @brief Add the items as history entry at the index, the
+ * caller makes sure the history is not full
+ */
+void ClipBird::insertHistory(qsizetype index, const QVector<QPair<QString, QByteArray>> &data, quint64 print) {
+  // persist to the store
+  std::optional<quint64> id;
+
+  try {
+    if (m_historyStore) id = m_historyStore->append(data);
+  } catch (const std::exception &e) {
+    qWarning() << (LOG(std::string("Failed to store history: ") + e.what()));
+  }
+
+  // kept in memory only
+  if (!id.has_value()) id = m_memoryHistoryId--;
+
+  // searchable even if not stored
+  this->indexHistory(*id, data);
+
+  // add at the index
+  this->m_history.insert(index, {*id, data, print, ++m_historyTick});
+  this->m_historyResident += payloadBytes(data);
+
+  // keep the history in the budget
+  this->spillHistory();
+
+  // emit the signal
+  emit OnHistoryItemInserted(index, data);
+}
+
+/**
+ * @brief Index where the entry of the peer goes by recency, right
+ * behind the nearest newer entry of the peer history known here,
+ * else right ahead of the nearest older one, else at the back, so
+ * an entry of the peer never goes ahead of a newer local entry
+ */
+qsizetype ClipBird::historyIndexOf(quint64 print, const QVector<quint64> &history) const {
+  // index of the local entries by fingerprint
+  QHash<quint64, qsizetype> local;
+
+  for (qsizetype i = 0; i < m_history.size(); ++i) {
+    local.insert(m_history.at(i).fingerprint, i);
+  }
+
+  // position of the entry in the peer history
+  const auto pos = history.indexOf(print);
+
+  // if unknown it is taken as the oldest
+  if (pos < 0) return m_history.size();
+
+  // right behind the nearest newer entry known here
+  for (auto i = pos - 1; i >= 0; --i) {
+    if (auto it = local.constFind(history.at(i)); it != local.cend()) return *it + 1;
+  }
+
+  // right ahead of the nearest older entry known here
+  for (auto i = pos + 1; i < history.size(); ++i) {
+    if (auto it = local.constFind(history.at(i)); it != local.cend()) return *it;
+  }
+
+  // nothing in common so older than the local entries
+  return m_history.size();
+}
+
+/**
+ * @brief Fingerprint of the known and promised items
+ */
+quint64 ClipBird::fingerprintOf(
+  const QVector<QPair<QString, QByteArray>> &items,
+  const QVector<QPair<QString, quint64>> &promised
+) {
+  // promised items are known by hash
+  auto hashes = promised;
+
+  // hash the known items
+  for (const auto &[mime, data] : items) {
+    hashes.append({mime, utility::functions::xxh3(data)});
+  }
+
+  // return the fingerprint
+  return utility::functions::fingerprint(hashes);
+}
+
+/**
+ * @brief Fingerprints of the history entries newest first
+ */
+QVector<quint64> ClipBird::historySummary() const {
+  // fingerprints of the entries
+  QVector<quint64> summary;
+  summary.reserve(m_history.size());
+
+  for (qsizetype i = 0; i < m_history.size(); ++i) {
+    summary.append(m_history.at(i).fingerprint);
+  }
+
+  // return the summary
+  return summary;
+}
+
+/**
+ * @brief Number of entries the history can take without evicting
+ */
+quint32 ClipBird::historyFree() const {
+  return quint32(m_history.capacity() - m_history.size());
+}
+
+/**
+ * @brief Newest history entries up to the free capacity of the
+ * peer that are not in its summary oldest first, entries with
+ * unfetched items are skipped
+ */
+QVector<QVector<QPair<QString, QByteArray>>> ClipBird::missingHistory(const QVector<quint64> &summary, quint32 free) {
+  // entries known to the peer
+  const QSet<quint64> known(summary.begin(), summary.end());
+
+  // missing entries newest first
+  QVector<QVector<QPair<QString, QByteArray>>> missing;
+
+  for (qsizetype i = 0; i < m_history.size() && missing.size() < qsizetype(free); ++i) {
+    const auto &entry = m_history.at(i);
+
+    // if known or not complete
+    if (known.contains(entry.fingerprint) || !entry.promised.isEmpty()) continue;
+
+    // spilled payloads are read for the peer but not kept
+    if (!entry.spilled) {
+      missing.append(entry.items); continue;
+    }
+
+    try {
+      missing.append(m_historyStore->items(entry.id));
+    } catch (const std::exception &e) {
+      qWarning() << (LOG(std::string("Failed to read history: ") + e.what()));
+    }
+  }
+
+  // the peer takes them oldest first
+  std::reverse(missing.begin(), missing.end());
+
+  // return the missing entries
+  return missing;
+}
+
+/**
+ * @brief Load the persisted history from the store
+ */
+void ClipBird::loadStoredHistory() {
+  // if the history is kept in memory only
+  if (!m_historyStore) return;
+
+  // ids of the entries newest first
+  const auto ids = m_historyStore->entries();
+  const auto threshold = constants::getAppHistorySpillThreshold();
+  QVector<storage::HistoryRing::Entry> loaded;
+
+  for (const auto id : ids) {
+    // entries beyond the capacity are dropped
+    if (loaded.size() >= m_history.capacity()) {
+      this->removeStoredHistory(id); continue;
+    }
+
+    // read the entry, large payloads stay in the store
+    try {
+      storage::HistoryRing::Entry entry{id, {}};
+      entry.items       = m_historyStore->items(id, threshold, &entry.spilled);
+      entry.fingerprint = utility::functions::fingerprint(m_historyStore->hashes(id));
+      this->m_historyResident += payloadBytes(entry.items);
+      this->indexHistory(id, entry.items);
+      loaded.prepend(std::move(entry));
+    } catch (const std::exception &e) {
+      qWarning() << (LOG(std::string("Failed to load history: ") + e.what()));
+    }
+  }
+
+  // oldest is pushed first
+  for (auto &entry : loaded) {
+    m_history.pushFront(std::move(entry));
+  }
+
+  // keep the history in the budget
+  this->spillHistory();
+}
+
+/**
+ * @brief Persist the changed history entry
+ */
+void ClipBird::updateStoredHistory(const storage::HistoryRing::Entry &entry) {
+  // searchable even if not stored
+  this->indexHistory(entry.id, entry.items);
+
+  // if the entry was never stored
+  if (!this->isStoredHistory(entry.id)) return;
+
+  // persist the entry
+  try {
+    m_historyStore->update(entry.id, entry.items);
+  } catch (const std::exception &e) {
+    qWarning() << (LOG(std::string("Failed to store history: ") + e.what()));
+  }
+}
+
+/**
+ * @brief Renew the store ids of the entries that are newer than
+ * an entry with larger id, the store loads them in id order
+ */
+void ClipBird::orderStoredHistory() {
+  // if the history is kept in memory only
+  if (!m_historyStore) return;
+
+  // id of the older stored entry
+  std::optional<quint64> older;
+
+  for (auto i = m_history.size() - 1; i >= 0; --i) {
+    auto &entry = m_history[i];
+
+    // if the entry was never stored
+    if (!this->isStoredHistory(entry.id)) continue;
+
+    // the newer entry gets a larger id
+    if (older.has_value() && entry.id < *older) {
+      try {
+        const auto id = m_historyStore->renew(entry.id);
+        m_searchIndex.remove(entry.id);
+        this->indexHistory(id, entry.spilled ? m_historyStore->items(id) : entry.items);
+        entry.id = id;
+      } catch (const std::exception &e) {
+        qWarning() << (LOG(std::string("Failed to order history: ") + e.what()));
+      }
+    }
+
+    // the next is newer
+    older = entry.id;
+  }
+}
+
+/**
+ * @brief Is the history entry kept in the store
+ */
+bool ClipBird::isStoredHistory(quint64 id) const {
+  return m_historyStore && id <= m_memoryHistoryId;
+}
+
+/**
+ * @brief Remove the history entry from the search index and
+ * the store
+ */
+void ClipBird::removeStoredHistory(quint64 id) {
+  // remove from the search index
+  m_searchIndex.remove(id);
+
+  // if the entry was never stored
+  if (!this->isStoredHistory(id)) return;
+
+  // remove the entry
+  try {
+    m_historyStore->remove(id);
+  } catch (const std::exception &e) {
+    qWarning() << (LOG(std::string("Failed to remove history: ") + e.what()));
+  }
+}
+
+/**
+ * @brief Index the searchable text of the history entry
+ */
+void ClipBird::indexHistory(quint64 id, const QVector<QPair<QString, QByteArray>> &items) {
+  m_searchIndex.insert(id, searchableText(items));
+}
+
+/**
+ * @brief Searchable text of the items
+ */
+QString ClipBird::searchableText(const QVector<QPair<QString, QByteArray>> &items) {
+  // text of the items
+  QStringList text;
+
+  for (const auto &[mime, data] : items) {
+    // plain text as is
+    if (mime == "text/plain") {
+      text.append(QString::fromUtf8(data));
+    }
+
+    // file names of the urls
+    if (mime == "text/uri-list") {
+      for (const auto &line : data.split('\n')) {
+        text.append(QUrl::fromEncoded(line.trimmed()).fileName());
+      }
+    }
+  }
+
+  // return the text
+  return text.join('\n');
+}
+
+/**
+ * @brief Bytes of the payloads of the items
+ */
+quint64 ClipBird::payloadBytes(const QVector<QPair<QString, QByteArray>> &items) {
+  quint64 bytes = 0;
+
+  for (const auto &[mime, data] : items) {
+    bytes += data.size();
+  }
+
+  return bytes;
+}
+
+/**
+ * @brief Spill the large payloads of the least recently used
+ * entries to the store until the history fits the budget
+ */
+void ClipBird::spillHistory() {
+  // payloads from this size are spilled
+  const auto threshold = constants::getAppHistorySpillThreshold();
+
+  // is the payload spillable
+  const auto isLarge = [=](const auto &item) {
+    return quint64(item.second.size()) >= threshold;
+  };
+
+  while (m_historyResident > m_historyBudget) {
+    // least recently used entry that has large payloads
+    qsizetype victim = -1;
+
+    for (qsizetype i = 0; i < m_history.size(); ++i) {
+      const auto &entry = m_history.at(i);
+
+      // unstored entry has no copy to page back from
+      if (!this->isStoredHistory(entry.id)) continue;
+
+      // if nothing to spill
+      if (std::none_of(entry.items.begin(), entry.items.end(), isLarge)) continue;
+
+      // older use
+      if (victim < 0 || entry.used < m_history.at(victim).used) victim = i;
+    }
+
+    // if nothing left to spill
+    if (victim < 0) break;
+
+    // drop the large payloads, the store has them
+    auto &entry = m_history[victim];
+
+    for (auto &item : entry.items) {
+      if (!isLarge(item)) continue;
+      m_historyResident -= item.second.size();
+      item.second = QByteArray();
+    }
+
+    entry.spilled = true;
+  }
+
+  // report the resident bytes
+  emit OnHistoryResidentBytesChanged(m_historyResident);
+}
+
+/**
+ * @brief Bring the spilled payloads of the entry back to memory
+ */
+QVector<QPair<QString, QByteArray>> ClipBird::pageInHistory(int index) {
+  // the entry
+  auto &entry = m_history[index];
+
+  // mark as recently used
+  entry.used = ++m_historyTick;
+
+  // if already in memory
+  if (!entry.spilled) return entry.items;
+
+  // read from the store
+  try {
+    auto items = m_historyStore->items(entry.id);
+    m_historyResident += payloadBytes(items) - payloadBytes(entry.items);
+    entry.items   = items;
+    entry.spilled = false;
+  } catch (const std::exception &e) {
+    qWarning() << (LOG(std::string("Failed to page in history: ") + e.what()));
+  }
+
+  // copy before the budget may spill it again
+  const auto items = entry.items;
+
+  // keep the history in the budget
+  this->spillHistory();
+
+  // return the items
+  return items;
 }
 
 /**
@@ -174,7 +879,32 @@ void ClipBird::setSslConfiguration(QSslConfiguration config) {
  * @param board  clipboard that is managed
  * @param parent parent object
  */
-ClipBird::ClipBird(QSslConfiguration config, QObject *parent) : QObject(parent), m_clipboard(this) {
+ClipBird::ClipBird(QSslConfiguration config, QObject *parent)
+    : QObject(parent),
+      m_clipboard(this),
+      m_history(storage::Storage::instance().getHistorySize()),
+      m_searchIndex(constants::getAppSearchTextLimit()),
+      m_historyBudget(storage::Storage::instance().getHistoryMemoryBudget()) {
+  // get the store instance
+  auto &store = storage::Storage::instance();
+
+  // open the persisted history, kept in memory only if it fails
+  try {
+    m_historyStore = std::make_unique<storage::HistoryStore>(
+      QString::fromStdString(constants::getAppHistoryDir()),
+      constants::getAppHistorySegmentSize()
+    );
+  } catch (const std::exception &e) {
+    qWarning() << (LOG(std::string("Failed to open history store: ") + e.what()));
+  }
+
+  // load the persisted history
+  this->loadStoredHistory();
+
+  // set the image codec
+  m_clipboard.setImageCodec(types::enums::ImageCodec(store.getImageCodec()));
+
+  // set the ssl configuration
   this->setSslConfiguration(config);
 }
 
@@ -191,6 +921,9 @@ void ClipBird::setCurrentHostAsServer() {
   // Set the QSslConfiguration
   server->setSslConfiguration(m_sslConfig);
 
+  // Set whether the large items are promised
+  server->setLazySync(storage::Storage::instance().getLazySync());
+
   // Connect the onClientStateChanged signal to the signal
   connect(
     server, &Server::OnCLientStateChanged,
@@ -225,6 +958,23 @@ void ClipBird::setCurrentHostAsServer() {
     &m_clipboard, &clipboard::ApplicationClipboard::set
   );
 
+  // Connect the OnPromiseRequest signal to the clipboard
+  connect(
+    server, &Server::OnPromiseRequest,
+    this, &ClipBird::handlePromiseRequest
+  );
+
+  // Connect the history catch-up signals
+  connect(
+    server, &Server::OnHistorySummary,
+    this, &ClipBird::handleHistorySummary
+  );
+
+  connect(
+    server, &Server::OnHistoryEntry,
+    this, &ClipBird::handleHistoryEntry
+  );
+
   // connect the OnClipboardChange signal to the server
   connect(
     &m_clipboard, &clipboard::ApplicationClipboard::OnClipboardChange,
@@ -266,6 +1016,9 @@ void ClipBird::setCurrentHostAsClient() {
   // Set the QSslConfiguration
   client->setSslConfiguration(m_sslConfig);
 
+  // Set whether the large items are promised
+  client->setLazySync(storage::Storage::instance().getLazySync());
+
   // Connect the onServerListChanged signal to the signal
   connect(
     client, &Client::OnServerListChanged,
@@ -316,18 +1069,44 @@ void ClipBird::setCurrentHostAsClient() {
     &m_clipboard, &clipboard::ApplicationClipboard::set
   );
 
+  // Connect the OnPromiseRequest signal to the clipboard
+  connect(
+    client, &Client::OnPromiseRequest,
+    this, &ClipBird::handlePromiseRequest
+  );
+
+  // Connect the history catch-up signals
+  connect(
+    client, &Client::OnHistorySummary,
+    this, [=](QVector<quint64> entries, quint32 free) { client->syncHistory(this->missingHistory(entries, free)); }
+  );
+
+  connect(
+    client, &Client::OnHistoryEntry,
+    this, &ClipBird::handleHistoryEntry
+  );
+
   // connect onConnectionError to the signal
   connect(
     client, &Client::OnConnectionError,
     this, &ClipBird::OnConnectionError
   );
 
+  // connect the discovered server if the last known is gone
+  connect(
+    client, &Client::OnCachedServerFailed,
+    this, &ClipBird::handleCachedServerFailed
+  );
+
   // get the storage instance
   auto &store = storage::Storage::instance();
 
   // set the host is client
   store.setHostIsServer(false);
 
+  // Dial the last known server alongside the discovery
+  this->connectToCachedServer();
+
   // Start the Discovery
   client->startBrowsing();
 
@@ -346,25 +1125,16 @@ void ClipBird::clearServerCertificates() {
   QList<QSslCertificate> caCerts;
 
   // set all ca Client certs from store
-  for (auto certByte : store.getAllClientCert()) {
-    caCerts.append(QSslCertificate(certByte, QSsl::Pem));
-  }
+  caCerts.append(store.getAllClientCert());
 
   // clear all ca Server certs from store
   store.clearAllServerCert();
 
   // set the ca certificates
-  this->m_sslConfig.setCaCertificates(caCerts);
-
-  // if the host is server then set the ssl configuration
-  if (std::holds_alternative<Server>(m_host)) {
-    std::get<Server>(m_host).setSslConfiguration(this->m_sslConfig);
-  }
+  this->setCaCertificates(caCerts);
 
-  // if the host is client then set the ssl configuration
-  if (std::holds_alternative<Client>(m_host)) {
-    std::get<Client>(m_host).setSslConfiguration(this->m_sslConfig);
-  }
+  // set new config for the host
+  this->applySslConfiguration();
 }
 
 /**
@@ -378,25 +1148,16 @@ void ClipBird::clearClientCertificates() {
   QList<QSslCertificate> caCerts;
 
   // set all ca Client certs from store
-  for (auto certByte : store.getAllServerCert()) {
-    caCerts.append(QSslCertificate(certByte, QSsl::Pem));
-  }
+  caCerts.append(store.getAllServerCert());
 
   // set the ca certificates
-  this->m_sslConfig.setCaCertificates(caCerts);
+  this->setCaCertificates(caCerts);
 
   // clear all ca Server certs from store
   store.clearAllClientCert();
 
-  // if the host is server then set the ssl configuration
-  if (std::holds_alternative<Server>(m_host)) {
-    std::get<Server>(m_host).setSslConfiguration(this->m_sslConfig);
-  }
-
-  // if the host is client then set the ssl configuration
-  if (std::holds_alternative<Client>(m_host)) {
-    std::get<Client>(m_host).setSslConfiguration(this->m_sslConfig);
-  }
+  // set new config for the host
+  this->applySslConfiguration();
 }
 
 //---------------------- Server functions -----------------------//
@@ -643,17 +1404,137 @@ void ClipBird::deleteHistoryAt(int index) {
   }
 
   // remove the history at the given index
-  m_history.remove(index);
+  const auto entry = m_history.takeAt(index);
+  this->m_historyResident -= payloadBytes(entry.items);
+  this->removeStoredHistory(entry.id);
 
   // emit the signal
-  emit OnHistoryChanged(m_history);
+  emit OnHistoryItemRemoved(index);
+}
+
+/**
+ * @brief Get the number of History entries
+ */
+int ClipBird::getHistoryCount() const {
+  return m_history.size();
+}
+
+/**
+ * @brief Get the History entry at the index without paging in,
+ * the spilled payloads are left empty and the hashes of all the
+ * payloads are given if asked so the ui can key its previews
+ */
+QVector<QPair<QString, QByteArray>> ClipBird::peekHistoryAt(
+  int index, QVector<QPair<QString, quint64>> *hashes
+) const {
+  // if the index is out of range then throw error
+  if (index < 0 || index >= m_history.size()) {
+    throw std::runtime_error("Index out of range");
+  }
+
+  // the entry
+  const auto &entry = m_history.at(index);
+
+  // the store knows the hashes without the payloads
+  if (hashes != nullptr && this->isStoredHistory(entry.id)) {
+    *hashes = m_historyStore->hashes(entry.id);
+  } else if (hashes != nullptr) {
+    for (const auto &[mime, data] : entry.items) {
+      hashes->append({mime, utility::functions::xxh3(data)});
+    }
+  }
+
+  // the items as they are in memory
+  return entry.items;
+}
+
+/**
+ * @brief Get the History entry at the index, the spilled
+ * payloads are paged in
+ */
+QVector<QPair<QString, QByteArray>> ClipBird::getHistoryAt(int index) {
+  // if the index is out of range then throw error
+  if (index < 0 || index >= m_history.size()) {
+    throw std::runtime_error("Index out of range");
+  }
+
+  // page in the entry
+  return this->pageInHistory(index);
+}
+
+/**
+ * @brief Set the clipboard to the History entry at the index,
+ * items that are not fetched yet are fetched on paste
+ */
+void ClipBird::setClipboardFromHistory(int index) {
+  // if the index is out of range then throw error
+  if (index < 0 || index >= m_history.size()) {
+    throw std::runtime_error("Index out of range");
+  }
+
+  // items of the entry
+  const auto items = this->pageInHistory(index);
+  const auto &entry = m_history.at(index);
+
+  // if all the items are known
+  if (entry.promised.isEmpty() || !entry.promise.has_value()) {
+    return m_clipboard.set(items);
+  }
+
+  // fetch the rest on paste
+  m_clipboard.setLazy(items, entry.promised, this->fetcherOf(*entry.promise, entry.promised));
 }
 
 /**
- * @brief Get the History of the clipboard
+ * @brief Set the bytes of history payloads kept in memory
  */
-QVector<QVector<QPair<QString, QByteArray>>> ClipBird::getHistory() const {
-  return m_history;
+void ClipBird::setHistoryMemoryBudget(quint64 budget) {
+  // store the budget
+  storage::Storage::instance().setHistoryMemoryBudget(budget);
+
+  // apply the budget
+  this->m_historyBudget = budget;
+  this->spillHistory();
+}
+
+/**
+ * @brief Get the bytes of history payloads kept in memory
+ */
+quint64 ClipBird::getHistoryMemoryBudget() const {
+  return m_historyBudget;
+}
+
+/**
+ * @brief Get the bytes of history payloads in memory now
+ */
+quint64 ClipBird::getHistoryResidentBytes() const {
+  return m_historyResident;
+}
+
+/**
+ * @brief Index of the history entries that contain the query
+ */
+QVector<int> ClipBird::searchHistory(const QString &query) const {
+  // position of the entries
+  QHash<quint64, int> positions;
+
+  for (int i = 0; i < m_history.size(); ++i) {
+    positions.insert(m_history.at(i).id, i);
+  }
+
+  // rows of the matched entries
+  QVector<int> result;
+
+  for (const auto id : m_searchIndex.search(query)) {
+    if (auto it = positions.constFind(id); it != positions.cend()) result.append(*it);
+  }
+
+  // newest first like the history, the ids of the entries kept
+  // in memory only count down so the key order is not the recency
+  std::sort(result.begin(), result.end());
+
+  // return the result
+  return result;
 }
 
 /**
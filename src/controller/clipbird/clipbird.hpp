@@ -1,21 +1,35 @@
 #pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
 
 // Qt headers
+#include <QHash>
 #include <QHostInfo>
 #include <QObject>
+#include <QPointer>
+#include <QSet>
 #include <QSslConfiguration>
 #include <QSslSocket>
+#include <QStringList>
+#include <QTimer>
+#include <QUrl>
 
 // C++ headers
+#include <algorithm>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <variant>
 
 // project headers
 #include "clipboard/applicationclipboard.hpp"
 #include "syncing/client/client.hpp"
 #include "syncing/server/server.hpp"
+#include "store/historyring/historyring.hpp"
+#include "store/historystore/historystore.hpp"
+#include "store/searchindex/searchindex.hpp"
 #include "store/storage.hpp"
 #include "types/device.hpp"
+#include "utility/functions/hash/hash.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::controller {
 class ClipBird : public QObject {
@@ -66,8 +80,20 @@ class ClipBird : public QObject {
   void OnSyncRequest(QVector<QPair<QString, QByteArray>> data);
 
   signals:  // signals for this class
-  /// @brief On History Changed
-  void OnHistoryChanged(QVector<QVector<QPair<QString, QByteArray>>>);
+  /// @brief On History Item Inserted at the index
+  void OnHistoryItemInserted(int index, QVector<QPair<QString, QByteArray>> items);
+
+  signals:  // signals for this class
+  /// @brief On History Item Removed at the index
+  void OnHistoryItemRemoved(int index);
+
+  signals:  // signals for this class
+  /// @brief On History Item Changed at the index
+  void OnHistoryItemChanged(int index, QVector<QPair<QString, QByteArray>> items);
+
+  signals:  // signals for this class
+  /// @brief On bytes of history payloads kept in memory changed
+  void OnHistoryResidentBytesChanged(quint64 bytes);
 
   signals:  // signals for this class
   /// @brief On Host Type Changed
@@ -86,8 +112,18 @@ class ClipBird : public QObject {
 
   std::variant<Server, Client> m_host;
   QSslConfiguration m_sslConfig;
+  QSet<QByteArray> m_caFingerprints;
   clipboard::ApplicationClipboard m_clipboard;
-  QVector<QVector<QPair<QString, QByteArray>>> m_history;
+  storage::HistoryRing m_history;
+  std::unique_ptr<storage::HistoryStore> m_historyStore;
+  storage::SearchIndex m_searchIndex;
+  quint64 m_historyBudget;
+  quint64 m_historyResident = 0;
+  quint64 m_historyTick     = 0;
+
+  /// @brief next id of the entries kept in memory only, it counts
+  /// down from the top so it never meets the ids of the store
+  quint64 m_memoryHistoryId = std::numeric_limits<quint64>::max();
 
  private:  // private slots
 
@@ -100,18 +136,165 @@ class ClipBird : public QObject {
   /// @brief Handle the Server Found (From client)
   void handleServerFound(types::Device server);
 
+  /// @brief Is the server pinned by its advertised certificate or name
+  bool isTrustedServer(const types::Device &server);
+
+  /// @brief Handle the last known server not reachable (From client)
+  void handleCachedServerFailed(types::Device server);
+
+  /// @brief Connect to the last known trusted server (To client)
+  void connectToCachedServer();
+
   /// @brief Handle the sync request (From server)
   void handleSyncRequest(QVector<QPair<QString, QByteArray>> data);
 
   /// @brief Handle the Auth Request (From Server)
   void handleAuthRequest(types::Device host);
 
+  /// @brief Handle the promise request
+  void handlePromiseRequest(quint64 id, QVector<QPair<QString, QByteArray>> items, QVector<QPair<QString, quint64>> promised);
+
+  /// @brief Handle the history summary of the client (From Server)
+  void handleHistorySummary(types::Device client, QVector<quint64> entries, quint32 free);
+
+  /// @brief Handle the history entry that is missing here
+  void handleHistoryEntry(quint64 id, QVector<QPair<QString, QByteArray>> items, QVector<QPair<QString, quint64>> promised, QVector<quint64> history);
+
  private: // private functions
 
   /**
-   * @brief Set the SSL Configuration object
+   * @brief Set the CA certificates without duplicates
    */
-  void setSslConfiguration(QSslConfiguration config);
+  void setCaCertificates(const QList<QSslCertificate> &certs);
+
+  /**
+   * @brief Add the CA certificate if not already added and
+   * apply the configuration to the host
+   */
+  void addCaCertificate(const QSslCertificate &cert);
+
+  /**
+   * @brief Apply the SSL Configuration to the host
+   */
+  void applySslConfiguration();
+
+  /**
+   * @brief Fetch the promised payload from the group without
+   * blocking, verify it with the promised hash and add it to
+   * the history, the callback gets the payload or empty
+   */
+  void fetchPayload(quint64 id, const QString &mime, quint64 hash, clipboard::LazyMimeData::Callback callback);
+
+  /**
+   * @brief Add the fetched payload to the history entry of the
+   * promise or as new entry if the entry is gone
+   */
+  void recordPayload(quint64 id, const QString &mime, const QByteArray &payload);
+
+  /**
+   * @brief Fetcher of the clipboard that fetches the promised
+   * items when an application pastes them
+   */
+  clipboard::LazyMimeData::Fetcher fetcherOf(quint64 id, const QVector<QPair<QString, quint64>> &promised);
+
+  /**
+   * @brief Add the items as newest history entry unless the
+   * newest entry has the same fingerprint
+   *
+   * @return true if inserted
+   */
+  bool pushHistory(const QVector<QPair<QString, QByteArray>> &items, quint64 print);
+
+  /**
+   * @brief Add the items as history entry at the index, the
+   * caller makes sure the history is not full
+   */
+  void insertHistory(qsizetype index, const QVector<QPair<QString, QByteArray>> &items, quint64 print);
+
+  /**
+   * @brief Index where the entry of the peer goes by recency, right
+   * behind the nearest newer entry of the peer history known here,
+   * else right ahead of the nearest older one, else at the back
+   */
+  qsizetype historyIndexOf(quint64 print, const QVector<quint64> &history) const;
+
+  /**
+   * @brief Fingerprint of the known and promised items
+   */
+  static quint64 fingerprintOf(
+    const QVector<QPair<QString, QByteArray>> &items,
+    const QVector<QPair<QString, quint64>> &promised
+  );
+
+  /**
+   * @brief Fingerprints of the history entries newest first
+   */
+  QVector<quint64> historySummary() const;
+
+  /**
+   * @brief Number of entries the history can take without evicting
+   */
+  quint32 historyFree() const;
+
+  /**
+   * @brief Newest history entries up to the free capacity of the
+   * peer that are not in its summary oldest first, entries with
+   * unfetched items are skipped
+   */
+  QVector<QVector<QPair<QString, QByteArray>>> missingHistory(const QVector<quint64> &summary, quint32 free);
+
+  /**
+   * @brief Load the persisted history from the store
+   */
+  void loadStoredHistory();
+
+  /**
+   * @brief Persist the changed history entry
+   */
+  void updateStoredHistory(const storage::HistoryRing::Entry &entry);
+
+  /**
+   * @brief Renew the store ids of the entries that are newer than
+   * an entry with larger id, the store loads them in id order
+   */
+  void orderStoredHistory();
+
+  /**
+   * @brief Is the history entry kept in the store
+   */
+  bool isStoredHistory(quint64 id) const;
+
+  /**
+   * @brief Remove the history entry from the search index and
+   * the store
+   */
+  void removeStoredHistory(quint64 id);
+
+  /**
+   * @brief Index the searchable text of the history entry
+   */
+  void indexHistory(quint64 id, const QVector<QPair<QString, QByteArray>> &items);
+
+  /**
+   * @brief Searchable text of the items
+   */
+  static QString searchableText(const QVector<QPair<QString, QByteArray>> &items);
+
+  /**
+   * @brief Bytes of the payloads of the items
+   */
+  static quint64 payloadBytes(const QVector<QPair<QString, QByteArray>> &items);
+
+  /**
+   * @brief Spill the large payloads of the least recently used
+   * entries to the store until the history fits the budget
+   */
+  void spillHistory();
+
+  /**
+   * @brief Bring the spilled payloads of the entry back to memory
+   */
+  QVector<QPair<QString, QByteArray>> pageInHistory(int index);
 
  public:  // Member functions
 
@@ -129,6 +312,12 @@ class ClipBird : public QObject {
    */
   virtual ~ClipBird() = default;
 
+  /**
+   * @brief Set the SSL Configuration object used by the
+   * host for the new connections
+   */
+  void setSslConfiguration(QSslConfiguration config);
+
   /**
    * @brief set the host as server and start listening
    * to accept the client
@@ -269,9 +458,50 @@ class ClipBird : public QObject {
   void deleteHistoryAt(int index);
 
   /**
-   * @brief Get the History of the clipboard
+   * @brief Get the number of History entries
+   */
+  int getHistoryCount() const;
+
+  /**
+   * @brief Get the History entry at the index without paging in,
+   * the spilled payloads are left empty and the hashes of all the
+   * payloads are given if asked so the ui can key its previews
+   */
+  QVector<QPair<QString, QByteArray>> peekHistoryAt(
+    int index, QVector<QPair<QString, quint64>> *hashes = nullptr
+  ) const;
+
+  /**
+   * @brief Get the History entry at the index, the spilled
+   * payloads are paged in
+   */
+  QVector<QPair<QString, QByteArray>> getHistoryAt(int index);
+
+  /**
+   * @brief Set the clipboard to the History entry at the index,
+   * items that are not fetched yet are fetched on paste
+   */
+  void setClipboardFromHistory(int index);
+
+  /**
+   * @brief Set the bytes of history payloads kept in memory
+   */
+  void setHistoryMemoryBudget(quint64 budget);
+
+  /**
+   * @brief Get the bytes of history payloads kept in memory
+   */
+  quint64 getHistoryMemoryBudget() const;
+
+  /**
+   * @brief Get the bytes of history payloads in memory now
+   */
+  quint64 getHistoryResidentBytes() const;
+
+  /**
+   * @brief Index of the history entries that contain the query
    */
-  QVector<QVector<QPair<QString, QByteArray>>> getHistory() const;
+  QVector<int> searchHistory(const QString &query) const;
 
   /**
    * @brief Get the Host Type
@@ -0,0 +1,108 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt headers
+#include <QByteArray>
+#include <QHostAddress>
+#include <QList>
+#include <QMap>
+#include <QString>
+
+namespace srilakshmikanthanp::clipbirdesk::network::service::mdns {
+/**
+ * @brief Receiver of the services found by the discovery backend
+ */
+class BrowseListener {
+ public:
+
+  /**
+   * @brief Destroy the Browse Listener object
+   */
+  virtual ~BrowseListener() = default;
+
+  /**
+   * @brief Called when the service and its addresses are resolved
+   *
+   * @param name service name
+   * @param port port in host order
+   * @param addresses all the addresses of the service
+   * @param txt TXT record of the service
+   */
+  virtual void onBackendResolved(
+    const QString& name, quint16 port, const QList<QHostAddress>& addresses,
+    const QMap<QString, QByteArray>& txt
+  ) = 0;
+
+  /**
+   * @brief Called when the service is gone
+   *
+   * @param name service name
+   */
+  virtual void onBackendRemoved(const QString& name) = 0;
+};
+
+/**
+ * @brief Receiver of the registration status from the discovery backend
+ */
+class RegisterListener {
+ public:
+
+  /**
+   * @brief Destroy the Register Listener object
+   */
+  virtual ~RegisterListener() = default;
+
+  /**
+   * @brief Called when the service is registered
+   *
+   * @param name registered name which may be renamed on conflict
+   */
+  virtual void onBackendRegistered(const QString& name) = 0;
+};
+
+/**
+ * @brief Discovery backend that the Browser and Register use instead
+ * of the DNS-SD daemon when injected, the listeners are called later
+ * from the event loop like the daemon callbacks
+ */
+class Backend {
+ public:
+
+  /**
+   * @brief Destroy the Backend object
+   */
+  virtual ~Backend() = default;
+
+  /**
+   * @brief Start reporting the services to the listener
+   */
+  virtual void startBrowsing(BrowseListener* listener) = 0;
+
+  /**
+   * @brief Stop reporting the services to the listener
+   */
+  virtual void stopBrowsing(BrowseListener* listener) = 0;
+
+  /**
+   * @brief Register the service of the listener
+   *
+   * @param listener owner of the service
+   * @param name service name
+   * @param port port in host order
+   * @param txt TXT record of the service
+   */
+  virtual void registerService(
+    RegisterListener* listener, const QString& name, quint16 port,
+    const QMap<QString, QByteArray>& txt
+  ) = 0;
+
+  /**
+   * @brief Replace the TXT record of the service of the listener
+   */
+  virtual void updateService(RegisterListener* listener, const QMap<QString, QByteArray>& txt) = 0;
+
+  /**
+   * @brief Unregister the service of the listener if any
+   */
+  virtual void unregisterService(RegisterListener* listener) = 0;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::network::service::mdns
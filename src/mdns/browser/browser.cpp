@@ -3,141 +3,357 @@
 #include "browser.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::network::service::mdns {
+/// @brief targets outlive the browser so a new client starts warm
+QHash<QString, Browser::Resolved> Browser::m_resolveCache;
+
 /**
- * @brief Callback for QHostInfo Address Resolve Function
+ * @brief Called when the service and its addresses are resolved
  *
- * @param isAdded
- * @param const QHostInfo& info
+ * @param target resolved target of the service
+ * @param srvName browsed service name
  */
-void Browser::onHostResolved(quint16 port, QString srvName, const QHostInfo& info) {
+void Browser::onHostResolved(const Resolved& target, QString srvName) {
   // check for error
-  if (info.error() != QHostInfo::NoError || info.addresses().isEmpty()) {
+  if (target.addresses.isEmpty()) {
     qWarning() << LOG("Unable to resolve service"); return;
   }
 
-  // remove the service type from service name
-  srvName.remove("." + QString::fromStdString(constants::getMDnsServiceType() + std::string(".local.")));
-
-  // Replace the \xxx ascii code to char
-  QRegularExpression regex("\\\\([0-9]{3})");
-  QString result;
-  QRegularExpressionMatchIterator it = regex.globalMatch(srvName);
-
-  int lastIndex                      = 0;
-  while (it.hasNext()) {
-    QRegularExpressionMatch match = it.next();
-    int start                     = match.capturedStart(0);
-    int end                       = match.capturedEnd(0);
-    QString str                   = match.captured(1);
-    bool ok;
-    ushort asciiCode = str.toUShort(&ok, 10);
-
-    if (ok) {
-      result    += srvName.mid(lastIndex, start - lastIndex);
-      result    += QChar(asciiCode);
-      lastIndex  = end;
-    }
+  if (srvName.isEmpty()) {
+    qWarning() << LOG("Service name is empty"); return;
   }
 
-  if (result.isEmpty()) {
-    qWarning() << LOG("Service name is empty after removing service type"); return;
-  }
+  // prefer IPv4 as the primary address
+  const auto isIPv4 = [](const QHostAddress& address) {
+    return address.protocol() == QAbstractSocket::IPv4Protocol;
+  };
 
-  if (serviceMap.contains(result)) {
-    qWarning() << LOG("Service already exists in the map, ignoring"); return;
+  // get the ip address
+  auto it = std::find_if(target.addresses.begin(), target.addresses.end(), isIPv4);
+  auto ip = it != target.addresses.end() ? *it : target.addresses.first();
+
+  // already reported on the same target
+  if (serviceMap.value(srvName) == qMakePair(ip, target.port)) {
+    return;
   }
 
-  // get the ip address
-  auto ip = info.addresses().first();
+  // the cached target has moved, report it gone first
+  if (auto old = serviceMap.find(srvName); old != serviceMap.end()) {
+    emit onServiceRemoved({old->first, old->second, srvName});
+  }
 
   // add to map
-  this->serviceMap[result] = {ip, port};
+  this->serviceMap[srvName] = {ip, target.port};
 
   // emit the signal
-  emit onServiceAdded({ip, port, result});
+  emit onServiceAdded({ip, target.port, srvName}, target.addresses, target.txt);
 }
 
 /**
- * @brief Callback function for DNSServiceBrowse function
+ * @brief Decode the TXT record to key value pairs
  */
-void Browser::browseCallback(
-    DNSServiceRef serviceRef,                        // DNSServiceRef
-    DNSServiceFlags flags,                           // DNSServiceFlags
+QMap<QString, QByteArray> Browser::decodeTxtRecord(uint16_t txtLen, const unsigned char* txtRecord) {
+  // key value pairs
+  QMap<QString, QByteArray> txt;
+
+  // for each item in the record
+  for (uint16_t i = 0; i < TXTRecordGetCount(txtLen, txtRecord); ++i) {
+    char key[256];
+    uint8_t valueLen   = 0;
+    const void* value  = nullptr;
+
+    // get the item
+    auto error = TXTRecordGetItemAtIndex(
+        txtLen, txtRecord, i, sizeof(key), key, &valueLen, &value
+    );
+
+    // skip malformed item
+    if (error != kDNSServiceErr_NoError) {
+      continue;
+    }
+
+    // add the item, keys without value are empty
+    txt.insert(
+      QString::fromUtf8(key),
+      QByteArray(static_cast<const char*>(value), value ? valueLen : 0)
+    );
+  }
+
+  // return the pairs
+  return txt;
+}
+
+/**
+ * @brief Resolve the service from the cache or start a resolve
+ * for it, resolves of different services run concurrently
+ */
+void Browser::resolveService(
     uint32_t interfaceIndex,                         // InterfaceIndex
-    DNSServiceErrorType errorCode,                   // DNSServiceErrorType
-    const char* serviceName,                         // serviceName
+    const QString& serviceName,                      // serviceName
     const char* regtype,                             // regtype
-    const char* domain,                              // domain
-    void* context                                    // context
+    const char* domain                               // domain
 ) {
-  // if the service name is same as our service name
-  if (constants::getMDnsServiceName() == std::string(serviceName)) {
-    return;
+  // report the cached target at once, it is verified below
+  if (auto cached = m_resolveCache.find(serviceName); cached != m_resolveCache.end()) {
+    if (!cached->expiry.hasExpired()) {
+      this->onHostResolved(*cached, serviceName);
+    } else {
+      m_resolveCache.erase(cached);
+    }
   }
 
-  // convert context to Register object
-  auto browserObj = static_cast<Browser*>(context);
-
-  // Avoid warning of unused variables
-  Q_UNUSED(interfaceIndex);
-  Q_UNUSED(domain);
-
-  // check for Error
-  if (errorCode != kDNSServiceErr_NoError) {
-    qWarning() << LOG("DNSServiceBrowse failed"); return;
+  // if already resolving on another interface
+  if (m_resolves.contains(serviceName)) {
+    return;
   }
 
-  // create context with service name and this
-  auto contextObj = new std::pair(new std::string(serviceName), browserObj);
-
-  // if removed
-  if (!(flags & kDNSServiceFlagsAdd)) {
-    return browserObj->removeCallback(QString(serviceName));
-  }
+  // context of the resolve
+  auto resolve = new Resolve{this, serviceName, interfaceIndex};
 
   // resolve the service
   auto errorType = DNSServiceResolve(
-      &browserObj->m_res_ref,                        // DNSServiceRef
+      &resolve->ref,                                 // DNSServiceRef
       0,                                             // DNSServiceFlags
       interfaceIndex,                                // InterfaceIndex
-      serviceName,                                   // serviceName
+      serviceName.toUtf8().constData(),              // serviceName
       regtype,                                       // regtype
       domain,                                        // domain
       addedCallback,                                 // callback
-      browserObj                                     // context
+      resolve                                        // context
   );
 
   // check for error
   if (errorType != kDNSServiceErr_NoError) {
-    qWarning() << LOG("DNSServiceResolve failed"); return;
+    qWarning() << LOG("DNSServiceResolve failed"); delete resolve; return;
   }
 
+  // process the resolve socket
+  this->watchResolve(resolve);
+
+  // give up if the service never answers
+  resolve->timeout = new QTimer(this);
+  resolve->timeout->setSingleShot(true);
+
+  // connect the timeout to slot
+  connect(resolve->timeout, &QTimer::timeout, this, [this, serviceName] {
+    this->timeoutResolve(serviceName);
+  });
+
+  // start the timeout
+  resolve->timeout->start(constants::getMDnsResolveTimeout());
+
+  // track the resolve
+  m_resolves.insert(serviceName, resolve);
+}
+
+/**
+ * @brief Watch the socket of the current service ref of the resolve
+ */
+void Browser::watchResolve(Resolve* resolve) {
   // set as non blocking
 #ifdef __linux__
-  utility::functions::platform::setSocketNonBlocking(DNSServiceRefSockFD(browserObj->m_res_ref));
+  utility::functions::platform::setSocketNonBlocking(DNSServiceRefSockFD(resolve->ref));
 #endif
 
   // create socket notifier
-  browserObj->m_res_notify = new QSocketNotifier(
-      DNSServiceRefSockFD(browserObj->m_res_ref),    // socket
+  resolve->notify = new QSocketNotifier(
+      DNSServiceRefSockFD(resolve->ref),             // socket
       QSocketNotifier::Read,                         // type
-      browserObj                                     // parent
+      this                                           // parent
   );
 
   // process resolve socket
-  const auto processResSock = [=] {
-    if (DNSServiceProcessResult(browserObj->m_res_ref) != kDNSServiceErr_NoError) {
+  const auto processResSock = [resolve] {
+    if (DNSServiceProcessResult(resolve->ref) != kDNSServiceErr_NoError) {
       // No action needed, even logging cause huge log spam
     }
   };
 
   // connect the socket notifier to slot
   connect(
-    browserObj->m_res_notify,  &QSocketNotifier::activated,
+    resolve->notify, &QSocketNotifier::activated,
     processResSock
   );
 }
 
+/**
+ * @brief Deallocate the current service ref of the resolve
+ */
+void Browser::releaseResolve(Resolve* resolve) {
+  // if nothing is in flight
+  if (resolve->ref == nullptr) {
+    return;
+  }
+
+  // stop the socket notifier
+  resolve->notify->setEnabled(false);
+
+  // stop the service
+  DNSServiceRefDeallocate(resolve->ref);
+
+  // delete the notifier
+  delete resolve->notify;
+
+  // set to nullptr
+  resolve->ref    = nullptr;
+  resolve->notify = nullptr;
+}
+
+/**
+ * @brief Resolve the addresses of the resolved host target
+ */
+void Browser::resolveAddress(const QString& serviceName) {
+  // find the resolve
+  auto resolve = m_resolves.value(serviceName);
+
+  // if not found
+  if (resolve == nullptr) {
+    return;
+  }
+
+  // SRV and TXT are done
+  this->releaseResolve(resolve);
+
+  // restart the timeout for the addresses
+  resolve->timeout->start(constants::getMDnsResolveTimeout());
+
+#ifdef __linux__
+  // avahi compat has no DNSServiceGetAddrInfo, nss-mdns answers
+  // the .local names through the system resolver
+  auto callback = [this, serviceName](const QHostInfo& info) {
+    if (auto pending = m_resolves.value(serviceName); pending != nullptr) {
+      pending->target.addresses = info.addresses();
+      this->deliverResolve(serviceName);
+    }
+  };
+
+  // Resolve the ip address from hostname
+  QHostInfo::lookupHost(resolve->target.host, this, callback);
+#else
+  // resolve the A and AAAA records through the daemon
+  auto errorType = DNSServiceGetAddrInfo(
+      &resolve->ref,                                 // DNSServiceRef
+      0,                                             // DNSServiceFlags
+      resolve->interfaceIndex,                       // InterfaceIndex
+      kDNSServiceProtocol_IPv4 | kDNSServiceProtocol_IPv6,  // protocol
+      resolve->target.host.toUtf8().constData(),     // hostname
+      addressCallback,                               // callback
+      resolve                                        // context
+  );
+
+  // check for error
+  if (errorType != kDNSServiceErr_NoError) {
+    qWarning() << LOG("DNSServiceGetAddrInfo failed"); return this->finishResolve(serviceName);
+  }
+
+  // process the address socket
+  this->watchResolve(resolve);
+#endif
+}
+
+/**
+ * @brief Cache and report the resolved service then
+ * deallocate the resolve
+ */
+void Browser::deliverResolve(const QString& serviceName) {
+  // find the resolve
+  auto resolve = m_resolves.value(serviceName);
+
+  // if not found
+  if (resolve == nullptr) {
+    return;
+  }
+
+  // the resolved target
+  auto target = resolve->target;
+
+  // deallocate the resolve
+  this->finishResolve(serviceName);
+
+  // if no address is found
+  if (target.addresses.isEmpty()) {
+    qWarning() << LOG("Unable to resolve service address"); return;
+  }
+
+  // cache the target
+  m_resolveCache.insert(serviceName, target);
+
+  // report the service
+  this->onHostResolved(target, serviceName);
+}
+
+/**
+ * @brief Deliver what is resolved so far or give up
+ */
+void Browser::timeoutResolve(const QString& serviceName) {
+  // find the resolve
+  auto resolve = m_resolves.value(serviceName);
+
+  // if some addresses are found
+  if (resolve != nullptr && !resolve->target.addresses.isEmpty()) {
+    return this->deliverResolve(serviceName);
+  }
+
+  // give up
+  this->finishResolve(serviceName);
+}
+
+/**
+ * @brief Deallocate the resolve of the service if any
+ */
+void Browser::finishResolve(const QString& serviceName) {
+  // take the resolve
+  auto resolve = m_resolves.take(serviceName);
+
+  // if not found
+  if (resolve == nullptr) {
+    return;
+  }
+
+  // stop the service
+  this->releaseResolve(resolve);
+
+  // delete the timer
+  delete resolve->timeout;
+
+  // delete the context
+  delete resolve;
+}
+
+/**
+ * @brief Callback function for DNSServiceBrowse function
+ */
+void Browser::browseCallback(
+    DNSServiceRef serviceRef,                        // DNSServiceRef
+    DNSServiceFlags flags,                           // DNSServiceFlags
+    uint32_t interfaceIndex,                         // InterfaceIndex
+    DNSServiceErrorType errorCode,                   // DNSServiceErrorType
+    const char* serviceName,                         // serviceName
+    const char* regtype,                             // regtype
+    const char* domain,                              // domain
+    void* context                                    // context
+) {
+  // if the service name is same as our service name
+  if (constants::getMDnsServiceName() == std::string(serviceName)) {
+    return;
+  }
+
+  // convert context to Register object
+  auto browserObj = static_cast<Browser*>(context);
+
+  // check for Error
+  if (errorCode != kDNSServiceErr_NoError) {
+    qWarning() << LOG("DNSServiceBrowse failed"); return;
+  }
+
+  // if removed
+  if (!(flags & kDNSServiceFlagsAdd)) {
+    return browserObj->removeCallback(QString::fromUtf8(serviceName));
+  }
+
+  // resolve the service
+  browserObj->resolveService(interfaceIndex, QString::fromUtf8(serviceName), regtype, domain);
+}
+
 /**
  * @brief Callback function for DNSServiceResolve function
  */
@@ -153,38 +369,123 @@ void Browser::addedCallback(
     const unsigned char* txtRecord,                  // txtRecord
     void* context                                    // context
 ) {
-  // convert context to Register object
-  auto browserObj = static_cast<Browser*>(context);
+  // convert context to Resolve object
+  auto resolve     = static_cast<Resolve*>(context);
+  auto browserObj  = resolve->browser;
+  auto serviceName = resolve->serviceName;
 
   // Avoid warning of unused variables
   Q_UNUSED(interfaceIndex);
-  Q_UNUSED(txtLen);
-  Q_UNUSED(txtRecord);
+  Q_UNUSED(fullname);
+
+  // the SRV is done, move on outside the callback
+  resolve->notify->setEnabled(false);
+
+  // check for Error
+  if (errorCode != kDNSServiceErr_NoError) {
+    qWarning() << LOG("DNSServiceResolve failed");
+    return (void) QMetaObject::invokeMethod(browserObj, [=] {
+      browserObj->finishResolve(serviceName);
+    }, Qt::QueuedConnection);
+  }
+
+  // the resolved target
+  resolve->target.host = QString::fromUtf8(hosttarget);
+  resolve->target.port = ntohs(port);
+  resolve->target.txt  = decodeTxtRecord(txtLen, txtRecord);
+
+  // the SRV record TTL is not reported
+  resolve->target.expiry = QDeadlineTimer(constants::getMDnsResolveCacheTTL());
+
+  // resolve the addresses of the host
+  QMetaObject::invokeMethod(browserObj, [=] {
+    browserObj->resolveAddress(serviceName);
+  }, Qt::QueuedConnection);
+}
+
+#ifndef __linux__
+/**
+ * @brief Callback function for DNSServiceGetAddrInfo function
+ */
+void Browser::addressCallback(
+    DNSServiceRef serviceRef,                        // DNSServiceRef
+    DNSServiceFlags flags,                           // DNSServiceFlags
+    uint32_t interfaceIndex,                         // InterfaceIndex
+    DNSServiceErrorType errorCode,                   // DNSServiceErrorType
+    const char* hostname,                            // hostname
+    const struct sockaddr* address,                  // address
+    uint32_t ttl,                                    // ttl
+    void* context                                    // context
+) {
+  // convert context to Resolve object
+  auto resolve     = static_cast<Resolve*>(context);
+  auto browserObj  = resolve->browser;
+  auto serviceName = resolve->serviceName;
+  auto& target     = resolve->target;
 
-  // service name
-  auto serviceName = QString::fromUtf8(fullname);
+  // Avoid warning of unused variables
+  Q_UNUSED(interfaceIndex);
+  Q_UNUSED(hostname);
 
   // check for Error
   if (errorCode != kDNSServiceErr_NoError) {
-    qWarning() << LOG("DNSServiceResolve failed"); return;
+    qWarning() << LOG("DNSServiceGetAddrInfo failed"); return;
   }
 
-  // service name
-  auto hostname   = QString::fromUtf8(hosttarget);
+  // add the new address
+  if ((flags & kDNSServiceFlagsAdd) && address != nullptr) {
+    auto ip = QHostAddress(address);
+
+    // the records expire with the shortest TTL
+    auto expiry = QDeadlineTimer(std::chrono::seconds(ttl));
+
+    // keep the earliest expiry
+    if (expiry < target.expiry) {
+      target.expiry = expiry;
+    }
+
+    // add the address
+    if (!ip.isNull() && !target.addresses.contains(ip)) {
+      target.addresses.append(ip);
+    }
+  }
+
+  // wait for the rest of the batch
+  if (flags & kDNSServiceFlagsMoreComing) {
+    return;
+  }
 
-  // bind the iAdded and port
-  auto callback = [=](const QHostInfo& hostInfo) {
-    browserObj->onHostResolved(ntohs(port), serviceName, hostInfo);
+  // is the address family found
+  const auto has = [&](QAbstractSocket::NetworkLayerProtocol protocol) {
+    return std::any_of(target.addresses.begin(), target.addresses.end(), [=](auto& ip) {
+      return ip.protocol() == protocol;
+    });
   };
 
-  // Resolve the ip address from hostname
-  QHostInfo::lookupHost(hostname, callback);
+  // wait a moment for the other family that arrives in another batch
+  if (!(has(QAbstractSocket::IPv4Protocol) && has(QAbstractSocket::IPv6Protocol))) {
+    return resolve->timeout->start(constants::getMDnsAddressGraceTime());
+  }
+
+  // all done, deliver outside the callback
+  resolve->notify->setEnabled(false);
+  resolve->timeout->stop();
+
+  // deliver the service
+  QMetaObject::invokeMethod(browserObj, [=] {
+    browserObj->deliverResolve(serviceName);
+  }, Qt::QueuedConnection);
 }
+#endif
 
 /**
  * @brief Callback function for DNSServiceResolve function
  */
 void Browser::removeCallback(QString serviceName) {
+  // stop resolving it, the target stays cached as the service may
+  // come back on it and a moved target is caught on the next resolve
+  this->finishResolve(serviceName);
+
   // remove the service name from service map
   auto service = this->serviceMap.find(serviceName);
   auto device = types::Device();
@@ -206,6 +507,31 @@ void Browser::removeCallback(QString serviceName) {
   this->serviceMap.erase(service);
 }
 
+/**
+ * @brief Called when the backend resolved the service
+ */
+void Browser::onBackendResolved(
+    const QString& name, quint16 port, const QList<QHostAddress>& addresses,
+    const QMap<QString, QByteArray>& txt
+) {
+  // the resolved target
+  auto target      = Resolved();
+  target.host      = name;
+  target.port      = port;
+  target.txt       = txt;
+  target.addresses = addresses;
+
+  // report the service
+  this->onHostResolved(target, name);
+}
+
+/**
+ * @brief Called when the backend lost the service
+ */
+void Browser::onBackendRemoved(const QString& name) {
+  this->removeCallback(name);
+}
+
 /**
  * @brief Construct a new Discovery Browser object
  *
@@ -215,6 +541,16 @@ Browser::Browser(QObject* parent) : QObject(parent) {
   // Empty Constructor just calls the parent constructor
 }
 
+/**
+ * @brief Use the backend instead of the DNS-SD daemon, should be
+ * set before browsing and outlive the browser, nullptr for daemon
+ *
+ * @param backend discovery backend
+ */
+void Browser::setBackend(Backend* backend) {
+  this->m_backend = backend;
+}
+
 /**
  * @brief Starts the discovery client by sending the
  * broadcast message
@@ -222,6 +558,11 @@ Browser::Browser(QObject* parent) : QObject(parent) {
  * @param interval Interval between each broadcast
  */
 void Browser::startBrowsing() {
+  // if the backend is injected
+  if (this->m_backend != nullptr) {
+    return this->m_backend->startBrowsing(this);
+  }
+
   // Start to browse for the service
   auto errorType = DNSServiceBrowse(
       &this->m_browse_ref,                           // DNSServiceRef
@@ -286,11 +627,21 @@ void Browser::stopBrowsing() {
     notifier = nullptr;
   };
 
-  // delete the service ref & socket notifier for resolve
-  deleter(this->m_res_ref, this->m_res_notify);
+  // stop the injected backend if any
+  if (this->m_backend != nullptr) {
+    this->m_backend->stopBrowsing(this);
+  }
+
+  // delete the service ref & socket notifier for resolves
+  for (const auto& serviceName : this->m_resolves.keys()) {
+    this->finishResolve(serviceName);
+  }
 
   // delete the service ref & socket notifier for browse
   deleter(this->m_browse_ref, this->m_browse_notify);
+
+  // services are reported again on the next browse
+  this->serviceMap.clear();
 }
 
 /**
@@ -3,12 +3,16 @@
 
 // C++ headers
 #include <algorithm>
+#include <chrono>
 #include <vector>
 
 // Qt headers
 #include <QByteArray>
+#include <QDeadlineTimer>
+#include <QHash>
 #include <QHostAddress>
 #include <QHostInfo>
+#include <QMap>
 #include <QObject>
 #include <QRegularExpression>
 #include <QSocketNotifier>
@@ -28,6 +32,7 @@
 
 // Local headers
 #include "constants/constants.hpp"
+#include "mdns/backend/backend.hpp"
 #include "types/enums/enums.hpp"
 #include "types/device.hpp"
 #include "utility/functions/ipconv/ipconv.hpp"
@@ -41,17 +46,47 @@ namespace srilakshmikanthanp::clipbirdesk::network::service::mdns {
  * to the server and listen for the response if any server
  * is found then the callback function is called
  */
-class Browser : public QObject {
+class Browser : public QObject, private BrowseListener {
+ private:  // private types
+
+  /**
+   * @brief Resolved target of a service that is reused till
+   * the records expire
+   */
+  struct Resolved {
+    QString host;                        ///< Host target
+    quint16 port = 0;                    ///< Port in host order
+    QMap<QString, QByteArray> txt;       ///< TXT record of the service
+    QList<QHostAddress> addresses;       ///< A and AAAA of the host
+    QDeadlineTimer expiry;               ///< Expiry of the records
+  };
+
+  /**
+   * @brief In-flight resolve of a single service, first the SRV and
+   * TXT then the addresses of the host, used as the context of the
+   * callbacks
+   */
+  struct Resolve {
+    Browser* browser         = nullptr;  ///< Owner of the resolve
+    QString serviceName;                 ///< Browsed service name
+    uint32_t interfaceIndex  = 0;        ///< Interface of the service
+    DNSServiceRef ref        = nullptr;  ///< Service ref
+    QSocketNotifier* notify  = nullptr;  ///< Socket notifier
+    QTimer* timeout          = nullptr;  ///< Resolve timeout
+    Resolved target;                     ///< Resolved so far
+  };
+
  private:  // private variables
 
   QSocketNotifier* m_browse_notify = nullptr;  ///< Socket notifier
   DNSServiceRef m_browse_ref       = nullptr;  ///< Service ref
-  QSocketNotifier* m_res_notify    = nullptr;  ///< Socket notifier
-  DNSServiceRef m_res_ref          = nullptr;  ///< Service ref
+  Backend* m_backend               = nullptr;  ///< Injected backend
 
  private:  // private variables
 
   QMap<QString, QPair<QHostAddress, quint16>> serviceMap;
+  QHash<QString, Resolve*> m_resolves;         ///< Resolves by service name
+  static QHash<QString, Resolved> m_resolveCache;  ///< Targets by service name shared by the browsers
 
  private:  // Just for Qt
 
@@ -64,12 +99,60 @@ class Browser : public QObject {
  private:  // private functions
 
   /**
-   * @brief Callback for QHostInfo Address Resolve Function
+   * @brief Called when the service and its addresses are resolved
    *
-   * @param isAdded
-   * @param const QHostInfo& info
+   * @param target resolved target of the service
+   * @param srvName browsed service name
+   */
+  void onHostResolved(const Resolved& target, QString srvName);
+
+  /**
+   * @brief Decode the TXT record to key value pairs
+   */
+  static QMap<QString, QByteArray> decodeTxtRecord(uint16_t txtLen, const unsigned char* txtRecord);
+
+  /**
+   * @brief Report the service from the cache and resolve it again
+   * to catch a moved target, resolves of different services run
+   * concurrently
+   */
+  void resolveService(
+      uint32_t interfaceIndex,        // InterfaceIndex
+      const QString& serviceName,     // serviceName
+      const char* regtype,            // regtype
+      const char* domain              // domain
+  );
+
+  /**
+   * @brief Watch the socket of the current service ref of the resolve
+   */
+  void watchResolve(Resolve* resolve);
+
+  /**
+   * @brief Deallocate the current service ref of the resolve
+   */
+  void releaseResolve(Resolve* resolve);
+
+  /**
+   * @brief Resolve the addresses of the resolved host target
+   */
+  void resolveAddress(const QString& serviceName);
+
+  /**
+   * @brief Cache and report the resolved service then
+   * deallocate the resolve
+   */
+  void deliverResolve(const QString& serviceName);
+
+  /**
+   * @brief Deliver what is resolved so far or give up
+   */
+  void timeoutResolve(const QString& serviceName);
+
+  /**
+   * @brief Deallocate the resolve of the service if any
    */
-  void onHostResolved(quint16 port, QString srvName, const QHostInfo& info);
+  void finishResolve(const QString& serviceName);
 
   /**
    * @brief Callback function for DNSServiceBrowse function
@@ -102,12 +185,43 @@ class Browser : public QObject {
       void* context                    // context
   );
 
+#ifndef __linux__
+  /**
+   * @brief Callback function for DNSServiceGetAddrInfo function
+   */
+  static void addressCallback(
+      DNSServiceRef serviceRef,        // DNSServiceRef
+      DNSServiceFlags flags,           // DNSServiceFlags
+      uint32_t interfaceIndex,         // InterfaceIndex
+      DNSServiceErrorType errorCode,   // DNSServiceErrorType
+      const char* hostname,            // hostname
+      const struct sockaddr* address,  // address
+      uint32_t ttl,                    // ttl
+      void* context                    // context
+  );
+#endif
+
   /**
    * @brief Callback function for DNSServiceResolve function
    * that service Removed
    */
   void removeCallback(QString serviceName);
 
+ private:  // backend listener
+
+  /**
+   * @brief Called when the backend resolved the service
+   */
+  void onBackendResolved(
+    const QString& name, quint16 port, const QList<QHostAddress>& addresses,
+    const QMap<QString, QByteArray>& txt
+  ) override;
+
+  /**
+   * @brief Called when the backend lost the service
+   */
+  void onBackendRemoved(const QString& name) override;
+
  public:
 
   /**
@@ -122,6 +236,12 @@ class Browser : public QObject {
    */
   virtual ~Browser();
 
+  /**
+   * @brief Use the backend instead of the DNS-SD daemon, should be
+   * set before browsing and outlive the browser, nullptr for daemon
+   */
+  void setBackend(Backend* backend);
+
   /**
    * @brief Starts the mDNS Browsing
    */
@@ -140,8 +260,10 @@ class Browser : public QObject {
    *
    * @param host Host address
    * @param port Port number
+   * @param addresses All the addresses of the server
+   * @param txt  TXT record of the service
    */
-  virtual void onServiceAdded(types::Device)   = 0;
+  virtual void onServiceAdded(types::Device, QList<QHostAddress> addresses, QMap<QString, QByteArray> txt) = 0;
 
   /**
    * @brief On Server Removed abstract function that
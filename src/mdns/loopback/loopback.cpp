@@ -0,0 +1,159 @@
+#include "loopback.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::service::mdns {
+/**
+ * @brief Find the service by the name
+ */
+QList<LoopbackBackend::Service>::iterator LoopbackBackend::findService(const QString& name) {
+  return std::find_if(m_services.begin(), m_services.end(), [&](const Service& service) {
+    return service.name == name;
+  });
+}
+
+/**
+ * @brief Find the service by the owner
+ */
+QList<LoopbackBackend::Service>::iterator LoopbackBackend::findService(RegisterListener* owner) {
+  return std::find_if(m_services.begin(), m_services.end(), [&](const Service& service) {
+    return service.owner == owner;
+  });
+}
+
+/**
+ * @brief Unique name for the service, "name (2)" and so on
+ * like the daemon renames on conflict
+ */
+QString LoopbackBackend::uniqueName(const QString& name) const {
+  // is the name taken
+  const auto isTaken = [this](const QString& candidate) {
+    return std::any_of(m_services.begin(), m_services.end(), [&](const Service& service) {
+      return service.name == candidate;
+    });
+  };
+
+  // first free name
+  auto candidate = name;
+  for (int i = 2; isTaken(candidate); ++i) {
+    candidate = QString("%1 (%2)").arg(name).arg(i);
+  }
+
+  // return the name
+  return candidate;
+}
+
+/**
+ * @brief Report the service to the browser if both still exist
+ */
+void LoopbackBackend::reportService(BrowseListener* listener, const QString& name) {
+  // find the service
+  auto service = this->findService(name);
+
+  // if gone meanwhile
+  if (service == m_services.end() || !m_browsers.contains(listener)) {
+    return;
+  }
+
+  // report the service
+  listener->onBackendResolved(service->name, service->port, m_addresses, service->txt);
+}
+
+/**
+ * @brief Construct a new Loopback Backend object
+ *
+ * @param addresses addresses reported for the services
+ * @param parent Parent object
+ */
+LoopbackBackend::LoopbackBackend(QList<QHostAddress> addresses, QObject* parent)
+    : QObject(parent), m_addresses(addresses) {
+  // Empty Constructor just calls the parent constructor
+}
+
+/**
+ * @brief Start reporting the services to the listener
+ */
+void LoopbackBackend::startBrowsing(BrowseListener* listener) {
+  // if already browsing
+  if (m_browsers.contains(listener)) {
+    return;
+  }
+
+  // track the browser
+  m_browsers.append(listener);
+
+  // report the services registered so far
+  for (const auto& service : std::as_const(m_services)) {
+    QTimer::singleShot(0, this, [this, listener, name = service.name] {
+      this->reportService(listener, name);
+    });
+  }
+}
+
+/**
+ * @brief Stop reporting the services to the listener
+ */
+void LoopbackBackend::stopBrowsing(BrowseListener* listener) {
+  m_browsers.removeAll(listener);
+}
+
+/**
+ * @brief Register the service of the listener
+ */
+void LoopbackBackend::registerService(
+  RegisterListener* listener, const QString& name, quint16 port,
+  const QMap<QString, QByteArray>& txt
+) {
+  // a listener owns one service
+  this->unregisterService(listener);
+
+  // register with a unique name
+  const auto unique = this->uniqueName(name);
+  m_services.append({listener, unique, port, txt});
+
+  // registered
+  QTimer::singleShot(0, this, [this, listener, unique] {
+    if (auto service = this->findService(unique); service != m_services.end() && service->owner == listener) {
+      listener->onBackendRegistered(unique);
+    }
+  });
+
+  // report to the browsers
+  for (auto browser : std::as_const(m_browsers)) {
+    QTimer::singleShot(0, this, [this, browser, unique] {
+      this->reportService(browser, unique);
+    });
+  }
+}
+
+/**
+ * @brief Replace the TXT record of the service of the listener
+ */
+void LoopbackBackend::updateService(RegisterListener* listener, const QMap<QString, QByteArray>& txt) {
+  if (auto service = this->findService(listener); service != m_services.end()) {
+    service->txt = txt;
+  }
+}
+
+/**
+ * @brief Unregister the service of the listener if any
+ */
+void LoopbackBackend::unregisterService(RegisterListener* listener) {
+  // find the service
+  auto service = this->findService(listener);
+
+  // if not registered
+  if (service == m_services.end()) {
+    return;
+  }
+
+  // forget the service
+  const auto name = service->name;
+  m_services.erase(service);
+
+  // the browsers see the goodbye
+  for (auto browser : std::as_const(m_browsers)) {
+    QTimer::singleShot(0, this, [this, browser, name] {
+      if (m_browsers.contains(browser)) browser->onBackendRemoved(name);
+    });
+  }
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::network::service::mdns
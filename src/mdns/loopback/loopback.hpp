@@ -0,0 +1,116 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// C++ headers
+#include <algorithm>
+
+// Qt headers
+#include <QByteArray>
+#include <QHostAddress>
+#include <QList>
+#include <QMap>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+// Local headers
+#include "mdns/backend/backend.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::service::mdns {
+/**
+ * @brief In process discovery backend that reports the services
+ * registered on it to the browsers on it with loopback addresses,
+ * used to run many servers and clients in one process without a
+ * DNS-SD daemon, every service is reported including the ones of
+ * the same host and the conflicting names are renamed like the
+ * daemon does
+ */
+class LoopbackBackend : public QObject, public Backend {
+ private:  // private types
+
+  /// @brief registered service
+  struct Service {
+    RegisterListener* owner;             ///< Owner of the service
+    QString name;                        ///< Unique service name
+    quint16 port;                        ///< Port in host order
+    QMap<QString, QByteArray> txt;       ///< TXT record
+  };
+
+ private:  // private variables
+
+  QList<QHostAddress> m_addresses;       ///< Addresses of the services
+  QList<Service> m_services;             ///< Registered services
+  QList<BrowseListener*> m_browsers;     ///< Browsing listeners
+
+ private:  // disable copy and move
+
+  Q_DISABLE_COPY_MOVE(LoopbackBackend)
+
+ private:  // private functions
+
+  /**
+   * @brief Find the service by the name
+   */
+  QList<Service>::iterator findService(const QString& name);
+
+  /**
+   * @brief Find the service by the owner
+   */
+  QList<Service>::iterator findService(RegisterListener* owner);
+
+  /**
+   * @brief Unique name for the service
+   */
+  QString uniqueName(const QString& name) const;
+
+  /**
+   * @brief Report the service to the browser if both still exist
+   */
+  void reportService(BrowseListener* listener, const QString& name);
+
+ public:  // public functions
+
+  /**
+   * @brief Construct a new Loopback Backend object
+   *
+   * @param addresses addresses reported for the services
+   * @param parent Parent object
+   */
+  explicit LoopbackBackend(
+    QList<QHostAddress> addresses = {QHostAddress(QHostAddress::LocalHost)},
+    QObject* parent = nullptr
+  );
+
+  /**
+   * @brief Destroy the Loopback Backend object
+   */
+  ~LoopbackBackend() override = default;
+
+  /**
+   * @brief Start reporting the services to the listener
+   */
+  void startBrowsing(BrowseListener* listener) override;
+
+  /**
+   * @brief Stop reporting the services to the listener
+   */
+  void stopBrowsing(BrowseListener* listener) override;
+
+  /**
+   * @brief Register the service of the listener
+   */
+  void registerService(
+    RegisterListener* listener, const QString& name, quint16 port,
+    const QMap<QString, QByteArray>& txt
+  ) override;
+
+  /**
+   * @brief Replace the TXT record of the service of the listener
+   */
+  void updateService(RegisterListener* listener, const QMap<QString, QByteArray>& txt) override;
+
+  /**
+   * @brief Unregister the service of the listener if any
+   */
+  void unregisterService(RegisterListener* listener) override;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::network::service::mdns
@@ -4,11 +4,14 @@
 #if defined _WIN32 || defined __APPLE__ || __linux__
 
 #include "mdns/browser/browser.hpp"
+#include "mdns/loopback/loopback.hpp"
 #include "mdns/register/register.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::network::service {
 using mdnsRegister = mdns::Register;
 using mdnsBrowser  = mdns::Browser;
+using mdnsBackend  = mdns::Backend;
+using mdnsLoopback = mdns::LoopbackBackend;
 }  // namespace srilakshmikanthanp::clipbirdesk::network::service
 
 #else  // any other platforms
@@ -45,6 +45,55 @@ void Register::processActivated() {
   }
 }
 
+/**
+ * @brief Encode the key value pairs as TXT record
+ */
+QByteArray Register::encodeTxtRecord(const QMap<QString, QByteArray>& txt) {
+  // TXT record builder
+  TXTRecordRef record;
+
+  // create the record with internal buffer
+  TXTRecordCreate(&record, 0, NULL);
+
+  // add the key value pairs
+  for (auto it = txt.begin(); it != txt.end(); ++it) {
+    auto error = TXTRecordSetValue(
+        &record,                                // TXTRecordRef
+        it.key().toUtf8().constData(),          // key
+        it.value().size(),                      // value size
+        it.value().constData()                  // value
+    );
+
+    // check for error
+    if (error != kDNSServiceErr_NoError) {
+      qWarning() << LOG("TXTRecordSetValue failed");
+    }
+  }
+
+  // copy the record
+  auto bytes = QByteArray(
+      static_cast<const char*>(TXTRecordGetBytesPtr(&record)),
+      TXTRecordGetLength(&record)
+  );
+
+  // free the record
+  TXTRecordDeallocate(&record);
+
+  // return the record
+  return bytes;
+}
+
+/**
+ * @brief Called when the backend registered the service
+ */
+void Register::onBackendRegistered(const QString& name) {
+  // Avoid warning of unused variables
+  Q_UNUSED(name);
+
+  // emit the signal
+  emit OnServiceRegistered();
+}
+
 /**
  * @brief Construct a new Discovery Register object
  *
@@ -54,6 +103,16 @@ Register::Register(QObject* parent) : QObject(parent) {
   // Empty Constructor just calls the parent constructor
 }
 
+/**
+ * @brief Use the backend instead of the DNS-SD daemon, should be
+ * set before registering and outlive the register, nullptr for daemon
+ *
+ * @param backend discovery backend
+ */
+void Register::setBackend(Backend* backend) {
+  this->m_backend = backend;
+}
+
 /**
  * @brief Register the service
  *
@@ -61,6 +120,19 @@ Register::Register(QObject* parent) : QObject(parent) {
  * when service Registered
  */
 void Register::registerServiceAsync() {
+  // if the backend is injected
+  if (this->m_backend != nullptr) {
+    return this->m_backend->registerService(
+      this,                                     // listener
+      QString::fromStdString(constants::getMDnsServiceName()),
+      this->getPort(),                          // port
+      this->getTxtRecord()                      // txt
+    );
+  }
+
+  // TXT record of the service
+  auto txt = encodeTxtRecord(this->getTxtRecord());
+
   // register service for clipbird
   auto errorType = DNSServiceRegister(
       &this->m_serviceRef,                      // DNSServiceRef
@@ -71,8 +143,8 @@ void Register::registerServiceAsync() {
       NULL,                                     // domain
       NULL,                                     // host
       htons(this->getPort()),                   // port
-      0,                                        // txtLen
-      0,                                        // txtRecord
+      txt.size(),                               // txtLen
+      txt.constData(),                          // txtRecord
       publishCallback,                          // callback
       this                                      // context
   );
@@ -100,6 +172,11 @@ void Register::registerServiceAsync() {
  * @brief Stop the server
  */
 void Register::unregisterService() {
+  // stop the injected backend if any
+  if (this->m_backend != nullptr) {
+    this->m_backend->unregisterService(this);
+  }
+
   // check for service & notifier
   if (this->m_serviceRef == nullptr || this->m_notifier == nullptr) {
     return;
@@ -121,6 +198,40 @@ void Register::unregisterService() {
   this->m_serviceRef = nullptr;
 }
 
+/**
+ * @brief Publish the current TXT record of the
+ * registered service
+ */
+void Register::updateTxtRecord() {
+  // if the backend is injected
+  if (this->m_backend != nullptr) {
+    return this->m_backend->updateService(this, this->getTxtRecord());
+  }
+
+  // if not registered
+  if (this->m_serviceRef == nullptr) {
+    return;
+  }
+
+  // TXT record of the service
+  auto txt = encodeTxtRecord(this->getTxtRecord());
+
+  // update the primary TXT record
+  auto errorType = DNSServiceUpdateRecord(
+      this->m_serviceRef,                       // DNSServiceRef
+      NULL,                                     // RecordRef
+      0,                                        // flags
+      txt.size(),                               // rdlen
+      txt.constData(),                          // rdata
+      0                                         // ttl
+  );
+
+  // check for error
+  if (errorType != kDNSServiceErr_NoError) {
+    qWarning() << LOG("DNSServiceUpdateRecord failed");
+  }
+}
+
 /**
  * @brief Destroy the Discovery Register object
  */
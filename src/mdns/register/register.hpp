@@ -9,6 +9,7 @@
 #include <QByteArray>
 #include <QHostAddress>
 #include <QHostInfo>
+#include <QMap>
 #include <QObject>
 #include <QSocketNotifier>
 #include <QTimer>
@@ -25,6 +26,7 @@
 
 // Local headers
 #include "constants/constants.hpp"
+#include "mdns/backend/backend.hpp"
 #include "types/enums/enums.hpp"
 #include "utility/functions/ipconv/ipconv.hpp"
 
@@ -35,11 +37,12 @@ namespace srilakshmikanthanp::clipbirdesk::network::service::mdns {
  * getIpType(), getIPAddress() and getPort() functions to return the
  * IP type, IP address and port number respectively
  */
-class Register : public QObject {
+class Register : public QObject, private RegisterListener {
  private:   // private variables
 
   QSocketNotifier* m_notifier = nullptr; ///< Socket notifier
   DNSServiceRef m_serviceRef = nullptr;  ///< Service ref
+  Backend* m_backend = nullptr;          ///< Injected backend
 
  signals:
   // Signal for service registered
@@ -77,6 +80,18 @@ class Register : public QObject {
    */
   void processActivated();
 
+  /**
+   * @brief Encode the key value pairs as TXT record
+   */
+  static QByteArray encodeTxtRecord(const QMap<QString, QByteArray>& txt);
+
+ private:  // backend listener
+
+  /**
+   * @brief Called when the backend registered the service
+   */
+  void onBackendRegistered(const QString& name) override;
+
  public:  // public functions
 
   /**
@@ -95,6 +110,12 @@ class Register : public QObject {
 
  public:
 
+  /**
+   * @brief Use the backend instead of the DNS-SD daemon, should be
+   * set before registering and outlive the register, nullptr for daemon
+   */
+  void setBackend(Backend* backend);
+
   /**
    * @brief Register the service
    */
@@ -105,6 +126,12 @@ class Register : public QObject {
    */
   void unregisterService();
 
+  /**
+   * @brief Publish the current TXT record of the
+   * registered service
+   */
+  void updateTxtRecord();
+
  protected:  // protected functions
 
   /**
@@ -113,6 +140,14 @@ class Register : public QObject {
    * @return quint16
    */
   virtual quint16 getPort() const = 0;
+
+  /**
+   * @brief Get the TXT record key value pairs
+   * advertised with the service
+   *
+   * @return QMap<QString, QByteArray>
+   */
+  virtual QMap<QString, QByteArray> getTxtRecord() const = 0;
 };
 }  // namespace srilakshmikanthanp::clipbirdesk::network::service
 #endif
@@ -0,0 +1,137 @@
+#include "capabilitypacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::packets {
+/**
+ * @brief Set the Packet Length object
+ *
+ * @param length
+ */
+void CapabilityPacket::setPacketLength(quint32 length) {
+  this->packetLength = length;
+}
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 CapabilityPacket::getPacketLength() const noexcept {
+  return this->packetLength;
+}
+
+/**
+ * @brief Set the Packet Type object
+ *
+ * @param type
+ */
+void CapabilityPacket::setPacketType(quint32 type) {
+  if (type != PacketType::Capability) {
+    throw std::invalid_argument("Invalid Packet Type");
+  }
+
+  this->packetType = type;
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 CapabilityPacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Features object
+ *
+ * @param features bits of types::enums::Feature
+ */
+void CapabilityPacket::setFeatures(quint32 features) {
+  this->features = features;
+}
+
+/**
+ * @brief Get the Features object
+ *
+ * @return quint32
+ */
+quint32 CapabilityPacket::getFeatures() const noexcept {
+  return this->features;
+}
+
+/**
+ * @brief Get the size of the packet
+ *
+ * @return quint32
+ */
+quint32 CapabilityPacket::size() const noexcept {
+  return quint32(
+    sizeof(this->packetLength) +
+    sizeof(this->packetType) +
+    sizeof(this->features)
+  );
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray CapabilityPacket::toBytes() const {
+  // create the stream
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  // set the byte order
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // Write the fields
+  stream << this->packetLength;
+  stream << this->packetType;
+  stream << this->features;
+
+  // Return the QByteArray
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+CapabilityPacket CapabilityPacket::fromBytes(const QByteArray &array) {
+  // create the stream
+  auto stream = QDataStream(array);
+
+  // using the utility functions
+  using types::except::MalformedPacket;
+  using types::enums::ErrorCode;
+
+  // set the byte order
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // Create the CapabilityPacket
+  CapabilityPacket packet;
+
+  // Read the Packet Fields
+  stream >> packet.packetLength;
+  stream >> packet.packetType;
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "CapabilityPacket");
+  }
+
+  // check the packet type
+  if (packet.packetType != PacketType::Capability) {
+    throw types::except::NotThisPacket("Not CapabilityPacket");
+  }
+
+  // Read the Features
+  stream >> packet.features;
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "CapabilityPacket");
+  }
+
+  // return the packet
+  return packet;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::network::packets
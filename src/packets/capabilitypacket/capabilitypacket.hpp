@@ -0,0 +1,96 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <iostream>
+#include <stdexcept>
+
+// Qt header files
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QtTypes>
+
+// Local header files
+#include "types/enums/enums.hpp"
+#include "types/except/except.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::packets {
+/**
+ * @brief Capability Packet, Tells the peer the features the sender
+ * understands so only those are used on the connection, the server
+ * sends it on authentication and the client answers with its own
+ */
+class CapabilityPacket {
+ private:  // private members
+
+  quint32 packetLength;
+  quint32 packetType = 0x0A;
+  quint32 features;
+
+ public:
+
+  /// @brief Allowed Packet Types
+  enum PacketType : quint32 { Capability = 0x0A };
+
+ public:
+
+  /**
+   * @brief Set the Packet Length object
+   *
+   * @param length
+   */
+  void setPacketLength(quint32 length);
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Set the Packet Type object
+   *
+   * @param type
+   */
+  void setPacketType(quint32 type);
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Features object
+   *
+   * @param features bits of types::enums::Feature
+   */
+  void setFeatures(quint32 features);
+
+  /**
+   * @brief Get the Features object
+   *
+   * @return quint32
+   */
+  quint32 getFeatures() const noexcept;
+
+  /**
+   * @brief Get the size of the packet
+   *
+   * @return quint32
+   */
+  quint32 size() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const;
+
+  /**
+   * @brief From Bytes
+   */
+  static CapabilityPacket fromBytes(const QByteArray &array);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::network::packets
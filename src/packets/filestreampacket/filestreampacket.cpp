@@ -0,0 +1,345 @@
+#include "filestreampacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::packets {
+/**
+ * @brief Set the Packet Length object
+ *
+ * @param length
+ */
+void FileStreamPacket::setPacketLength(quint32 length) {
+  this->packetLength = length;
+}
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 FileStreamPacket::getPacketLength() const noexcept {
+  return this->packetLength;
+}
+
+/**
+ * @brief Set the Packet Type object
+ *
+ * @param type
+ */
+void FileStreamPacket::setPacketType(quint32 type) {
+  if (type != PacketType::FileStream) {
+    throw std::invalid_argument("Invalid Packet Type");
+  }
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 FileStreamPacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Stream Id object
+ *
+ * @param id
+ */
+void FileStreamPacket::setStreamId(quint64 id) {
+  this->streamId = id;
+}
+
+/**
+ * @brief Get the Stream Id object
+ *
+ * @return quint64
+ */
+quint64 FileStreamPacket::getStreamId() const noexcept {
+  return this->streamId;
+}
+
+/**
+ * @brief Set the File Count object
+ *
+ * @param count number of files in the stream
+ */
+void FileStreamPacket::setFileCount(quint32 count) {
+  this->fileCount = count;
+}
+
+/**
+ * @brief Get the File Count object
+ *
+ * @return quint32
+ */
+quint32 FileStreamPacket::getFileCount() const noexcept {
+  return this->fileCount;
+}
+
+/**
+ * @brief Set the File Index object
+ *
+ * @param index index of the file in the stream
+ */
+void FileStreamPacket::setFileIndex(quint32 index) {
+  if (index >= this->fileCount) {
+    throw std::invalid_argument("Invalid File Index");
+  } else {
+    this->fileIndex = index;
+  }
+}
+
+/**
+ * @brief Get the File Index object
+ *
+ * @return quint32
+ */
+quint32 FileStreamPacket::getFileIndex() const noexcept {
+  return this->fileIndex;
+}
+
+/**
+ * @brief Set the File Size object
+ *
+ * @param size size of the whole file
+ */
+void FileStreamPacket::setFileSize(quint64 size) {
+  this->fileSize = size;
+}
+
+/**
+ * @brief Get the File Size object
+ *
+ * @return quint64
+ */
+quint64 FileStreamPacket::getFileSize() const noexcept {
+  return this->fileSize;
+}
+
+/**
+ * @brief Set the Offset object
+ *
+ * @param offset offset of the chunk in the file
+ */
+void FileStreamPacket::setOffset(quint64 offset) {
+  if (offset > this->fileSize) {
+    throw std::invalid_argument("Invalid Offset");
+  } else {
+    this->offset = offset;
+  }
+}
+
+/**
+ * @brief Get the Offset object
+ *
+ * @return quint64
+ */
+quint64 FileStreamPacket::getOffset() const noexcept {
+  return this->offset;
+}
+
+/**
+ * @brief Set the Name Length object
+ *
+ * @param length
+ */
+void FileStreamPacket::setNameLength(quint32 length) {
+  this->nameLength = length;
+}
+
+/**
+ * @brief Get the Name Length object
+ *
+ * @return quint32
+ */
+quint32 FileStreamPacket::getNameLength() const noexcept {
+  return this->nameLength;
+}
+
+/**
+ * @brief Set the File Name object
+ *
+ * @param name
+ */
+void FileStreamPacket::setFileName(const QByteArray& name) {
+  if (name.size() != this->nameLength) {
+    throw std::invalid_argument("Invalid File Name");
+  } else {
+    this->fileName = name;
+  }
+}
+
+/**
+ * @brief Get the File Name object
+ *
+ * @return QByteArray
+ */
+QByteArray FileStreamPacket::getFileName() const noexcept {
+  return this->fileName;
+}
+
+/**
+ * @brief Set the Chunk Length object
+ *
+ * @param length
+ */
+void FileStreamPacket::setChunkLength(quint32 length) {
+  if (this->offset + length > this->fileSize) {
+    throw std::invalid_argument("Invalid Chunk Length");
+  } else {
+    this->chunkLength = length;
+  }
+}
+
+/**
+ * @brief Get the Chunk Length object
+ *
+ * @return quint32
+ */
+quint32 FileStreamPacket::getChunkLength() const noexcept {
+  return this->chunkLength;
+}
+
+/**
+ * @brief Set the Chunk object
+ *
+ * @param chunk
+ */
+void FileStreamPacket::setChunk(const QByteArray& chunk) {
+  if (chunk.size() != this->chunkLength) {
+    throw std::invalid_argument("Invalid Chunk");
+  } else {
+    this->chunk = chunk;
+  }
+}
+
+/**
+ * @brief Get the Chunk object
+ *
+ * @return QByteArray
+ */
+QByteArray FileStreamPacket::getChunk() const noexcept {
+  return this->chunk;
+}
+
+/**
+ * @brief Get the size of the packet
+ *
+ * @return quint32
+ */
+quint32 FileStreamPacket::size() const noexcept {
+  return quint32(
+    sizeof(this->packetLength) +
+    sizeof(this->packetType) +
+    sizeof(this->streamId) +
+    sizeof(this->fileCount) +
+    sizeof(this->fileIndex) +
+    sizeof(this->fileSize) +
+    sizeof(this->offset) +
+    sizeof(this->nameLength) +
+    this->fileName.size() +
+    sizeof(this->chunkLength) +
+    this->chunk.size()
+  );
+}
+
+/**
+ * @brief Bytes of the packet up to the chunk, the chunk can be
+ * written after it without copying it into the packet
+ */
+QByteArray FileStreamPacket::headerBytes() const {
+  // create the stream
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  // set the byte order
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // Write the fields
+  stream << this->packetLength;
+  stream << this->packetType;
+  stream << this->streamId;
+  stream << this->fileCount;
+  stream << this->fileIndex;
+  stream << this->fileSize;
+  stream << this->offset;
+  stream << this->nameLength;
+  stream.writeRawData(this->fileName.data(), this->nameLength);
+  stream << this->chunkLength;
+
+  // Return the QByteArray
+  return byteArr;
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray FileStreamPacket::toBytes() const {
+  // the fields up to the chunk
+  auto byteArr = this->headerBytes();
+
+  // reserve the memory to avoid reallocation of large chunks
+  byteArr.reserve(this->size());
+
+  // Write the chunk
+  byteArr.append(this->chunk.constData(), this->chunkLength);
+
+  // Return the QByteArray
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+FileStreamPacket FileStreamPacket::fromBytes(const QByteArray &array) {
+  // create the stream
+  auto stream = QDataStream(array);
+
+  // using the utility functions
+  using types::except::MalformedPacket;
+  using types::enums::ErrorCode;
+
+  // set the byte order
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // Create the FileStreamPacket
+  FileStreamPacket packet;
+
+  // Read the Packet Fields
+  stream >> packet.packetLength;
+  stream >> packet.packetType;
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "FileStreamPacket");
+  }
+
+  // check the packet type
+  if (packet.packetType != PacketType::FileStream) {
+    throw types::except::NotThisPacket("Not FileStreamPacket");
+  }
+
+  // Read the File Fields
+  stream >> packet.streamId;
+  stream >> packet.fileCount;
+  stream >> packet.fileIndex;
+  stream >> packet.fileSize;
+  stream >> packet.offset;
+  stream >> packet.nameLength; packet.fileName.resize(packet.nameLength);
+  stream.readRawData(packet.fileName.data(), packet.nameLength);
+  stream >> packet.chunkLength; packet.chunk.resize(packet.chunkLength);
+  stream.readRawData(packet.chunk.data(), packet.chunkLength);
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "FileStreamPacket");
+  }
+
+  // check the chunk is within the file
+  if (packet.fileIndex >= packet.fileCount || packet.offset + packet.chunkLength > packet.fileSize) {
+    throw MalformedPacket(ErrorCode::InvalidPacket, "FileStreamPacket");
+  }
+
+  // return the packet
+  return packet;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::network::packets
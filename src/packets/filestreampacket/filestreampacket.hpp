@@ -0,0 +1,222 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <iostream>
+#include <stdexcept>
+
+// Qt header files
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QtTypes>
+
+// Local header files
+#include "types/enums/enums.hpp"
+#include "types/except/except.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::packets {
+/**
+ * @brief File Stream Packet that carries a chunk of a file that
+ * is copied to the clipboard, the files of a stream are sent one
+ * after another in chunks with increasing offset
+ */
+class FileStreamPacket {
+ private:  // private members
+
+  quint32 packetLength;
+  quint32 packetType = 0x07;
+  quint64 streamId;
+  quint32 fileCount;
+  quint32 fileIndex;
+  quint64 fileSize;
+  quint64 offset;
+  quint32 nameLength;
+  QByteArray fileName;
+  quint32 chunkLength;
+  QByteArray chunk;
+
+ public:
+
+  /// @brief Allowed Packet Types
+  enum PacketType : quint32 { FileStream = 0x07 };
+
+ public:
+
+  /**
+   * @brief Set the Packet Length object
+   *
+   * @param length
+   */
+  void setPacketLength(quint32 length);
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Set the Packet Type object
+   *
+   * @param type
+   */
+  void setPacketType(quint32 type);
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Stream Id object
+   *
+   * @param id
+   */
+  void setStreamId(quint64 id);
+
+  /**
+   * @brief Get the Stream Id object
+   *
+   * @return quint64
+   */
+  quint64 getStreamId() const noexcept;
+
+  /**
+   * @brief Set the File Count object
+   *
+   * @param count number of files in the stream
+   */
+  void setFileCount(quint32 count);
+
+  /**
+   * @brief Get the File Count object
+   *
+   * @return quint32
+   */
+  quint32 getFileCount() const noexcept;
+
+  /**
+   * @brief Set the File Index object
+   *
+   * @param index index of the file in the stream
+   */
+  void setFileIndex(quint32 index);
+
+  /**
+   * @brief Get the File Index object
+   *
+   * @return quint32
+   */
+  quint32 getFileIndex() const noexcept;
+
+  /**
+   * @brief Set the File Size object
+   *
+   * @param size size of the whole file
+   */
+  void setFileSize(quint64 size);
+
+  /**
+   * @brief Get the File Size object
+   *
+   * @return quint64
+   */
+  quint64 getFileSize() const noexcept;
+
+  /**
+   * @brief Set the Offset object
+   *
+   * @param offset offset of the chunk in the file
+   */
+  void setOffset(quint64 offset);
+
+  /**
+   * @brief Get the Offset object
+   *
+   * @return quint64
+   */
+  quint64 getOffset() const noexcept;
+
+  /**
+   * @brief Set the Name Length object
+   *
+   * @param length
+   */
+  void setNameLength(quint32 length);
+
+  /**
+   * @brief Get the Name Length object
+   *
+   * @return quint32
+   */
+  quint32 getNameLength() const noexcept;
+
+  /**
+   * @brief Set the File Name object
+   *
+   * @param name
+   */
+  void setFileName(const QByteArray& name);
+
+  /**
+   * @brief Get the File Name object
+   *
+   * @return QByteArray
+   */
+  QByteArray getFileName() const noexcept;
+
+  /**
+   * @brief Set the Chunk Length object
+   *
+   * @param length
+   */
+  void setChunkLength(quint32 length);
+
+  /**
+   * @brief Get the Chunk Length object
+   *
+   * @return quint32
+   */
+  quint32 getChunkLength() const noexcept;
+
+  /**
+   * @brief Set the Chunk object
+   *
+   * @param chunk
+   */
+  void setChunk(const QByteArray& chunk);
+
+  /**
+   * @brief Get the Chunk object
+   *
+   * @return QByteArray
+   */
+  QByteArray getChunk() const noexcept;
+
+  /**
+   * @brief Get the size of the packet
+   *
+   * @return quint32
+   */
+  quint32 size() const noexcept;
+
+  /**
+   * @brief Bytes of the packet up to the chunk, the chunk can be
+   * written after it without copying it into the packet
+   */
+  QByteArray headerBytes() const;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const;
+
+  /**
+   * @brief From Bytes
+   */
+  static FileStreamPacket fromBytes(const QByteArray &array);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::network::packets
@@ -0,0 +1,198 @@
+#include "historysummarypacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::packets {
+/**
+ * @brief Set the Packet Length object
+ *
+ * @param length
+ */
+void HistorySummaryPacket::setPacketLength(quint32 length) {
+  this->packetLength = length;
+}
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 HistorySummaryPacket::getPacketLength() const noexcept {
+  return this->packetLength;
+}
+
+/**
+ * @brief Set the Packet Type object
+ *
+ * @param type
+ */
+void HistorySummaryPacket::setPacketType(quint32 type) {
+  if (type != PacketType::HistorySummary) {
+    throw std::invalid_argument("Invalid Packet Type");
+  }
+
+  this->packetType = type;
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 HistorySummaryPacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Free Slots object
+ *
+ * @param slots entries the sender can take
+ */
+void HistorySummaryPacket::setFreeSlots(quint32 slots) {
+  this->freeSlots = slots;
+}
+
+/**
+ * @brief Get the Free Slots object
+ *
+ * @return quint32
+ */
+quint32 HistorySummaryPacket::getFreeSlots() const noexcept {
+  return this->freeSlots;
+}
+
+/**
+ * @brief Set the Entry Count object
+ *
+ * @param count
+ */
+void HistorySummaryPacket::setEntryCount(quint32 count) {
+  this->entryCount = count;
+}
+
+/**
+ * @brief Get the Entry Count object
+ *
+ * @return quint32
+ */
+quint32 HistorySummaryPacket::getEntryCount() const noexcept {
+  return this->entryCount;
+}
+
+/**
+ * @brief Set the Entries object
+ *
+ * @param entries fingerprints of the entries
+ */
+void HistorySummaryPacket::setEntries(const QVector<quint64>& entries) {
+  if (entries.size() != this->entryCount) {
+    throw std::invalid_argument("Invalid Entries");
+  }
+
+  this->entries = entries;
+}
+
+/**
+ * @brief Get the Entries object
+ *
+ * @return QVector<quint64>
+ */
+QVector<quint64> HistorySummaryPacket::getEntries() const noexcept {
+  return this->entries;
+}
+
+/**
+ * @brief Get the size of the packet
+ *
+ * @return quint32
+ */
+quint32 HistorySummaryPacket::size() const noexcept {
+  return quint32(
+    sizeof(this->packetLength) +
+    sizeof(this->packetType) +
+    sizeof(this->freeSlots) +
+    sizeof(this->entryCount) +
+    sizeof(quint64) * this->entries.size()
+  );
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray HistorySummaryPacket::toBytes() const {
+  // create the stream
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  // set the byte order
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // Write the fields
+  stream << this->packetLength;
+  stream << this->packetType;
+  stream << this->freeSlots;
+  stream << this->entryCount;
+
+  // Write the Entries
+  for (const auto entry : this->entries) {
+    stream << entry;
+  }
+
+  // Return the QByteArray
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+HistorySummaryPacket HistorySummaryPacket::fromBytes(const QByteArray &array) {
+  // create the stream
+  auto stream = QDataStream(array);
+
+  // using the utility functions
+  using types::except::MalformedPacket;
+  using types::enums::ErrorCode;
+
+  // set the byte order
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // Create the HistorySummaryPacket
+  HistorySummaryPacket packet;
+
+  // Read the Packet Fields
+  stream >> packet.packetLength;
+  stream >> packet.packetType;
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "HistorySummaryPacket");
+  }
+
+  // check the packet type
+  if (packet.packetType != PacketType::HistorySummary) {
+    throw types::except::NotThisPacket("Not HistorySummaryPacket");
+  }
+
+  // Read the Free Slots and Entry Count
+  stream >> packet.freeSlots;
+  stream >> packet.entryCount;
+
+  // the count can't be more than the bytes left
+  if (stream.status() != QDataStream::Ok || packet.entryCount > quint64(array.size() - stream.device()->pos()) / sizeof(quint64)) {
+    throw MalformedPacket(ErrorCode::CodingError, "HistorySummaryPacket");
+  }
+
+  // Read the Entries
+  packet.entries.resize(packet.entryCount);
+
+  for (auto &entry : packet.entries) {
+    stream >> entry;
+  }
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "HistorySummaryPacket");
+  }
+
+  // return the packet
+  return packet;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::network::packets
@@ -0,0 +1,128 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <iostream>
+#include <stdexcept>
+
+// Qt header files
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QVector>
+#include <QtTypes>
+
+// Local header files
+#include "types/enums/enums.hpp"
+#include "types/except/except.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::packets {
+/**
+ * @brief History Summary Packet, Describes the history of the
+ * sender by the fingerprints of its entries newest first so the
+ * receiver can send only the entries the sender is missing, and
+ * the number of entries the sender can take without evicting any
+ */
+class HistorySummaryPacket {
+ private:  // private members
+
+  quint32 packetLength;
+  quint32 packetType = 0x08;
+  quint32 freeSlots;
+  quint32 entryCount;
+  QVector<quint64> entries;
+
+ public:
+
+  /// @brief Allowed Packet Types
+  enum PacketType : quint32 { HistorySummary = 0x08 };
+
+ public:
+
+  /**
+   * @brief Set the Packet Length object
+   *
+   * @param length
+   */
+  void setPacketLength(quint32 length);
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Set the Packet Type object
+   *
+   * @param type
+   */
+  void setPacketType(quint32 type);
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Free Slots object
+   *
+   * @param slots entries the sender can take
+   */
+  void setFreeSlots(quint32 slots);
+
+  /**
+   * @brief Get the Free Slots object
+   *
+   * @return quint32
+   */
+  quint32 getFreeSlots() const noexcept;
+
+  /**
+   * @brief Set the Entry Count object
+   *
+   * @param count
+   */
+  void setEntryCount(quint32 count);
+
+  /**
+   * @brief Get the Entry Count object
+   *
+   * @return quint32
+   */
+  quint32 getEntryCount() const noexcept;
+
+  /**
+   * @brief Set the Entries object
+   *
+   * @param entries fingerprints of the entries
+   */
+  void setEntries(const QVector<quint64>& entries);
+
+  /**
+   * @brief Get the Entries object
+   *
+   * @return QVector<quint64>
+   */
+  QVector<quint64> getEntries() const noexcept;
+
+  /**
+   * @brief Get the size of the packet
+   *
+   * @return quint32
+   */
+  quint32 size() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const;
+
+  /**
+   * @brief From Bytes
+   */
+  static HistorySummaryPacket fromBytes(const QByteArray &array);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::network::packets
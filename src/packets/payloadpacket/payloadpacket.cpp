@@ -0,0 +1,230 @@
+#include "payloadpacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::packets {
+/**
+ * @brief Set the Packet Length object
+ *
+ * @param length
+ */
+void PayloadPacket::setPacketLength(quint32 length) {
+  this->packetLength = length;
+}
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 PayloadPacket::getPacketLength() const noexcept {
+  return this->packetLength;
+}
+
+/**
+ * @brief Set the Packet Type object
+ *
+ * @param type
+ */
+void PayloadPacket::setPacketType(quint32 type) {
+  if (type != PacketType::PayloadRequest && type != PacketType::PayloadResponse) {
+    throw std::invalid_argument("Invalid Packet Type");
+  }
+
+  this->packetType = type;
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 PayloadPacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Promise Id object
+ *
+ * @param id
+ */
+void PayloadPacket::setPromiseId(quint64 id) {
+  this->promiseId = id;
+}
+
+/**
+ * @brief Get the Promise Id object
+ *
+ * @return quint64
+ */
+quint64 PayloadPacket::getPromiseId() const noexcept {
+  return this->promiseId;
+}
+
+/**
+ * @brief Set the Mime Length object
+ *
+ * @param length
+ */
+void PayloadPacket::setMimeLength(quint32 length) {
+  this->mimeLength = length;
+}
+
+/**
+ * @brief Get the Mime Length object
+ *
+ * @return quint32
+ */
+quint32 PayloadPacket::getMimeLength() const noexcept {
+  return this->mimeLength;
+}
+
+/**
+ * @brief Set the Mime Type object
+ *
+ * @param type
+ */
+void PayloadPacket::setMimeType(const QByteArray& type) {
+  if (type.size() != this->mimeLength) {
+    throw std::invalid_argument("Invalid Mime Type");
+  } else {
+    this->mimeType = type;
+  }
+}
+
+/**
+ * @brief Get the Mime Type object
+ *
+ * @return QByteArray
+ */
+QByteArray PayloadPacket::getMimeType() const noexcept {
+  return this->mimeType;
+}
+
+/**
+ * @brief Set the Payload Length object
+ *
+ * @param length
+ */
+void PayloadPacket::setPayloadLength(quint32 length) {
+  this->payloadLength = length;
+}
+
+/**
+ * @brief Get the Payload Length object
+ *
+ * @return quint32
+ */
+quint32 PayloadPacket::getPayloadLength() const noexcept {
+  return this->payloadLength;
+}
+
+/**
+ * @brief Set the Payload object
+ *
+ * @param payload
+ */
+void PayloadPacket::setPayload(const QByteArray& payload) {
+  if (payload.size() != this->payloadLength) {
+    throw std::invalid_argument("Invalid Payload");
+  } else {
+    this->payload = payload;
+  }
+}
+
+/**
+ * @brief Get the Payload object
+ *
+ * @return QByteArray
+ */
+QByteArray PayloadPacket::getPayload() const noexcept {
+  return this->payload;
+}
+
+/**
+ * @brief Get the size of the packet
+ *
+ * @return quint32
+ */
+quint32 PayloadPacket::size() const noexcept {
+  return quint32(
+    sizeof(this->packetLength) +
+    sizeof(this->packetType) +
+    sizeof(this->promiseId) +
+    sizeof(this->mimeLength) +
+    this->mimeType.size() +
+    sizeof(this->payloadLength) +
+    this->payload.size()
+  );
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray PayloadPacket::toBytes() const {
+  // create the stream
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  // set the byte order
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // Write the fields
+  stream << this->packetLength;
+  stream << this->packetType;
+  stream << this->promiseId;
+  stream << this->mimeLength;
+  stream.writeRawData(this->mimeType.data(), this->mimeLength);
+  stream << this->payloadLength;
+  stream.writeRawData(this->payload.data(), this->payloadLength);
+
+  // Return the QByteArray
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+PayloadPacket PayloadPacket::fromBytes(const QByteArray &array) {
+  // create the stream
+  auto stream = QDataStream(array);
+
+  // using the utility functions
+  using types::except::MalformedPacket;
+  using types::enums::ErrorCode;
+
+  // set the byte order
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // Create the PayloadPacket
+  PayloadPacket packet;
+
+  // Read the Packet Fields
+  stream >> packet.packetLength;
+  stream >> packet.packetType;
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "PayloadPacket");
+  }
+
+  // check the packet type
+  if (packet.packetType != PacketType::PayloadRequest &&
+      packet.packetType != PacketType::PayloadResponse) {
+    throw types::except::NotThisPacket("Not PayloadPacket");
+  }
+
+  // Read the Payload Fields
+  stream >> packet.promiseId;
+  stream >> packet.mimeLength; packet.mimeType.resize(packet.mimeLength);
+  stream.readRawData(packet.mimeType.data(), packet.mimeLength);
+  stream >> packet.payloadLength; packet.payload.resize(packet.payloadLength);
+  stream.readRawData(packet.payload.data(), packet.payloadLength);
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "PayloadPacket");
+  }
+
+  // return the packet
+  return packet;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::network::packets
@@ -0,0 +1,158 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <iostream>
+#include <stdexcept>
+
+// Qt header files
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QtTypes>
+
+// Local header files
+#include "types/enums/enums.hpp"
+#include "types/except/except.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::packets {
+/**
+ * @brief Payload Packet used to request the payload of a promised
+ * item and to respond with it, the request has empty payload
+ */
+class PayloadPacket {
+ private:  // private members
+
+  quint32 packetLength;
+  quint32 packetType;
+  quint64 promiseId;
+  quint32 mimeLength;
+  QByteArray mimeType;
+  quint32 payloadLength;
+  QByteArray payload;
+
+ public:
+
+  /// @brief Allowed Packet Types
+  enum PacketType : quint32 {
+    PayloadRequest  = 0x05,
+    PayloadResponse = 0x06
+  };
+
+ public:
+
+  /**
+   * @brief Set the Packet Length object
+   *
+   * @param length
+   */
+  void setPacketLength(quint32 length);
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Set the Packet Type object
+   *
+   * @param type
+   */
+  void setPacketType(quint32 type);
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Promise Id object
+   *
+   * @param id
+   */
+  void setPromiseId(quint64 id);
+
+  /**
+   * @brief Get the Promise Id object
+   *
+   * @return quint64
+   */
+  quint64 getPromiseId() const noexcept;
+
+  /**
+   * @brief Set the Mime Length object
+   *
+   * @param length
+   */
+  void setMimeLength(quint32 length);
+
+  /**
+   * @brief Get the Mime Length object
+   *
+   * @return quint32
+   */
+  quint32 getMimeLength() const noexcept;
+
+  /**
+   * @brief Set the Mime Type object
+   *
+   * @param type
+   */
+  void setMimeType(const QByteArray& type);
+
+  /**
+   * @brief Get the Mime Type object
+   *
+   * @return QByteArray
+   */
+  QByteArray getMimeType() const noexcept;
+
+  /**
+   * @brief Set the Payload Length object
+   *
+   * @param length
+   */
+  void setPayloadLength(quint32 length);
+
+  /**
+   * @brief Get the Payload Length object
+   *
+   * @return quint32
+   */
+  quint32 getPayloadLength() const noexcept;
+
+  /**
+   * @brief Set the Payload object
+   *
+   * @param payload
+   */
+  void setPayload(const QByteArray& payload);
+
+  /**
+   * @brief Get the Payload object
+   *
+   * @return QByteArray
+   */
+  QByteArray getPayload() const noexcept;
+
+  /**
+   * @brief Get the size of the packet
+   *
+   * @return quint32
+   */
+  quint32 size() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const;
+
+  /**
+   * @brief From Bytes
+   */
+  static PayloadPacket fromBytes(const QByteArray &array);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::network::packets
@@ -0,0 +1,387 @@
+#include "promisepacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::packets {
+/**
+ * @brief Set the Mime Length object
+ */
+void PromiseItem::setMimeLength(quint32 length) {
+  this->mimeLength = length;
+}
+
+/**
+ * @brief Get the Mime Length object
+ *
+ * @return quint32
+ */
+quint32 PromiseItem::getMimeLength() const noexcept {
+  return this->mimeLength;
+}
+
+/**
+ * @brief Set the Mime Type object
+ *
+ * @param type
+ */
+void PromiseItem::setMimeType(const QByteArray& type) {
+  if (type.size() != this->mimeLength) {
+    throw std::invalid_argument("Invalid Mime Type");
+  } else {
+    this->mimeType = type;
+  }
+}
+
+/**
+ * @brief Get the Mime Type object
+ *
+ * @return QByteArray
+ */
+QByteArray PromiseItem::getMimeType() const noexcept {
+  return this->mimeType;
+}
+
+/**
+ * @brief Set the Payload Size object
+ *
+ * @param size actual size of the payload
+ */
+void PromiseItem::setPayloadSize(quint32 size) {
+  this->payloadSize = size;
+}
+
+/**
+ * @brief Get the Payload Size object
+ *
+ * @return quint32
+ */
+quint32 PromiseItem::getPayloadSize() const noexcept {
+  return this->payloadSize;
+}
+
+/**
+ * @brief Set the Payload Hash object
+ *
+ * @param hash XXH3 hash of the payload
+ */
+void PromiseItem::setPayloadHash(quint64 hash) {
+  this->payloadHash = hash;
+}
+
+/**
+ * @brief Get the Payload Hash object
+ *
+ * @return quint64
+ */
+quint64 PromiseItem::getPayloadHash() const noexcept {
+  return this->payloadHash;
+}
+
+/**
+ * @brief Set the Payload Length object
+ *
+ * @param length
+ */
+void PromiseItem::setPayloadLength(quint32 length) {
+  if (length != 0 && length != this->payloadSize) {
+    throw std::invalid_argument("Invalid Payload Length");
+  } else {
+    this->payloadLength = length;
+  }
+}
+
+/**
+ * @brief Get the Payload Length object
+ *
+ * @return quint32
+ */
+quint32 PromiseItem::getPayloadLength() const noexcept {
+  return this->payloadLength;
+}
+
+/**
+ * @brief Set the Payload object
+ *
+ * @param payload
+ */
+void PromiseItem::setPayload(const QByteArray& payload) {
+  if (payload.size() != this->payloadLength) {
+    throw std::invalid_argument("Invalid Payload");
+  } else {
+    this->payload = payload;
+  }
+}
+
+/**
+ * @brief Get the Payload object
+ *
+ * @return QByteArray
+ */
+QByteArray PromiseItem::getPayload() const noexcept {
+  return this->payload;
+}
+
+/**
+ * @brief Is the payload not included in the packet
+ *
+ * @return bool
+ */
+bool PromiseItem::isLazy() const noexcept {
+  return this->payloadLength != this->payloadSize;
+}
+
+/**
+ * @brief Get the size of the packet
+ *
+ * @return quint32
+ */
+quint32 PromiseItem::size() const noexcept {
+  return quint32(
+    sizeof(this->mimeLength) +
+    this->mimeType.size() +
+    sizeof(this->payloadSize) +
+    sizeof(this->payloadHash) +
+    sizeof(this->payloadLength) +
+    this->payload.size()
+  );
+}
+
+/**
+ * @brief To Stream
+ */
+void PromiseItem::toStream(QDataStream& stream) const {
+  stream << this->mimeLength;
+  stream.writeRawData(this->mimeType.data(), this->mimeLength);
+  stream << this->payloadSize;
+  stream << this->payloadHash;
+  stream << this->payloadLength;
+  stream.writeRawData(this->payload.data(), this->payloadLength);
+}
+
+/**
+ * @brief From Stream
+ */
+PromiseItem PromiseItem::fromStream(QDataStream& stream) {
+  // using the utility functions
+  using types::except::MalformedPacket;
+  using types::enums::ErrorCode;
+
+  // Create the PromiseItem
+  PromiseItem item;
+
+  // Read the Packet Fields
+  stream >> item.mimeLength; item.mimeType.resize(item.mimeLength);
+  stream.readRawData(item.mimeType.data(), item.mimeLength);
+  stream >> item.payloadSize;
+  stream >> item.payloadHash;
+  stream >> item.payloadLength;
+
+  // payload is either complete or not included
+  if (item.payloadLength != 0 && item.payloadLength != item.payloadSize) {
+    throw MalformedPacket(ErrorCode::CodingError, "PromiseItem");
+  }
+
+  // read the payload
+  item.payload.resize(item.payloadLength);
+  stream.readRawData(item.payload.data(), item.payloadLength);
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "PromiseItem");
+  }
+
+  // return the item
+  return item;
+}
+
+/**
+ * @brief Set the Packet Length object
+ *
+ * @param length
+ */
+void PromisePacket::setPacketLength(quint32 length) {
+  this->packetLength = length;
+}
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 PromisePacket::getPacketLength() const noexcept {
+  return this->packetLength;
+}
+
+/**
+ * @brief Set the Packet Type object
+ *
+ * @param type
+ */
+void PromisePacket::setPacketType(quint32 type) {
+  if (type != PacketType::Promise && type != PacketType::HistoryPromise) {
+    throw std::invalid_argument("Invalid Packet Type");
+  }
+
+  this->packetType = type;
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 PromisePacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Promise Id object
+ *
+ * @param id
+ */
+void PromisePacket::setPromiseId(quint64 id) {
+  this->promiseId = id;
+}
+
+/**
+ * @brief Get the Promise Id object
+ *
+ * @return quint64
+ */
+quint64 PromisePacket::getPromiseId() const noexcept {
+  return this->promiseId;
+}
+
+/**
+ * @brief Set the Item Count object
+ *
+ * @param count
+ */
+void PromisePacket::setItemCount(quint32 count) {
+  this->itemCount = count;
+}
+
+/**
+ * @brief Get the Item Count object
+ *
+ * @return quint32
+ */
+quint32 PromisePacket::getItemCount() const noexcept {
+  return this->itemCount;
+}
+
+/**
+ * @brief Set the Items object
+ *
+ * @param items
+ */
+void PromisePacket::setItems(const QVector<PromiseItem>& items) {
+  if (items.size() != this->itemCount) {
+    throw std::invalid_argument("Invalid Items");
+  }
+
+  this->items = items;
+}
+
+/**
+ * @brief Get the Items object
+ *
+ * @return QVector<PromiseItem>
+ */
+QVector<PromiseItem> PromisePacket::getItems() const noexcept {
+  return this->items;
+}
+
+/**
+ * @brief Get the size of the packet
+ *
+ * @return quint32
+ */
+quint32 PromisePacket::size() const noexcept {
+  size_t size = (
+    sizeof(this->packetLength) +
+    sizeof(this->packetType) +
+    sizeof(this->promiseId) +
+    sizeof(this->itemCount)
+  );
+
+  for (const auto& item : this->items) {
+    size += item.size();
+  }
+
+  return quint32(size);
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray PromisePacket::toBytes() const {
+  // create the stream
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  // set the byte order
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // Write the fields
+  stream << this->packetLength;
+  stream << this->packetType;
+  stream << this->promiseId;
+  stream << this->itemCount;
+
+  // Write the Items
+  for (const auto& item : this->items) {
+    item.toStream(stream);
+  }
+
+  // Return the QByteArray
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+PromisePacket PromisePacket::fromBytes(const QByteArray &array) {
+  // create the stream
+  auto stream = QDataStream(array);
+
+  // using the utility functions
+  using types::except::MalformedPacket;
+  using types::enums::ErrorCode;
+
+  // set the byte order
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // Create the PromisePacket
+  PromisePacket packet;
+
+  // Read the Packet Fields
+  stream >> packet.packetLength;
+  stream >> packet.packetType;
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "PromisePacket");
+  }
+
+  // check the packet type
+  if (packet.packetType != PacketType::Promise && packet.packetType != PacketType::HistoryPromise) {
+    throw types::except::NotThisPacket("Not PromisePacket");
+  }
+
+  // Read the Promise Fields
+  stream >> packet.promiseId;
+  stream >> packet.itemCount;
+
+  // Read the Items
+  for (quint32 i = 0; i < packet.itemCount; i++) {
+    packet.items.push_back(PromiseItem::fromStream(stream));
+  }
+
+  // if the stream is not good
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "PromisePacket");
+  }
+
+  // return the packet
+  return packet;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::network::packets
@@ -0,0 +1,252 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <iostream>
+#include <stdexcept>
+
+// Qt header files
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QVector>
+#include <QtTypes>
+
+// Local header files
+#include "types/enums/enums.hpp"
+#include "types/except/except.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::packets {
+/**
+ * @brief Clipboard Promise Packet's Item, if the payload
+ * length is less than the payload size then the payload is
+ * not included and should be requested with PayloadPacket
+ */
+class PromiseItem {
+ private:
+
+  quint32 mimeLength;
+  QByteArray mimeType;
+  quint32 payloadSize;
+  quint64 payloadHash;
+  quint32 payloadLength;
+  QByteArray payload;
+
+ public:
+
+  /**
+   * @brief Set the Mime Length object
+   */
+  void setMimeLength(quint32 length);
+
+  /**
+   * @brief Get the Mime Length object
+   *
+   * @return quint32
+   */
+  quint32 getMimeLength() const noexcept;
+
+  /**
+   * @brief Set the Mime Type object
+   *
+   * @param type
+   */
+  void setMimeType(const QByteArray& type);
+
+  /**
+   * @brief Get the Mime Type object
+   *
+   * @return QByteArray
+   */
+  QByteArray getMimeType() const noexcept;
+
+  /**
+   * @brief Set the Payload Size object
+   *
+   * @param size actual size of the payload
+   */
+  void setPayloadSize(quint32 size);
+
+  /**
+   * @brief Get the Payload Size object
+   *
+   * @return quint32
+   */
+  quint32 getPayloadSize() const noexcept;
+
+  /**
+   * @brief Set the Payload Hash object
+   *
+   * @param hash XXH3 hash of the payload
+   */
+  void setPayloadHash(quint64 hash);
+
+  /**
+   * @brief Get the Payload Hash object
+   *
+   * @return quint64
+   */
+  quint64 getPayloadHash() const noexcept;
+
+  /**
+   * @brief Set the Payload Length object
+   *
+   * @param length
+   */
+  void setPayloadLength(quint32 length);
+
+  /**
+   * @brief Get the Payload Length object
+   *
+   * @return quint32
+   */
+  quint32 getPayloadLength() const noexcept;
+
+  /**
+   * @brief Set the Payload object
+   *
+   * @param payload
+   */
+  void setPayload(const QByteArray& payload);
+
+  /**
+   * @brief Get the Payload object
+   *
+   * @return QByteArray
+   */
+  QByteArray getPayload() const noexcept;
+
+  /**
+   * @brief Is the payload not included in the packet
+   *
+   * @return bool
+   */
+  bool isLazy() const noexcept;
+
+  /**
+   * @brief Get the size of the packet
+   *
+   * @return quint32
+   */
+  quint32 size() const noexcept;
+
+  /**
+   * @brief To Stream
+   */
+  void toStream(QDataStream& stream) const;
+
+  /**
+   * @brief From Stream
+   */
+  static PromiseItem fromStream(QDataStream& stream);
+};
+
+/**
+ * @brief Clipboard Promise Packet, Advertise the clipboard items
+ * with small items included and large items only described, the
+ * history promise carries a history entry the receiver is missing
+ * and is not placed on the clipboard
+ */
+class PromisePacket {
+ private:  // private members
+
+  quint32 packetLength;
+  quint32 packetType = 0x04;
+  quint64 promiseId;
+  quint32 itemCount;
+  QVector<PromiseItem> items;
+
+ public:
+
+  /// @brief Allowed Packet Types
+  enum PacketType : quint32 { Promise = 0x04, HistoryPromise = 0x09 };
+
+ public:
+
+  /**
+   * @brief Set the Packet Length object
+   *
+   * @param length
+   */
+  void setPacketLength(quint32 length);
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Set the Packet Type object
+   *
+   * @param type
+   */
+  void setPacketType(quint32 type);
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Promise Id object
+   *
+   * @param id
+   */
+  void setPromiseId(quint64 id);
+
+  /**
+   * @brief Get the Promise Id object
+   *
+   * @return quint64
+   */
+  quint64 getPromiseId() const noexcept;
+
+  /**
+   * @brief Set the Item Count object
+   *
+   * @param count
+   */
+  void setItemCount(quint32 count);
+
+  /**
+   * @brief Get the Item Count object
+   *
+   * @return quint32
+   */
+  quint32 getItemCount() const noexcept;
+
+  /**
+   * @brief Set the Items object
+   *
+   * @param items
+   */
+  void setItems(const QVector<PromiseItem>& items);
+
+  /**
+   * @brief Get the Items object
+   *
+   * @return QVector<PromiseItem>
+   */
+  QVector<PromiseItem> getItems() const noexcept;
+
+  /**
+   * @brief Get the size of the packet
+   *
+   * @return quint32
+   */
+  quint32 size() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const;
+
+  /**
+   * @brief From Bytes
+   */
+  static PromisePacket fromBytes(const QByteArray &array);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::network::packets
@@ -185,9 +185,11 @@ quint32 SyncingPacket::getPacketLength() const noexcept {
  * @param type
  */
 void SyncingPacket::setPacketType(quint32 type) {
-  if (type != PacketType::SyncPacket) {
+  if (type != PacketType::SyncPacket && type != PacketType::StreamItems) {
     throw std::invalid_argument("Invalid Packet Type");
   }
+
+  this->packetType = type;
 }
 
 /**
@@ -307,7 +309,7 @@ SyncingPacket SyncingPacket::fromBytes(const QByteArray &array) {
   }
 
   // check the packet type
-  if (packet.packetType != PacketType::SyncPacket) {
+  if (packet.packetType != PacketType::SyncPacket && packet.packetType != PacketType::StreamItems) {
     throw types::except::NotThisPacket("Not SyncingPacket");
   }
 
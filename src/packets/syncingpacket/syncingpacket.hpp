@@ -124,7 +124,7 @@ class SyncingPacket {
  public:
 
   /// @brief Allowed Packet Types
-  enum PacketType : quint32 { SyncPacket = 0x02 };
+  enum PacketType : quint32 { SyncPacket = 0x02, StreamItems = 0x0B };
 
  public:
 
@@ -0,0 +1,81 @@
+#include "endpointcache.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief Construct a new Endpoint Cache object
+ *
+ * @param capacity max number of endpoints kept
+ */
+EndpointCache::EndpointCache(qsizetype capacity) : m_capacity(capacity) {}
+
+/**
+ * @brief Cache the endpoint replacing the old one of the name, the
+ * least recently seen endpoint is evicted when over the capacity
+ */
+void EndpointCache::insert(const Endpoint &endpoint) {
+  // replace the old one
+  m_byName.insert(endpoint.name, endpoint);
+
+  // evict the least recently seen
+  while (m_byName.size() > m_capacity) {
+    auto oldest = m_byName.begin();
+    for (auto it = m_byName.begin(); it != m_byName.end(); ++it) {
+      if (it->seen < oldest->seen) oldest = it;
+    }
+    m_byName.erase(oldest);
+  }
+}
+
+/**
+ * @brief Remove the endpoint of the name
+ */
+void EndpointCache::remove(const QString &name) {
+  m_byName.remove(name);
+}
+
+/**
+ * @brief Remove all the endpoints
+ */
+void EndpointCache::clear() {
+  m_byName.clear();
+}
+
+/**
+ * @brief Remove the endpoints seen before the time
+ *
+ * @return true if any endpoint is removed
+ */
+bool EndpointCache::expire(const QDateTime &before) {
+  return m_byName.removeIf([&](const auto &it) { return it.value().seen < before; }) > 0;
+}
+
+/**
+ * @brief Is there an endpoint for the name
+ */
+bool EndpointCache::contains(const QString &name) const {
+  return m_byName.contains(name);
+}
+
+/**
+ * @brief All the endpoints, most recently seen first
+ */
+QList<EndpointCache::Endpoint> EndpointCache::endpoints() const {
+  // all the endpoints
+  QList<Endpoint> endpoints = m_byName.values();
+
+  // most recently seen first
+  std::sort(endpoints.begin(), endpoints.end(), [](const auto &a, const auto &b) {
+    return a.seen > b.seen;
+  });
+
+  // return the endpoints
+  return endpoints;
+}
+
+/**
+ * @brief Number of cached endpoints
+ */
+qsizetype EndpointCache::size() const {
+  return m_byName.size();
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::storage
@@ -0,0 +1,85 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QHostAddress>
+#include <QList>
+#include <QString>
+
+// C++ header
+#include <algorithm>
+
+namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief In memory cache of the last known endpoints of the trusted
+ * servers, used to connect at startup before the discovery finds them
+ */
+class EndpointCache {
+ public:  // types
+
+  /// @brief last known endpoint of a server
+  struct Endpoint {
+    QString name;
+    QList<QHostAddress> addresses;
+    quint16 port = 0;
+    QByteArray fingerprint;
+    QDateTime seen;
+  };
+
+ private:  // members
+
+  QHash<QString, Endpoint> m_byName;
+  qsizetype m_capacity;
+
+ public:  // constructor
+
+  /**
+   * @brief Construct a new Endpoint Cache object
+   *
+   * @param capacity max number of endpoints kept
+   */
+  explicit EndpointCache(qsizetype capacity);
+
+ public:  // functions
+
+  /**
+   * @brief Cache the endpoint replacing the old one of the name, the
+   * least recently seen endpoint is evicted when over the capacity
+   */
+  void insert(const Endpoint &endpoint);
+
+  /**
+   * @brief Remove the endpoint of the name
+   */
+  void remove(const QString &name);
+
+  /**
+   * @brief Remove all the endpoints
+   */
+  void clear();
+
+  /**
+   * @brief Remove the endpoints seen before the time
+   *
+   * @return true if any endpoint is removed
+   */
+  bool expire(const QDateTime &before);
+
+  /**
+   * @brief Is there an endpoint for the name
+   */
+  bool contains(const QString &name) const;
+
+  /**
+   * @brief All the endpoints, most recently seen first
+   */
+  QList<Endpoint> endpoints() const;
+
+  /**
+   * @brief Number of cached endpoints
+   */
+  qsizetype size() const;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::storage
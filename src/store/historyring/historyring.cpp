@@ -0,0 +1,196 @@
+#include "historyring.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief slot of the logical index
+ */
+qsizetype HistoryRing::slot(qsizetype index) const {
+  return (m_head + index) % m_slots.size();
+}
+
+/**
+ * @brief Construct a new History Ring object
+ *
+ * @param capacity max number of entries
+ */
+HistoryRing::HistoryRing(qsizetype capacity) {
+  // check the capacity
+  if (capacity <= 0) {
+    throw std::invalid_argument("Capacity must be positive");
+  }
+
+  // allocate the slots
+  m_slots.resize(capacity);
+}
+
+/**
+ * @brief Add the entry as newest
+ *
+ * @return std::optional<Entry> oldest entry if it was evicted
+ */
+std::optional<HistoryRing::Entry> HistoryRing::pushFront(Entry entry) {
+  // evicted entry
+  std::optional<Entry> evicted;
+
+  // if full the oldest is evicted
+  if (m_size == m_slots.size()) {
+    evicted = std::exchange(m_slots[slot(m_size - 1)], Entry{});
+    m_size--;
+  }
+
+  // move the head back
+  m_head = (m_head + m_slots.size() - 1) % m_slots.size();
+  m_slots[m_head] = std::move(entry);
+  m_size++;
+
+  // return the evicted
+  return evicted;
+}
+
+/**
+ * @brief Add the entry at the index without evicting, shifts
+ * the shorter side
+ */
+void HistoryRing::insert(qsizetype index, Entry entry) {
+  // check the index
+  if (index < 0 || index > m_size) {
+    throw std::out_of_range("Index out of range");
+  }
+
+  // check the capacity
+  if (m_size == m_slots.size()) {
+    throw std::length_error("History is full");
+  }
+
+  if (index < m_size / 2) {
+    // shift the newer entries to the front
+    m_head = (m_head + m_slots.size() - 1) % m_slots.size();
+
+    for (qsizetype i = 0; i < index; ++i) {
+      m_slots[slot(i)] = std::move(m_slots[slot(i + 1)]);
+    }
+  } else {
+    // shift the older entries to the back
+    for (auto i = m_size; i > index; --i) {
+      m_slots[slot(i)] = std::move(m_slots[slot(i - 1)]);
+    }
+  }
+
+  // place the entry
+  m_slots[slot(index)] = std::move(entry);
+  m_size++;
+}
+
+/**
+ * @brief Remove the entry at the index, shifts the shorter side
+ */
+HistoryRing::Entry HistoryRing::takeAt(qsizetype index) {
+  // check the index
+  if (index < 0 || index >= m_size) {
+    throw std::out_of_range("Index out of range");
+  }
+
+  // take the entry
+  auto entry = std::exchange(m_slots[slot(index)], Entry{});
+
+  if (index < m_size / 2) {
+    // shift the newer entries to the back
+    for (auto i = index; i > 0; --i) {
+      m_slots[slot(i)] = std::move(m_slots[slot(i - 1)]);
+    }
+
+    m_head = slot(1);
+  } else {
+    // shift the older entries to the front
+    for (auto i = index; i < m_size - 1; ++i) {
+      m_slots[slot(i)] = std::move(m_slots[slot(i + 1)]);
+    }
+  }
+
+  // one less
+  m_size--;
+
+  // return the entry
+  return entry;
+}
+
+/**
+ * @brief Entry at the index
+ */
+const HistoryRing::Entry &HistoryRing::at(qsizetype index) const {
+  if (index < 0 || index >= m_size) {
+    throw std::out_of_range("Index out of range");
+  }
+
+  return m_slots[slot(index)];
+}
+
+/**
+ * @brief Mutable entry at the index
+ */
+HistoryRing::Entry &HistoryRing::operator[](qsizetype index) {
+  if (index < 0 || index >= m_size) {
+    throw std::out_of_range("Index out of range");
+  }
+
+  return m_slots[slot(index)];
+}
+
+/**
+ * @brief Index of the entry with the id or -1
+ */
+qsizetype HistoryRing::indexOf(quint64 id) const {
+  for (qsizetype i = 0; i < m_size; ++i) {
+    if (m_slots[slot(i)].id == id) return i;
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Remove all the entries
+ */
+void HistoryRing::clear() {
+  for (qsizetype i = 0; i < m_size; ++i) {
+    m_slots[slot(i)] = Entry{};
+  }
+
+  m_head = 0;
+  m_size = 0;
+}
+
+/**
+ * @brief Number of entries
+ */
+qsizetype HistoryRing::size() const {
+  return m_size;
+}
+
+/**
+ * @brief Max number of entries
+ */
+qsizetype HistoryRing::capacity() const {
+  return m_slots.size();
+}
+
+/**
+ * @brief Is there no entry
+ */
+bool HistoryRing::isEmpty() const {
+  return m_size == 0;
+}
+
+/**
+ * @brief Items of the entries newest first
+ */
+QVector<QVector<QPair<QString, QByteArray>>> HistoryRing::items() const {
+  QVector<QVector<QPair<QString, QByteArray>>> items;
+  items.reserve(m_size);
+
+  for (qsizetype i = 0; i < m_size; ++i) {
+    items.append(m_slots[slot(i)].items);
+  }
+
+  return items;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::storage
@@ -0,0 +1,119 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QByteArray>
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include <QtTypes>
+
+// C++ header
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief Fixed capacity history where index 0 is the newest entry, the
+ * entries live in a circular array so adding the newest entry and
+ * evicting the oldest is O(1) instead of shifting the whole history
+ */
+class HistoryRing {
+ public:  // types
+
+  /// @brief entry of the history with its store id, large payloads
+  /// of a spilled entry are null and live only in the store, items
+  /// of a promise that are not fetched yet are kept as mime and hash
+  struct Entry {
+    quint64 id;
+    QVector<QPair<QString, QByteArray>> items;
+    quint64 fingerprint = 0;
+    quint64 used        = 0;
+    bool spilled        = false;
+    std::optional<quint64> promise;
+    QVector<QPair<QString, quint64>> promised;
+  };
+
+ private:  // members
+
+  QVector<Entry> m_slots;
+  qsizetype m_head = 0;
+  qsizetype m_size = 0;
+
+ private:  // private functions
+
+  /**
+   * @brief slot of the logical index
+   */
+  qsizetype slot(qsizetype index) const;
+
+ public:  // constructors
+
+  /**
+   * @brief Construct a new History Ring object
+   *
+   * @param capacity max number of entries
+   */
+  explicit HistoryRing(qsizetype capacity);
+
+ public:  // functions
+
+  /**
+   * @brief Add the entry as newest
+   *
+   * @return std::optional<Entry> oldest entry if it was evicted
+   */
+  std::optional<Entry> pushFront(Entry entry);
+
+  /**
+   * @brief Add the entry at the index without evicting, shifts
+   * the shorter side
+   */
+  void insert(qsizetype index, Entry entry);
+
+  /**
+   * @brief Remove the entry at the index, shifts the shorter side
+   */
+  Entry takeAt(qsizetype index);
+
+  /**
+   * @brief Entry at the index
+   */
+  const Entry &at(qsizetype index) const;
+
+  /**
+   * @brief Mutable entry at the index
+   */
+  Entry &operator[](qsizetype index);
+
+  /**
+   * @brief Index of the entry with the id or -1
+   */
+  qsizetype indexOf(quint64 id) const;
+
+  /**
+   * @brief Remove all the entries
+   */
+  void clear();
+
+  /**
+   * @brief Number of entries
+   */
+  qsizetype size() const;
+
+  /**
+   * @brief Max number of entries
+   */
+  qsizetype capacity() const;
+
+  /**
+   * @brief Is there no entry
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Items of the entries newest first
+   */
+  QVector<QVector<QPair<QString, QByteArray>>> items() const;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::storage
@@ -0,0 +1,729 @@
+#include "historystore.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief name of the segment file
+ */
+QString HistoryStore::segmentName(quint32 segment) {
+  return QString("%1.seg").arg(segment, 8, 10, QChar('0'));
+}
+
+/**
+ * @brief Read the index, drop the records that are torn or refer
+ * payloads that are not on the disk and remove unused segments
+ */
+void HistoryStore::recover() {
+  // entries and payload locations from the index
+  QMap<quint64, QVector<Item>> entries;
+  QHash<quint64, Blob> blobs;
+
+  // is the index need to be rewritten
+  bool dirty = true;
+
+  // read the index
+  if (QFile file(m_dir.filePath("index")); file.open(QIODevice::ReadOnly)) {
+    // create the stream
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream.setByteOrder(QDataStream::BigEndian);
+
+    // read the header
+    quint32 magic = 0, version = 0;
+    stream >> magic >> version;
+
+    // if the header is valid then read the records
+    if (stream.status() == QDataStream::Ok && magic == MAGIC && version == VERSION) {
+      dirty = false;
+    }
+
+    // read until the end or a torn record
+    while (!dirty && !stream.atEnd()) {
+      quint8 op = 0; quint64 id = 0; quint32 count = 0;
+      QVector<QPair<Item, Blob>> items;
+
+      // read the operation and id
+      stream >> op >> id;
+
+      // read the items of append
+      if (op == Operation::Append) {
+        stream >> count;
+      } else if (op != Operation::Remove) {
+        dirty = true; break;
+      }
+
+      // read the items
+      for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        Item item; Blob blob;
+        stream >> item.mime >> item.hash >> blob.segment >> blob.offset >> blob.length;
+        items.append({item, blob});
+      }
+
+      // if the record is torn
+      if (stream.status() != QDataStream::Ok) {
+        dirty = true; break;
+      }
+
+      // if the entry is removed
+      if (op == Operation::Remove) {
+        entries.remove(id); continue;
+      }
+
+      // add the entry
+      auto &entry = entries[id];
+      entry.clear();
+
+      for (const auto &[item, blob] : items) {
+        entry.append(item);
+        blobs.insert(item.hash, blob);
+      }
+    }
+  }
+
+  // size of the segments on the disk
+  const auto files = m_dir.entryInfoList({"*.seg"}, QDir::Files);
+  QMap<quint32, quint64> sizes;
+
+  for (const auto &info : files) {
+    sizes.insert(info.baseName().toUInt(), info.size());
+  }
+
+  // drop the entries that refer missing payloads
+  for (auto it = entries.begin(); it != entries.end();) {
+    const auto missing = std::any_of(it->begin(), it->end(), [&](const Item &item) {
+      const auto &blob = blobs[item.hash];
+      return !sizes.contains(blob.segment) || blob.offset + blob.length > sizes[blob.segment];
+    });
+
+    if (missing) {
+      it = entries.erase(it); dirty = true;
+    } else {
+      ++it;
+    }
+  }
+
+  // count the references
+  for (const auto &items : entries) {
+    for (const auto &item : items) {
+      auto it = m_blobs.find(item.hash);
+
+      if (it == m_blobs.end()) {
+        m_blobs.insert(item.hash, {blobs[item.hash], 1});
+        m_liveBytes += blobs[item.hash].length;
+      } else {
+        it->count++;
+      }
+    }
+  }
+
+  // segments that are referred
+  for (const auto &ref : std::as_const(m_blobs)) {
+    m_segments.insert(ref.blob.segment, sizes[ref.blob.segment]);
+  }
+
+  // remove the segments no entry refers
+  for (auto it = sizes.begin(); it != sizes.end(); ++it) {
+    if (!m_segments.contains(it.key())) {
+      m_dir.remove(segmentName(it.key()));
+    }
+  }
+
+  // next segment and id
+  m_nextSegment = sizes.isEmpty() ? 0 : sizes.lastKey() + 1;
+  m_nextId      = entries.isEmpty() ? 0 : entries.lastKey() + 1;
+  m_entries     = entries;
+
+  // reuse the last segment if it has space
+  if (!m_segments.isEmpty() && m_segments.last() < m_segmentSize) {
+    m_active = m_segments.lastKey();
+  } else {
+    m_active = m_nextSegment++;
+    m_segments.insert(m_active, 0);
+  }
+
+  // open the active segment
+  m_writer.setFileName(m_dir.filePath(segmentName(m_active)));
+
+  if (!m_writer.open(QIODevice::WriteOnly | QIODevice::Append)) {
+    throw std::runtime_error("Failed to open history segment");
+  }
+
+  // rewrite the index if needed
+  if (dirty) {
+    rewriteIndex();
+    return;
+  }
+
+  // open the index for append
+  m_index.setFileName(m_dir.filePath("index"));
+
+  if (!m_index.open(QIODevice::WriteOnly | QIODevice::Append)) {
+    throw std::runtime_error("Failed to open history index");
+  }
+}
+
+/**
+ * @brief Encode the append or remove record
+ */
+QByteArray HistoryStore::record(Operation op, quint64 id) const {
+  // create the stream
+  QByteArray data;
+  QDataStream stream(&data, QIODevice::WriteOnly);
+  stream.setVersion(QDataStream::Qt_6_0);
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // write the operation and id
+  stream << quint8(op) << id;
+
+  // if the entry is removed
+  if (op == Operation::Remove) {
+    return data;
+  }
+
+  // write the items
+  const auto &items = m_entries[id];
+  stream << quint32(items.size());
+
+  for (const auto &item : items) {
+    const auto &blob = m_blobs[item.hash].blob;
+    stream << item.mime << item.hash << blob.segment << blob.offset << blob.length;
+  }
+
+  // return the data
+  return data;
+}
+
+/**
+ * @brief Append the record to the index
+ */
+void HistoryStore::writeRecord(const QByteArray &record) {
+  if (m_index.write(record) != record.size() || !m_index.flush()) {
+    throw std::runtime_error("Failed to write history index");
+  }
+}
+
+/**
+ * @brief Rewrite the index with only the live entries
+ */
+void HistoryStore::rewriteIndex() {
+  // close the index
+  m_index.close();
+
+  // write to temporary and rename on commit
+  QSaveFile file(m_dir.filePath("index"));
+
+  if (!file.open(QIODevice::WriteOnly)) {
+    throw std::runtime_error("Failed to open history index");
+  }
+
+  // write the header
+  QDataStream stream(&file);
+  stream.setVersion(QDataStream::Qt_6_0);
+  stream.setByteOrder(QDataStream::BigEndian);
+  stream << MAGIC << VERSION;
+
+  // write the entries oldest first
+  for (auto it = m_entries.keyBegin(); it != m_entries.keyEnd(); ++it) {
+    const auto data = record(Operation::Append, *it);
+    stream.writeRawData(data.constData(), data.size());
+  }
+
+  // commit the index
+  if (stream.status() != QDataStream::Ok || !file.commit()) {
+    throw std::runtime_error("Failed to write history index");
+  }
+
+  // open the index for append
+  m_index.setFileName(m_dir.filePath("index"));
+
+  if (!m_index.open(QIODevice::WriteOnly | QIODevice::Append)) {
+    throw std::runtime_error("Failed to open history index");
+  }
+}
+
+/**
+ * @brief Start a new active segment
+ */
+void HistoryStore::rotate() {
+  // close the active segment
+  m_writer.close();
+
+  // open the new segment
+  m_active = m_nextSegment++;
+  m_writer.setFileName(m_dir.filePath(segmentName(m_active)));
+
+  if (!m_writer.open(QIODevice::WriteOnly | QIODevice::Append)) {
+    throw std::runtime_error("Failed to open history segment");
+  }
+
+  // track the segment
+  m_segments.insert(m_active, 0);
+}
+
+/**
+ * @brief Store the payload or reuse the stored one with same hash
+ */
+quint64 HistoryStore::retain(const QByteArray &data) {
+  // hash of the payload
+  const auto hash = utility::functions::xxh3(data);
+
+  // if already stored
+  if (auto it = m_blobs.find(hash); it != m_blobs.end()) {
+    it->count++; return hash;
+  }
+
+  // start a new segment if the active is full
+  if (m_segments[m_active] > 0 && m_segments[m_active] + data.size() > m_segmentSize) {
+    rotate();
+  }
+
+  // append to the active segment
+  const Blob blob{m_active, m_segments[m_active], quint64(data.size())};
+
+  if (m_writer.write(data) != data.size() || !m_writer.flush()) {
+    throw std::runtime_error("Failed to write history segment");
+  }
+
+  // track the payload
+  m_segments[m_active] += data.size();
+  m_liveBytes          += data.size();
+  m_blobs.insert(hash, {blob, 1});
+
+  // return the hash
+  return hash;
+}
+
+/**
+ * @brief Release the payload and forget it when unused
+ */
+void HistoryStore::release(quint64 hash) {
+  // find the payload
+  auto it = m_blobs.find(hash);
+
+  // if still used
+  if (it == m_blobs.end() || --it->count > 0) {
+    return;
+  }
+
+  // forget the payload
+  m_liveBytes -= it->blob.length;
+  m_blobs.erase(it);
+}
+
+/**
+ * @brief Read the payload by mapping the segment
+ */
+QByteArray HistoryStore::read(const Blob &blob) {
+  // if the payload is empty
+  if (blob.length == 0) return QByteArray();
+
+  // open the segment
+  auto &segment = m_mapped[blob.segment];
+
+  if (!segment.file) {
+    segment.file = std::make_unique<QFile>(m_dir.filePath(segmentName(blob.segment)));
+  }
+
+  if (!segment.file->isOpen() && !segment.file->open(QIODevice::ReadOnly)) {
+    throw std::runtime_error("Failed to open history segment");
+  }
+
+  // map again if the segment grew beyond the mapping
+  if (quint64(segment.size) < blob.offset + blob.length) {
+    if (segment.data) segment.file->unmap(segment.data);
+    segment.size = segment.file->size();
+    segment.data = segment.file->map(0, segment.size);
+  }
+
+  // if the mapping failed
+  if (!segment.data || quint64(segment.size) < blob.offset + blob.length) {
+    segment.data = nullptr; segment.size = 0;
+    throw std::runtime_error("Failed to map history segment");
+  }
+
+  // copy the payload out of the mapping
+  return QByteArray(reinterpret_cast<const char *>(segment.data + blob.offset), blob.length);
+}
+
+/**
+ * @brief Is the dead space worth compacting
+ */
+bool HistoryStore::shouldCompact() const {
+  const auto dead = diskBytes() - m_liveBytes;
+  return dead > m_liveBytes && dead >= m_segmentSize / 4;
+}
+
+/**
+ * @brief Swap in the compacted segment
+ */
+void HistoryStore::finishCompaction() {
+  // if nothing to finish
+  if (m_sealed.isEmpty()) return;
+
+  // take the state
+  const auto sealed = std::exchange(m_sealed, {});
+  const auto result = m_compaction.result();
+  const auto target = m_dir.filePath(segmentName(m_target));
+
+  // if the compaction failed
+  if (!result.has_value()) {
+    m_dir.remove(segmentName(m_target)); return;
+  }
+
+  // payloads in sealed segments are moved to the target
+  for (auto it = m_blobs.begin(); it != m_blobs.end(); ++it) {
+    if (sealed.contains(it->blob.segment)) {
+      it->blob = result->value(it.key());
+    }
+  }
+
+  // track the target
+  m_segments.insert(m_target, QFileInfo(target).size());
+
+  // forget the sealed segments
+  for (const auto segment : sealed) {
+    m_mapped.erase(segment);
+    m_segments.remove(segment);
+  }
+
+  // the target is synced by relocate so the index may refer it
+  // and it must refer the target before the old segments go
+  rewriteIndex();
+
+  // remove the sealed segments
+  for (const auto segment : sealed) {
+    m_dir.remove(segmentName(segment));
+  }
+}
+
+/**
+ * @brief Write the file and its directory entry to the disk, flush
+ * only hands the bytes to the kernel which may lose them on a crash
+ */
+bool HistoryStore::syncToDisk(QFile &file, const QDir &dir) {
+#ifdef _WIN32
+  Q_UNUSED(dir);
+  return FlushFileBuffers(reinterpret_cast<HANDLE>(_get_osfhandle(file.handle())));
+#else
+  // the file content
+  if (::fsync(file.handle()) != 0) return false;
+
+  // the directory entry of a new file
+  const auto fd = ::open(QFile::encodeName(dir.absolutePath()).constData(), O_RDONLY);
+  if (fd < 0) return false;
+  const auto ok = ::fsync(fd) == 0;
+  ::close(fd);
+  return ok;
+#endif
+}
+
+/**
+ * @brief Copy the payloads to the target segment (worker thread)
+ */
+std::optional<QHash<quint64, HistoryStore::Blob>> HistoryStore::relocate(
+  QDir dir, QVector<QPair<quint64, Blob>> blobs, quint32 target
+) {
+  // open the target
+  QFile output(dir.filePath(segmentName(target)));
+  std::map<quint32, std::unique_ptr<QFile>> inputs;
+  QHash<quint64, Blob> result;
+
+  if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+    return std::nullopt;
+  }
+
+  // copy in the order of the source so reads are sequential
+  std::sort(blobs.begin(), blobs.end(), [](const auto &a, const auto &b) {
+    return std::tie(a.second.segment, a.second.offset) < std::tie(b.second.segment, b.second.offset);
+  });
+
+  for (const auto &[hash, blob] : blobs) {
+    // location in the target
+    result.insert(hash, {target, quint64(output.pos()), blob.length});
+
+    // if the payload is empty
+    if (blob.length == 0) continue;
+
+    // open the source
+    auto &input = inputs[blob.segment];
+
+    if (!input) {
+      input = std::make_unique<QFile>(dir.filePath(segmentName(blob.segment)));
+      if (!input->open(QIODevice::ReadOnly)) return std::nullopt;
+    }
+
+    // map the payload
+    const auto data = input->map(blob.offset, blob.length);
+
+    if (data == nullptr) {
+      return std::nullopt;
+    }
+
+    // copy the payload
+    const auto written = output.write(reinterpret_cast<const char *>(data), blob.length);
+    input->unmap(data);
+
+    if (written != qint64(blob.length)) {
+      return std::nullopt;
+    }
+  }
+
+  // the target is on the disk before the index refers it
+  if (!output.flush() || !syncToDisk(output, dir)) {
+    return std::nullopt;
+  }
+
+  // return the locations
+  return result;
+}
+
+/**
+ * @brief Open or create the history store in the directory
+ *
+ * @param dir directory of the store
+ * @param segmentSize size after which a new segment is started
+ */
+HistoryStore::HistoryStore(const QString &dir, quint64 segmentSize)
+    : m_dir(dir), m_segmentSize(segmentSize) {
+  // create the directory
+  if (!m_dir.mkpath(".")) {
+    throw std::runtime_error("Failed to create history directory");
+  }
+
+  // swap in the compacted segment when done
+  QObject::connect(&m_compaction, &QFutureWatcherBase::finished, &m_compaction, [this] {
+    this->finishCompaction();
+  });
+
+  // read the index
+  this->recover();
+
+  // compact if too much is dead
+  if (this->shouldCompact()) this->compact();
+}
+
+/**
+ * @brief Destroy the History Store object
+ */
+HistoryStore::~HistoryStore() {
+  try {
+    this->waitForCompaction();
+  } catch (const std::exception &) {
+    // next open removes the leftovers
+  }
+}
+
+/**
+ * @brief Id of the entries newest first
+ */
+QVector<quint64> HistoryStore::entries() const {
+  QVector<quint64> ids(m_entries.keyBegin(), m_entries.keyEnd());
+  std::reverse(ids.begin(), ids.end());
+  return ids;
+}
+
+/**
+ * @brief Items of the entry, payloads are read from the mapping
+ */
+QVector<QPair<QString, QByteArray>> HistoryStore::items(quint64 id) {
+  return this->items(id, std::numeric_limits<quint64>::max());
+}
+
+/**
+ * @brief Items of the entry, payloads larger than the limit are
+ * left null and skipped is set if any was left
+ */
+QVector<QPair<QString, QByteArray>> HistoryStore::items(quint64 id, quint64 limit, bool *skipped) {
+  // find the entry
+  auto it = m_entries.find(id);
+
+  // if not found
+  if (it == m_entries.end()) {
+    throw std::invalid_argument("No such history entry");
+  }
+
+  // nothing skipped yet
+  if (skipped) *skipped = false;
+
+  // read the payloads
+  QVector<QPair<QString, QByteArray>> items;
+
+  for (const auto &item : *it) {
+    const auto &blob = m_blobs[item.hash].blob;
+
+    if (blob.length > limit) {
+      items.append({item.mime, QByteArray()});
+      if (skipped) *skipped = true;
+    } else {
+      items.append({item.mime, this->read(blob)});
+    }
+  }
+
+  // return the items
+  return items;
+}
+
+/**
+ * @brief Mime type and payload hash of the items of the entry
+ */
+QVector<QPair<QString, quint64>> HistoryStore::hashes(quint64 id) const {
+  // hashes of the items
+  QVector<QPair<QString, quint64>> hashes;
+
+  for (const auto &item : m_entries.value(id)) {
+    hashes.append({item.mime, item.hash});
+  }
+
+  // return the hashes
+  return hashes;
+}
+
+/**
+ * @brief Append the entry as newest
+ *
+ * @return quint64 id of the entry
+ */
+quint64 HistoryStore::append(const QVector<QPair<QString, QByteArray>> &items) {
+  // id of the entry
+  const auto id = m_nextId++;
+
+  // store the items
+  this->update(id, items);
+
+  // return the id
+  return id;
+}
+
+/**
+ * @brief Replace the items of the entry keeping its position
+ */
+void HistoryStore::update(quint64 id, const QVector<QPair<QString, QByteArray>> &items) {
+  // new items before the old are released so shared payloads stay
+  QVector<Item> entry;
+
+  for (const auto &[mime, data] : items) {
+    entry.append({mime, this->retain(data)});
+  }
+
+  // release the old items
+  for (const auto &item : m_entries.value(id)) {
+    this->release(item.hash);
+  }
+
+  // replace the entry
+  m_entries.insert(id, entry);
+
+  // write the record
+  this->writeRecord(this->record(Operation::Append, id));
+}
+
+/**
+ * @brief Move the entry to a new newest id keeping its payloads,
+ * the entries are loaded back in the order of their ids
+ *
+ * @return quint64 new id of the entry
+ */
+quint64 HistoryStore::renew(quint64 id) {
+  // find the entry
+  auto it = m_entries.find(id);
+
+  // if not found
+  if (it == m_entries.end()) {
+    throw std::invalid_argument("No such history entry");
+  }
+
+  // new id of the entry
+  const auto renewed = m_nextId++;
+
+  // move the items, the payloads stay referred
+  m_entries.insert(renewed, it.value());
+  m_entries.remove(id);
+
+  // write the records
+  this->writeRecord(this->record(Operation::Remove, id));
+  this->writeRecord(this->record(Operation::Append, renewed));
+
+  // return the new id
+  return renewed;
+}
+
+/**
+ * @brief Remove the entry
+ */
+void HistoryStore::remove(quint64 id) {
+  // find the entry
+  auto it = m_entries.find(id);
+
+  // if not found
+  if (it == m_entries.end()) return;
+
+  // release the items
+  for (const auto &item : *it) {
+    this->release(item.hash);
+  }
+
+  // remove the entry
+  m_entries.erase(it);
+
+  // write the record
+  this->writeRecord(this->record(Operation::Remove, id));
+
+  // compact if too much is dead
+  if (this->shouldCompact()) this->compact();
+}
+
+/**
+ * @brief Copy the live payloads of the sealed segments to a new
+ * segment in background and drop the old segments
+ */
+void HistoryStore::compact() {
+  // if already running
+  if (!m_sealed.isEmpty()) return;
+
+  // seal the active segment
+  this->rotate();
+
+  // sealed segments
+  for (auto it = m_segments.keyBegin(); it != m_segments.keyEnd(); ++it) {
+    if (*it != m_active) m_sealed.insert(*it);
+  }
+
+  // live payloads of the sealed segments
+  QVector<QPair<quint64, Blob>> blobs;
+
+  for (auto it = m_blobs.cbegin(); it != m_blobs.cend(); ++it) {
+    if (m_sealed.contains(it->blob.segment)) blobs.append({it.key(), it->blob});
+  }
+
+  // copy in background
+  m_target = m_nextSegment++;
+  m_compaction.setFuture(QtConcurrent::run(&HistoryStore::relocate, m_dir, blobs, m_target));
+}
+
+/**
+ * @brief Wait for the running compaction to finish
+ */
+void HistoryStore::waitForCompaction() {
+  m_compaction.waitForFinished();
+  this->finishCompaction();
+}
+
+/**
+ * @brief Size of the distinct payloads the entries refer
+ */
+quint64 HistoryStore::liveBytes() const {
+  return m_liveBytes;
+}
+
+/**
+ * @brief Size of the segments on the disk
+ */
+quint64 HistoryStore::diskBytes() const {
+  quint64 size = 0;
+
+  for (const auto bytes : m_segments) {
+    size += bytes;
+  }
+
+  return size;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::storage
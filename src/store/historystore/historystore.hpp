@@ -0,0 +1,270 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QByteArray>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QMap>
+#include <QPair>
+#include <QSaveFile>
+#include <QSet>
+#include <QString>
+#include <QVector>
+#include <QtConcurrent>
+
+// C++ header
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+
+// Platform header
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Local header
+#include "utility/functions/hash/hash.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief Persistent clipboard history, the payloads are appended to
+ * segment files and deduplicated by hash, the entries are kept in an
+ * append only index so opening the store reads only the index and the
+ * payloads are memory mapped when they are asked for
+ *
+ * <dir>/index      magic, version and the append/remove records
+ * <dir>/N.seg      payload blobs back to back
+ */
+class HistoryStore {
+ public:  // types
+
+  /// @brief location of the payload in the segments
+  struct Blob {
+    quint32 segment;
+    quint64 offset;
+    quint64 length;
+  };
+
+ private:  // types
+
+  /// @brief payload and the number of items referring it
+  struct Ref {
+    Blob blob;
+    quint32 count;
+  };
+
+  /// @brief item of an entry
+  struct Item {
+    QString mime;
+    quint64 hash;
+  };
+
+  /// @brief opened segment and its mapping
+  struct Segment {
+    std::unique_ptr<QFile> file;
+    uchar *data = nullptr;
+    qint64 size = 0;
+  };
+
+  /// @brief index record operations
+  enum Operation : quint8 { Append = 0x01, Remove = 0x02 };
+
+ private:  // constants
+
+  static constexpr quint32 MAGIC   = 0x43424849;  // CBHI
+  static constexpr quint32 VERSION = 0x00000001;
+
+ private:  // members
+
+  QDir m_dir;
+  quint64 m_segmentSize;
+  QMap<quint64, QVector<Item>> m_entries;
+  QHash<quint64, Ref> m_blobs;
+  QMap<quint32, quint64> m_segments;
+  std::map<quint32, Segment> m_mapped;
+  QFile m_index;
+  QFile m_writer;
+  quint32 m_active      = 0;
+  quint32 m_nextSegment = 0;
+  quint64 m_nextId      = 0;
+  quint64 m_liveBytes   = 0;
+
+ private:  // compaction
+
+  QFutureWatcher<std::optional<QHash<quint64, Blob>>> m_compaction;
+  QSet<quint32> m_sealed;
+  quint32 m_target = 0;
+
+ private:  // disable copy and move
+
+  Q_DISABLE_COPY_MOVE(HistoryStore)
+
+ private:  // private functions
+
+  /**
+   * @brief name of the segment file
+   */
+  static QString segmentName(quint32 segment);
+
+  /**
+   * @brief Read the index, drop the records that are torn or refer
+   * payloads that are not on the disk and remove unused segments
+   */
+  void recover();
+
+  /**
+   * @brief Encode the append or remove record
+   */
+  QByteArray record(Operation op, quint64 id) const;
+
+  /**
+   * @brief Append the record to the index
+   */
+  void writeRecord(const QByteArray &record);
+
+  /**
+   * @brief Rewrite the index with only the live entries
+   */
+  void rewriteIndex();
+
+  /**
+   * @brief Start a new active segment
+   */
+  void rotate();
+
+  /**
+   * @brief Store the payload or reuse the stored one with same hash
+   */
+  quint64 retain(const QByteArray &data);
+
+  /**
+   * @brief Release the payload and forget it when unused
+   */
+  void release(quint64 hash);
+
+  /**
+   * @brief Read the payload by mapping the segment
+   */
+  QByteArray read(const Blob &blob);
+
+  /**
+   * @brief Is the dead space worth compacting
+   */
+  bool shouldCompact() const;
+
+  /**
+   * @brief Swap in the compacted segment
+   */
+  void finishCompaction();
+
+  /**
+   * @brief Write the file and its directory entry to the disk
+   */
+  static bool syncToDisk(QFile &file, const QDir &dir);
+
+  /**
+   * @brief Copy the payloads to the target segment (worker thread)
+   */
+  static std::optional<QHash<quint64, Blob>> relocate(
+    QDir dir, QVector<QPair<quint64, Blob>> blobs, quint32 target
+  );
+
+ public:  // constructors
+
+  /**
+   * @brief Open or create the history store in the directory
+   *
+   * @param dir directory of the store
+   * @param segmentSize size after which a new segment is started
+   */
+  HistoryStore(const QString &dir, quint64 segmentSize);
+
+  /**
+   * @brief Destroy the History Store object
+   */
+  ~HistoryStore();
+
+ public:  // functions
+
+  /**
+   * @brief Id of the entries newest first
+   */
+  QVector<quint64> entries() const;
+
+  /**
+   * @brief Items of the entry, payloads are read from the mapping
+   */
+  QVector<QPair<QString, QByteArray>> items(quint64 id);
+
+  /**
+   * @brief Items of the entry, payloads larger than the limit are
+   * left null and skipped is set if any was left
+   */
+  QVector<QPair<QString, QByteArray>> items(quint64 id, quint64 limit, bool *skipped = nullptr);
+
+  /**
+   * @brief Mime type and payload hash of the items of the entry
+   */
+  QVector<QPair<QString, quint64>> hashes(quint64 id) const;
+
+  /**
+   * @brief Append the entry as newest
+   *
+   * @return quint64 id of the entry
+   */
+  quint64 append(const QVector<QPair<QString, QByteArray>> &items);
+
+  /**
+   * @brief Replace the items of the entry keeping its position
+   */
+  void update(quint64 id, const QVector<QPair<QString, QByteArray>> &items);
+
+  /**
+   * @brief Move the entry to a new newest id keeping its payloads
+   *
+   * @return quint64 new id of the entry
+   */
+  quint64 renew(quint64 id);
+
+  /**
+   * @brief Remove the entry
+   */
+  void remove(quint64 id);
+
+  /**
+   * @brief Copy the live payloads of the sealed segments to a new
+   * segment in background and drop the old segments
+   */
+  void compact();
+
+  /**
+   * @brief Wait for the running compaction to finish
+   */
+  void waitForCompaction();
+
+  /**
+   * @brief Size of the distinct payloads the entries refer
+   */
+  quint64 liveBytes() const;
+
+  /**
+   * @brief Size of the segments on the disk
+   */
+  quint64 diskBytes() const;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::storage
@@ -0,0 +1,156 @@
+#include "searchindex.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief Distinct trigrams of the folded text
+ */
+QVector<quint64> SearchIndex::trigramsOf(const QString &text) {
+  // trigrams of the text
+  QVector<quint64> trigrams;
+
+  // if the text has no trigram
+  if (text.size() < 3) return trigrams;
+
+  // pack the three utf-16 units to 48 bits
+  trigrams.reserve(text.size() - 2);
+
+  for (qsizetype i = 0; i + 2 < text.size(); ++i) {
+    trigrams.append(
+      quint64(text.at(i).unicode()) << 32 |
+      quint64(text.at(i + 1).unicode()) << 16 |
+      quint64(text.at(i + 2).unicode())
+    );
+  }
+
+  // keep the distinct
+  std::sort(trigrams.begin(), trigrams.end());
+  trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+
+  // return the trigrams
+  return trigrams;
+}
+
+/**
+ * @brief Construct a new Search Index object
+ *
+ * @param limit number of leading characters of a text that are indexed
+ */
+SearchIndex::SearchIndex(qsizetype limit) : m_limit(limit) {}
+
+/**
+ * @brief Index the text of the key replacing the old one
+ */
+void SearchIndex::insert(quint64 key, const QString &text) {
+  // remove the old text
+  this->remove(key);
+
+  // fold the leading text
+  const auto folded   = text.left(m_limit).toCaseFolded();
+  const auto trigrams = trigramsOf(folded);
+
+  // add the key to the postings, keys are mostly increasing
+  // so it is an append in the common case
+  for (const auto trigram : trigrams) {
+    auto &keys = m_postings[trigram];
+    keys.insert(std::upper_bound(keys.begin(), keys.end(), key), key);
+  }
+
+  // remember the text and trigrams
+  m_trigrams.insert(key, trigrams);
+  m_texts.insert(key, folded);
+}
+
+/**
+ * @brief Remove the key from the index
+ */
+void SearchIndex::remove(quint64 key) {
+  // find the trigrams of the key
+  auto it = m_trigrams.find(key);
+
+  // if not indexed
+  if (it == m_trigrams.end()) return;
+
+  // remove the key from the postings
+  for (const auto trigram : *it) {
+    auto posting = m_postings.find(trigram);
+    auto &keys   = *posting;
+    auto pos     = std::lower_bound(keys.begin(), keys.end(), key);
+
+    if (pos != keys.end() && *pos == key) keys.erase(pos);
+    if (keys.isEmpty()) m_postings.erase(posting);
+  }
+
+  // forget the key
+  m_trigrams.erase(it);
+  m_texts.remove(key);
+}
+
+/**
+ * @brief Remove all the keys
+ */
+void SearchIndex::clear() {
+  m_postings.clear();
+  m_trigrams.clear();
+  m_texts.clear();
+}
+
+/**
+ * @brief Keys whose text contains the query ignoring case,
+ * largest key first
+ */
+QVector<quint64> SearchIndex::search(const QString &query) const {
+  // fold the query
+  const auto folded = query.toCaseFolded();
+  QVector<quint64> result;
+
+  // short query has no trigram so check every text
+  if (folded.size() < 3) {
+    for (auto it = m_texts.cbegin(); it != m_texts.cend(); ++it) {
+      if (it->contains(folded)) result.append(it.key());
+    }
+
+    std::sort(result.rbegin(), result.rend());
+    return result;
+  }
+
+  // postings of the query trigrams
+  QVector<const QVector<quint64> *> postings;
+
+  for (const auto trigram : trigramsOf(folded)) {
+    auto it = m_postings.constFind(trigram);
+    if (it == m_postings.cend()) return result;
+    postings.append(&*it);
+  }
+
+  // start from the shortest posting
+  std::sort(postings.begin(), postings.end(), [](auto a, auto b) {
+    return a->size() < b->size();
+  });
+
+  // intersect the postings
+  QVector<quint64> candidates = *postings.front();
+
+  for (qsizetype i = 1; i < postings.size() && !candidates.isEmpty(); ++i) {
+    const auto &keys = *postings.at(i);
+    auto end = std::remove_if(candidates.begin(), candidates.end(), [&](quint64 key) {
+      return !std::binary_search(keys.begin(), keys.end(), key);
+    });
+    candidates.erase(end, candidates.end());
+  }
+
+  // trigrams may match out of order so verify the candidates
+  for (auto it = candidates.crbegin(); it != candidates.crend(); ++it) {
+    if (m_texts.value(*it).contains(folded)) result.append(*it);
+  }
+
+  // return the result
+  return result;
+}
+
+/**
+ * @brief Number of keys in the index
+ */
+qsizetype SearchIndex::size() const {
+  return m_texts.size();
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::storage
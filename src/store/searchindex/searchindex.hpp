@@ -0,0 +1,71 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QHash>
+#include <QString>
+#include <QVector>
+#include <QtTypes>
+
+// C++ header
+#include <algorithm>
+
+namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief Incremental trigram index over the text of the history entries,
+ * every case folded trigram of the text maps to the sorted keys that has
+ * it, a query intersects the lists of its trigrams starting from the
+ * shortest and verifies only the few candidates left
+ */
+class SearchIndex {
+ private:  // members
+
+  QHash<quint64, QVector<quint64>> m_postings;
+  QHash<quint64, QVector<quint64>> m_trigrams;
+  QHash<quint64, QString> m_texts;
+  qsizetype m_limit;
+
+ private:  // private functions
+
+  /**
+   * @brief Distinct trigrams of the folded text
+   */
+  static QVector<quint64> trigramsOf(const QString &text);
+
+ public:  // constructors
+
+  /**
+   * @brief Construct a new Search Index object
+   *
+   * @param limit number of leading characters of a text that are indexed
+   */
+  explicit SearchIndex(qsizetype limit);
+
+ public:  // functions
+
+  /**
+   * @brief Index the text of the key replacing the old one
+   */
+  void insert(quint64 key, const QString &text);
+
+  /**
+   * @brief Remove the key from the index
+   */
+  void remove(quint64 key);
+
+  /**
+   * @brief Remove all the keys
+   */
+  void clear();
+
+  /**
+   * @brief Keys whose text contains the query ignoring case,
+   * largest key first
+   */
+  QVector<quint64> search(const QString &query) const;
+
+  /**
+   * @brief Number of keys in the index
+   */
+  qsizetype size() const;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::storage
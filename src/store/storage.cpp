@@ -1,6 +1,91 @@
 #include "storage.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief Parse the certificates of the group to the trust store
+ */
+void Storage::loadTrust(const char *group, TrustStore &trust) {
+  settings->beginGroup(group);
+  for (auto &name : settings->childKeys()) {
+    auto cert = QSslCertificate(settings->value(name).toByteArray(), QSsl::Pem);
+    if (!cert.isNull()) trust.insert(name, cert);
+  }
+  settings->endGroup();
+}
+
+/**
+ * @brief Write the certificates of the trust store to the group
+ */
+void Storage::saveTrust(const char *group, const TrustStore &trust) {
+  settings->beginGroup(group);
+  settings->remove("");
+  for (auto &name : trust.names()) {
+    settings->setValue(name, trust.certificate(name).toPem());
+  }
+  settings->endGroup();
+}
+
+/**
+ * @brief Write the changed trust stores to the settings
+ */
+void Storage::flushTrust() {
+  if (clientDirty) {
+    this->saveTrust(clientGroup, clientTrust);
+    clientDirty = false;
+  }
+
+  if (serverDirty) {
+    this->saveTrust(serverGroup, serverTrust);
+    serverDirty = false;
+  }
+}
+
+/**
+ * @brief Parse the server endpoints of the group to the cache
+ */
+void Storage::loadEndpoints() {
+  settings->beginGroup(endpointGroup);
+  for (auto &name : settings->childKeys()) {
+    auto value = settings->value(name).toMap();
+    auto endpoint = EndpointCache::Endpoint();
+    endpoint.name = name;
+    for (auto &address : value.value("addresses").toStringList()) {
+      endpoint.addresses.append(QHostAddress(address));
+    }
+    endpoint.port = value.value("port").toUInt();
+    endpoint.fingerprint = QByteArray::fromHex(value.value("fingerprint").toByteArray());
+    endpoint.seen = value.value("seen").toDateTime();
+    if (!endpoint.addresses.isEmpty() && endpoint.port) endpoints.insert(endpoint);
+  }
+  settings->endGroup();
+}
+
+/**
+ * @brief Write the server endpoints of the cache to the group
+ */
+void Storage::flushEndpoints() {
+  // if not changed
+  if (!endpointDirty) return;
+
+  settings->beginGroup(endpointGroup);
+  settings->remove("");
+  for (auto &endpoint : endpoints.endpoints()) {
+    QStringList addresses;
+    for (auto &address : endpoint.addresses) {
+      addresses.append(address.toString());
+    }
+    settings->setValue(endpoint.name, QVariantMap({
+      {"addresses", addresses},
+      {"port", endpoint.port},
+      {"fingerprint", endpoint.fingerprint.toHex()},
+      {"seen", endpoint.seen},
+    }));
+  }
+  settings->endGroup();
+
+  endpointDirty = false;
+}
+
 /**
  * @brief Construct a new SQLStore object
  *
@@ -8,160 +93,229 @@ namespace srilakshmikanthanp::clipbirdesk::storage {
  */
 Storage::Storage(QObject *parent) : QObject(parent) {
   this->settings->setParent(this);
+
+  // parse the trusted certificates once
+  this->loadTrust(clientGroup, clientTrust);
+  this->loadTrust(serverGroup, serverTrust);
+
+  // last known endpoints of the servers
+  this->loadEndpoints();
+
+  // changes are written once the event loop is idle
+  this->flushTimer->setSingleShot(true);
+  this->flushTimer->setInterval(0);
+
+  QObject::connect(
+    this->flushTimer, &QTimer::timeout,
+    this, &Storage::flushTrust
+  );
+
+  QObject::connect(
+    this->flushTimer, &QTimer::timeout,
+    this, &Storage::flushEndpoints
+  );
+
+  // write the pending changes before quit
+  if (auto app = QCoreApplication::instance()) {
+    QObject::connect(
+      app, &QCoreApplication::aboutToQuit,
+      this, &Storage::flushTrust
+    );
+
+    QObject::connect(
+      app, &QCoreApplication::aboutToQuit,
+      this, &Storage::flushEndpoints
+    );
+  }
 }
 
 /**
- * @brief Store Client name and JWT token
+ * @brief Destroy the SQLStore object
+ */
+Storage::~Storage() {
+  this->flushTrust();
+  this->flushEndpoints();
+}
+
+/**
+ * @brief Store Client name and cert
  *
  * @param name
- * @param token
+ * @param cert
  */
-void Storage::setClientCert(const QString &name, const QByteArray &token) {
-  settings->beginGroup(clientGroup);
-  settings->setValue(name, token);
-  settings->endGroup();
+void Storage::setClientCert(const QString &name, const QSslCertificate &cert) {
+  // if already trusted
+  if (clientTrust.isTrusted(name, cert)) return;
+
+  // trust and write behind
+  clientTrust.insert(name, cert);
+  clientDirty = true;
+  flushTimer->start();
 }
 
 /**
  * @brief has the cert for the name
  */
 bool Storage::hasClientCert(const QString &name) {
-  settings->beginGroup(clientGroup);
-  auto token = settings->value(name);
-  settings->endGroup();
+  return clientTrust.contains(name);
+}
 
-  return !token.isNull();
+/**
+ * @brief Is the cert the one stored for the client name
+ */
+bool Storage::isClientTrusted(const QString &name, const QSslCertificate &cert) {
+  return clientTrust.isTrusted(name, cert);
 }
 
 /**
- * @brief Get the JWT token for the name
+ * @brief Get the cert for the name
  *
  * @param name
- * @return QString
+ * @return QSslCertificate
  *
  * @throw std::invalid_argument if name not found
  */
-QByteArray Storage::getClientCert(const QString &name) {
-  settings->beginGroup(clientGroup);
-  auto token = settings->value(name);
-  settings->endGroup();
-
-  if (token.isNull()) {
-    throw std::invalid_argument("name not found");
-  }
-
-  return token.toByteArray();
+QSslCertificate Storage::getClientCert(const QString &name) {
+  return clientTrust.certificate(name);
 }
 
 /**
  * @brief Get All Client Certificates
  */
-QList<QByteArray> Storage::getAllClientCert() {
-  QList<QByteArray> list;
-
-  settings->beginGroup(clientGroup);
-  for (auto &name : settings->childKeys()) {
-    auto cert = settings->value(name);
-    list.append(cert.toByteArray());
-  }
-  settings->endGroup();
-
-  return list;
+QList<QSslCertificate> Storage::getAllClientCert() {
+  return clientTrust.certificates();
 }
 
 /**
- * @brief Store the server name and JWT token
+ * @brief Store the server name and cert
  *
  * @param name
- * @param token
+ * @param cert
  */
-void Storage::setServerCert(const QString &name, const QByteArray &token) {
-  settings->beginGroup(serverGroup);
-  settings->setValue(name, token);
-  settings->endGroup();
+void Storage::setServerCert(const QString &name, const QSslCertificate &cert) {
+  // if already trusted
+  if (serverTrust.isTrusted(name, cert)) return;
+
+  // trust and write behind
+  serverTrust.insert(name, cert);
+  serverDirty = true;
+  flushTimer->start();
 }
 
 /**
  * @brief has the cert for the name
  */
 bool Storage::hasServerCert(const QString &name) {
-  settings->beginGroup(serverGroup);
-  auto token = settings->value(name);
-  settings->endGroup();
+  return serverTrust.contains(name);
+}
 
-  return !token.isNull();
+/**
+ * @brief Is the cert the one stored for the server name
+ */
+bool Storage::isServerTrusted(const QString &name, const QSslCertificate &cert) {
+  return serverTrust.isTrusted(name, cert);
+}
+
+/**
+ * @brief Is the fingerprint the one of the cert stored for the server name
+ */
+bool Storage::isServerTrusted(const QString &name, const QByteArray &fingerprint) {
+  return serverTrust.isTrusted(name, fingerprint);
 }
 
 /**
  * @brief Clear the client cert
  */
 void Storage::clearClientCert(const QString &name) {
-  settings->beginGroup(clientGroup);
-  settings->remove(name);
-  settings->endGroup();
+  clientTrust.remove(name);
+  clientDirty = true;
+  flushTimer->start();
 }
 
 /**
  * @brief Clear the client cert
  */
 void Storage::clearAllClientCert() {
-  settings->beginGroup(clientGroup);
-  settings->remove("");
-  settings->endGroup();
+  clientTrust.clear();
+  clientDirty = true;
+  flushTimer->start();
 }
 
 /**
- * @brief Get the JWT token for the name
+ * @brief Get the cert for the name
  *
  * @param name
- * @return QString
+ * @return QSslCertificate
  *
  * @throw std::invalid_argument if name not found
  */
-QByteArray Storage::getServerCert(const QString &name) {
-  settings->beginGroup(serverGroup);
-  auto token = settings->value(name);
-  settings->endGroup();
-
-  if (token.isNull()) {
-    throw std::invalid_argument("name not found");
-  }
-
-  return token.toByteArray();
+QSslCertificate Storage::getServerCert(const QString &name) {
+  return serverTrust.certificate(name);
 }
 
 /**
  * @brief Get All Server Certificates
  */
-QList<QByteArray> Storage::getAllServerCert() {
-  QList<QByteArray> list;
-
-  settings->beginGroup(serverGroup);
-  for (auto &name : settings->childKeys()) {
-    auto cert = settings->value(name);
-    list.append(cert.toByteArray());
-  }
-  settings->endGroup();
-
-  return list;
+QList<QSslCertificate> Storage::getAllServerCert() {
+  return serverTrust.certificates();
 }
 
 /**
  * @brief Clear the server cert
  */
 void Storage::clearServerCert(const QString &name) {
-  settings->beginGroup(serverGroup);
-  settings->remove(name);
-  settings->endGroup();
+  serverTrust.remove(name);
+  serverDirty = true;
+  endpoints.remove(name);
+  endpointDirty = true;
+  flushTimer->start();
 }
 
 /**
  * @brief Clear the server cert
  */
 void Storage::clearAllServerCert() {
-  settings->beginGroup(serverGroup);
-  settings->remove("");
-  settings->endGroup();
+  serverTrust.clear();
+  serverDirty = true;
+  endpoints.clear();
+  endpointDirty = true;
+  flushTimer->start();
+}
+
+/**
+ * @brief Remember the endpoint of the server last connected to
+ *
+ * @param name name of the server
+ * @param addresses all the addresses of the server
+ * @param port port of the server
+ * @param fingerprint fingerprint of the server certificate
+ */
+void Storage::setServerEndpoint(
+  const QString &name, const QList<QHostAddress> &addresses, quint16 port,
+  const QByteArray &fingerprint
+) {
+  // cache and write behind
+  endpoints.insert({name, addresses, port, fingerprint, QDateTime::currentDateTimeUtc()});
+  endpointDirty = true;
+  flushTimer->start();
+}
+
+/**
+ * @brief Get the unexpired server endpoints, most recent first
+ */
+QList<EndpointCache::Endpoint> Storage::getServerEndpoints() {
+  // the endpoint is expired after a while
+  const auto ttl    = constants::getAppEndpointCacheTTL();
+  const auto before = QDateTime::currentDateTimeUtc().addMSecs(-ttl);
+
+  // forget the expired endpoints
+  if (endpoints.expire(before)) {
+    endpointDirty = true;
+    flushTimer->start();
+  }
+
+  // return the endpoints
+  return endpoints.endpoints();
 }
 
 /**
@@ -203,7 +357,7 @@ QSslCertificate Storage::getHostCert() {
  */
 void Storage::setHostKey(const QSslKey &key) {
   settings->beginGroup(commonGroup);
-  settings->setValue(hostKeyKey, key.toPem());
+  settings->setValue(hostKeyKey, utility::functions::toPem(key));
   settings->endGroup();
 }
 
@@ -212,7 +366,7 @@ void Storage::setHostKey(const QSslKey &key) {
  */
 bool Storage::hasHostKey() {
   settings->beginGroup(commonGroup);
-  auto key = QSslKey(settings->value(hostKeyKey).toByteArray(), QSsl::Rsa);
+  auto key = utility::functions::toQSslKey(settings->value(hostKeyKey).toByteArray());
   settings->endGroup();
   return !key.isNull();
 }
@@ -222,7 +376,7 @@ bool Storage::hasHostKey() {
  */
 QSslKey Storage::getHostKey() {
   settings->beginGroup(commonGroup);
-  auto key = QSslKey(settings->value(hostKeyKey).toByteArray(), QSsl::Rsa);
+  auto key = utility::functions::toQSslKey(settings->value(hostKeyKey).toByteArray());
   settings->endGroup();
 
   if (key.isNull()) {
@@ -232,6 +386,34 @@ QSslKey Storage::getHostKey() {
   return key;
 }
 
+/**
+ * @brief Set the algorithm used for new host identities
+ *
+ * @param type
+ */
+void Storage::setHostKeyType(quint32 type) {
+  settings->beginGroup(commonGroup);
+  settings->setValue(hostKeyTypeKey, type);
+  settings->endGroup();
+}
+
+/**
+ * @brief Get the algorithm used for new host identities
+ *
+ * @return quint32 type defaults to ECDSA
+ */
+quint32 Storage::getHostKeyType() {
+  settings->beginGroup(commonGroup);
+  auto type = settings->value(hostKeyTypeKey);
+  settings->endGroup();
+
+  if (type.isNull()) {
+    return types::enums::KeyType::ECDSA;
+  }
+
+  return type.toUInt();
+}
+
 /**
  * @brief Set the current state of the server or client
  *
@@ -260,6 +442,108 @@ bool Storage::getHostIsServer() {
   return isServer.toBool();
 }
 
+/**
+ * @brief Set the codec used to send images
+ *
+ * @param codec
+ */
+void Storage::setImageCodec(quint32 codec) {
+  settings->beginGroup(commonGroup);
+  settings->setValue(imageCodecKey, codec);
+  settings->endGroup();
+}
+
+/**
+ * @brief Get the codec used to send images
+ *
+ * @return quint32 codec defaults to PNG
+ */
+quint32 Storage::getImageCodec() {
+  settings->beginGroup(commonGroup);
+  auto codec = settings->value(imageCodecKey);
+  settings->endGroup();
+
+  if (codec.isNull()) {
+    return types::enums::ImageCodec::PNG;
+  }
+
+  return codec.toUInt();
+}
+
+/**
+ * @brief Set whether large items are promised instead of sent
+ */
+void Storage::setLazySync(bool lazy) {
+  settings->beginGroup(commonGroup);
+  settings->setValue(lazySyncKey, lazy);
+  settings->endGroup();
+}
+
+/**
+ * @brief Get whether large items are promised instead of sent
+ *
+ * @return bool defaults to false
+ */
+bool Storage::getLazySync() {
+  settings->beginGroup(commonGroup);
+  auto lazy = settings->value(lazySyncKey, false);
+  settings->endGroup();
+  return lazy.toBool();
+}
+
+/**
+ * @brief Set the bytes of history payloads kept in memory
+ */
+void Storage::setHistoryMemoryBudget(quint64 budget) {
+  settings->beginGroup(commonGroup);
+  settings->setValue(historyBudgetKey, budget);
+  settings->endGroup();
+}
+
+/**
+ * @brief Get the bytes of history payloads kept in memory
+ *
+ * @return quint64 defaults to getAppHistoryMemoryBudget
+ */
+quint64 Storage::getHistoryMemoryBudget() {
+  settings->beginGroup(commonGroup);
+  auto budget = settings->value(historyBudgetKey);
+  settings->endGroup();
+
+  if (budget.isNull()) {
+    return constants::getAppHistoryMemoryBudget();
+  }
+
+  return budget.toULongLong();
+}
+
+/**
+ * @brief Set the max number of history entries, used from the
+ * next start
+ */
+void Storage::setHistorySize(int size) {
+  settings->beginGroup(commonGroup);
+  settings->setValue(historySizeKey, size);
+  settings->endGroup();
+}
+
+/**
+ * @brief Get the max number of history entries
+ *
+ * @return int defaults to getAppMaxHistorySize
+ */
+int Storage::getHistorySize() {
+  settings->beginGroup(commonGroup);
+  auto size = settings->value(historySizeKey);
+  settings->endGroup();
+
+  if (size.isNull() || size.toInt() <= 0) {
+    return constants::getAppMaxHistorySize();
+  }
+
+  return size.toInt();
+}
+
 /**
  * @brief Instance of the storage
  */
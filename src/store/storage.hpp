@@ -1,9 +1,17 @@
 #pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
 
+#include <QCoreApplication>
 #include <QSslCertificate>
 #include <QSslKey>
 #include <QObject>
 #include <QSettings>
+#include <QTimer>
+
+#include "constants/constants.hpp"
+#include "store/endpointcache/endpointcache.hpp"
+#include "store/truststore/truststore.hpp"
+#include "types/enums/enums.hpp"
+#include "utility/functions/sslcert/sslcert.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::storage {
 class Storage : public QObject {
@@ -11,19 +19,38 @@ class Storage : public QObject {
 
   QSettings *settings = new QSettings("srilakshmikanthanp", "clipbird", this);
 
+ private:  // trusted certificates
+
+  TrustStore clientTrust;
+  TrustStore serverTrust;
+  bool clientDirty = false;
+  bool serverDirty = false;
+  QTimer *flushTimer = new QTimer(this);
+
+ private:  // server endpoints
+
+  EndpointCache endpoints{constants::getAppEndpointCacheSize()};
+  bool endpointDirty = false;
+
  private:  // groups
 
   const char *clientGroup = "client";
   const char *commonGroup = "common";
   const char *serverGroup = "server";
+  const char *endpointGroup = "endpoint";
 
  private:  // keys
 
   const char *hostStateKey       = "hostState";
   const char *hostKeyKey         = "hostKey";
   const char *hostCertificateKey = "hostCert";
+  const char *hostKeyTypeKey     = "hostKeyType";
   const char *proxyKey           = "proxy";
   const char *easyHideKey        = "easyHide";
+  const char *imageCodecKey      = "imageCodec";
+  const char *lazySyncKey        = "lazySync";
+  const char *historyBudgetKey   = "historyBudget";
+  const char *historySizeKey     = "historySize";
 
  private:  // qt
 
@@ -40,23 +67,57 @@ class Storage : public QObject {
 
   Q_DISABLE_COPY_MOVE(Storage)
 
+ private:  // trusted certificates
+
+  /**
+   * @brief Parse the certificates of the group to the trust store
+   */
+  void loadTrust(const char *group, TrustStore &trust);
+
+  /**
+   * @brief Write the certificates of the trust store to the group
+   */
+  void saveTrust(const char *group, const TrustStore &trust);
+
+  /**
+   * @brief Write the changed trust stores to the settings
+   */
+  void flushTrust();
+
+ private:  // server endpoints
+
+  /**
+   * @brief Parse the server endpoints of the group to the cache
+   */
+  void loadEndpoints();
+
+  /**
+   * @brief Write the server endpoints of the cache to the group
+   */
+  void flushEndpoints();
+
  public:  // methods
 
   /**
    * @brief Destroy the SQLStore object
    */
-  virtual ~Storage() = default;
+  virtual ~Storage();
 
   /**
-   * @brief Store Client name and JWT cert
+   * @brief Store Client name and cert
    */
-  void setClientCert(const QString &name, const QByteArray &cert);
+  void setClientCert(const QString &name, const QSslCertificate &cert);
 
   /**
    * @brief has the cert for the name
    */
   bool hasClientCert(const QString &name);
 
+  /**
+   * @brief Is the cert the one stored for the client name
+   */
+  bool isClientTrusted(const QString &name, const QSslCertificate &cert);
+
   /**
    * @brief Clear the client cert
    */
@@ -68,25 +129,35 @@ class Storage : public QObject {
   void clearAllClientCert();
 
   /**
-   * @brief Get the JWT cert for the name
+   * @brief Get the cert for the name
    */
-  QByteArray getClientCert(const QString &name);
+  QSslCertificate getClientCert(const QString &name);
 
   /**
    * @brief Get All Client Certificates
    */
-  QList<QByteArray> getAllClientCert();
+  QList<QSslCertificate> getAllClientCert();
 
   /**
-   * @brief Store the server name and JWT cert
+   * @brief Store the server name and cert
    */
-  void setServerCert(const QString &name, const QByteArray &cert);
+  void setServerCert(const QString &name, const QSslCertificate &cert);
 
   /**
    * @brief has the cert for the name
    */
   bool hasServerCert(const QString &name);
 
+  /**
+   * @brief Is the cert the one stored for the server name
+   */
+  bool isServerTrusted(const QString &name, const QSslCertificate &cert);
+
+  /**
+   * @brief Is the fingerprint the one of the cert stored for the server name
+   */
+  bool isServerTrusted(const QString &name, const QByteArray &fingerprint);
+
   /**
    * @brief Clear the server cert
    */
@@ -98,14 +169,27 @@ class Storage : public QObject {
   void clearAllServerCert();
 
   /**
-   * @brief Get the JWT cert for the name
+   * @brief Get the cert for the name
    */
-  QByteArray getServerCert(const QString &name);
+  QSslCertificate getServerCert(const QString &name);
 
   /**
    * @brief Get All Server Certificates
    */
-  QList<QByteArray> getAllServerCert();
+  QList<QSslCertificate> getAllServerCert();
+
+  /**
+   * @brief Remember the endpoint of the server last connected to
+   */
+  void setServerEndpoint(
+    const QString &name, const QList<QHostAddress> &addresses, quint16 port,
+    const QByteArray &fingerprint
+  );
+
+  /**
+   * @brief Get the unexpired server endpoints, most recent first
+   */
+  QList<EndpointCache::Endpoint> getServerEndpoints();
 
   /**
    * @brief Set the current state of the server or client
@@ -147,6 +231,56 @@ class Storage : public QObject {
    */
   QSslKey getHostKey();
 
+  /**
+   * @brief Set the algorithm used for new host identities
+   */
+  void setHostKeyType(quint32 type);
+
+  /**
+   * @brief Get the algorithm used for new host identities
+   */
+  quint32 getHostKeyType();
+
+  /**
+   * @brief Set the codec used to send images
+   */
+  void setImageCodec(quint32 codec);
+
+  /**
+   * @brief Get the codec used to send images
+   */
+  quint32 getImageCodec();
+
+  /**
+   * @brief Set whether large items are promised instead of sent
+   */
+  void setLazySync(bool lazy);
+
+  /**
+   * @brief Get whether large items are promised instead of sent
+   */
+  bool getLazySync();
+
+  /**
+   * @brief Set the bytes of history payloads kept in memory
+   */
+  void setHistoryMemoryBudget(quint64 budget);
+
+  /**
+   * @brief Get the bytes of history payloads kept in memory
+   */
+  quint64 getHistoryMemoryBudget();
+
+  /**
+   * @brief Set the max number of history entries
+   */
+  void setHistorySize(int size);
+
+  /**
+   * @brief Get the max number of history entries
+   */
+  int getHistorySize();
+
   /**
    * @brief Instance of the storage
    */
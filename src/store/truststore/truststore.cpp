@@ -0,0 +1,128 @@
+#include "truststore.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief SHA-256 fingerprint of the certificate
+ */
+QByteArray TrustStore::fingerprintOf(const QSslCertificate &cert) {
+  return cert.digest(QCryptographicHash::Sha256);
+}
+
+/**
+ * @brief Trust the certificate for the name replacing the old one
+ */
+void TrustStore::insert(const QString &name, const QSslCertificate &cert) {
+  // forget the old certificate
+  this->remove(name);
+
+  // index by name and fingerprint
+  const auto fingerprint = fingerprintOf(cert);
+  m_byName.insert(name, {cert, fingerprint});
+  m_byFingerprint.insert(fingerprint, name);
+}
+
+/**
+ * @brief Remove the certificate of the name
+ */
+void TrustStore::remove(const QString &name) {
+  // find the entry
+  auto it = m_byName.find(name);
+
+  // if not found
+  if (it == m_byName.end()) return;
+
+  // the fingerprint may be trusted for other name too
+  m_byFingerprint.remove(it->fingerprint, name);
+
+  // forget the entry
+  m_byName.erase(it);
+}
+
+/**
+ * @brief Remove all the certificates
+ */
+void TrustStore::clear() {
+  m_byName.clear();
+  m_byFingerprint.clear();
+}
+
+/**
+ * @brief Is there a certificate for the name
+ */
+bool TrustStore::contains(const QString &name) const {
+  return m_byName.contains(name);
+}
+
+/**
+ * @brief Is the certificate trusted
+ */
+bool TrustStore::contains(const QSslCertificate &cert) const {
+  return m_byFingerprint.contains(fingerprintOf(cert));
+}
+
+/**
+ * @brief Is the certificate the one trusted for the name
+ */
+bool TrustStore::isTrusted(const QString &name, const QSslCertificate &cert) const {
+  return isTrusted(name, fingerprintOf(cert));
+}
+
+/**
+ * @brief Is the fingerprint of the certificate trusted for the name
+ */
+bool TrustStore::isTrusted(const QString &name, const QByteArray &fingerprint) const {
+  // find the entry
+  auto it = m_byName.constFind(name);
+
+  // compare the fingerprints
+  return it != m_byName.cend() && it->fingerprint == fingerprint;
+}
+
+/**
+ * @brief Get the certificate of the name
+ *
+ * @throw std::invalid_argument if name not found
+ */
+QSslCertificate TrustStore::certificate(const QString &name) const {
+  // find the entry
+  auto it = m_byName.constFind(name);
+
+  // if not found
+  if (it == m_byName.cend()) {
+    throw std::invalid_argument("name not found");
+  }
+
+  // return the certificate
+  return it->cert;
+}
+
+/**
+ * @brief All the trusted certificates
+ */
+QList<QSslCertificate> TrustStore::certificates() const {
+  // certificates
+  QList<QSslCertificate> certs;
+  certs.reserve(m_byName.size());
+
+  for (const auto &entry : m_byName) {
+    certs.append(entry.cert);
+  }
+
+  // return the certificates
+  return certs;
+}
+
+/**
+ * @brief Names that have a certificate
+ */
+QStringList TrustStore::names() const {
+  return m_byName.keys();
+}
+
+/**
+ * @brief Number of trusted certificates
+ */
+qsizetype TrustStore::size() const {
+  return m_byName.size();
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::storage
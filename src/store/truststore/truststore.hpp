@@ -0,0 +1,100 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QHash>
+#include <QMultiHash>
+#include <QList>
+#include <QSslCertificate>
+#include <QString>
+#include <QStringList>
+
+// C++ header
+#include <stdexcept>
+
+namespace srilakshmikanthanp::clipbirdesk::storage {
+/**
+ * @brief In memory index of the trusted certificates by the device
+ * name and by the SHA-256 fingerprint, the certificates are parsed
+ * once when they are added so checking a peer is a hash lookup
+ */
+class TrustStore {
+ private:  // types
+
+  /// @brief trusted certificate and its fingerprint
+  struct Entry {
+    QSslCertificate cert;
+    QByteArray fingerprint;
+  };
+
+ private:  // members
+
+  QHash<QString, Entry> m_byName;
+  QMultiHash<QByteArray, QString> m_byFingerprint;
+
+ public:  // functions
+
+  /**
+   * @brief SHA-256 fingerprint of the certificate
+   */
+  static QByteArray fingerprintOf(const QSslCertificate &cert);
+
+  /**
+   * @brief Trust the certificate for the name replacing the old one
+   */
+  void insert(const QString &name, const QSslCertificate &cert);
+
+  /**
+   * @brief Remove the certificate of the name
+   */
+  void remove(const QString &name);
+
+  /**
+   * @brief Remove all the certificates
+   */
+  void clear();
+
+  /**
+   * @brief Is there a certificate for the name
+   */
+  bool contains(const QString &name) const;
+
+  /**
+   * @brief Is the certificate trusted
+   */
+  bool contains(const QSslCertificate &cert) const;
+
+  /**
+   * @brief Is the certificate the one trusted for the name
+   */
+  bool isTrusted(const QString &name, const QSslCertificate &cert) const;
+
+  /**
+   * @brief Is the fingerprint of the certificate trusted for the name
+   */
+  bool isTrusted(const QString &name, const QByteArray &fingerprint) const;
+
+  /**
+   * @brief Get the certificate of the name
+   *
+   * @throw std::invalid_argument if name not found
+   */
+  QSslCertificate certificate(const QString &name) const;
+
+  /**
+   * @brief All the trusted certificates
+   */
+  QList<QSslCertificate> certificates() const;
+
+  /**
+   * @brief Names that have a certificate
+   */
+  QStringList names() const;
+
+  /**
+   * @brief Number of trusted certificates
+   */
+  qsizetype size() const;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::storage
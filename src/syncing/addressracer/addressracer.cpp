@@ -0,0 +1,199 @@
+#include "addressracer.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::syncing {
+/**
+ * @brief Start the attempt to the next address
+ */
+void AddressRacer::startNext() {
+  // if all the addresses are attempted
+  if (m_next >= m_addresses.size()) {
+    return m_stagger->stop();
+  }
+
+  // address to attempt
+  const auto address = m_addresses.at(m_next++);
+  auto socket        = new QTcpSocket(this);
+
+  // on connected
+  connect(socket, &QTcpSocket::connected, this, [=] {
+    this->handleConnected(address);
+  });
+
+  // on error
+  connect(socket, &QTcpSocket::errorOccurred, this, [=] {
+    this->handleFailed(socket);
+  });
+
+  // track the attempt
+  m_attempts.append(socket);
+
+  // start the attempt
+  socket->connectToHost(address, m_port);
+
+  // next attempt if this one is slow
+  m_stagger->start(constants::getAppConnectAttemptDelay());
+}
+
+/**
+ * @brief Handle the attempt that connected
+ */
+void AddressRacer::handleConnected(QHostAddress address) {
+  // close all the probes
+  this->cancel();
+
+  // report the winner
+  emit OnWinner(address);
+}
+
+/**
+ * @brief Handle the attempt that failed
+ */
+void AddressRacer::handleFailed(QTcpSocket* socket) {
+  // forget the attempt
+  m_attempts.removeOne(socket);
+  socket->deleteLater();
+
+  // failure starts the next attempt at once
+  if (m_next < m_addresses.size()) {
+    return this->startNext();
+  }
+
+  // if some attempts are still in flight
+  if (!m_attempts.isEmpty()) {
+    return;
+  }
+
+  // all failed
+  this->cancel();
+
+  // report the failure
+  emit OnFailed();
+}
+
+/**
+ * @brief Construct a new Address Racer object
+ *
+ * @param parent parent object
+ */
+AddressRacer::AddressRacer(QObject* parent) : QObject(parent) {
+  // stagger and deadline fire once
+  m_stagger->setSingleShot(true);
+  m_deadline->setSingleShot(true);
+
+  // start the next attempt
+  connect(m_stagger, &QTimer::timeout, this, &AddressRacer::startNext);
+
+  // give up the race
+  connect(m_deadline, &QTimer::timeout, this, [this] {
+    this->cancel(); emit OnFailed();
+  });
+}
+
+/**
+ * @brief Destroy the Address Racer object
+ */
+AddressRacer::~AddressRacer() {
+  this->cancel();
+}
+
+/**
+ * @brief Order the addresses for the race, the preferred address
+ * first then the families interleaved starting with the other family
+ * or IPv6 as RFC 8305 suggests
+ *
+ * @param addresses addresses of the server
+ * @param preferred address that won last time if any
+ *
+ * @return ordered addresses
+ */
+QList<QHostAddress> AddressRacer::order(
+  const QList<QHostAddress>& addresses, const std::optional<QHostAddress>& preferred
+) {
+  // addresses by family
+  QList<QHostAddress> ipv4, ipv6, ordered;
+
+  // preferred address goes first
+  if (preferred.has_value() && addresses.contains(*preferred)) {
+    ordered.append(*preferred);
+  }
+
+  // split by family
+  for (const auto& address : addresses) {
+    if (ordered.contains(address)) continue;
+    if (address.protocol() == QAbstractSocket::IPv4Protocol) {
+      ipv4.append(address);
+    } else {
+      ipv6.append(address);
+    }
+  }
+
+  // family to start with, the other one of the preferred
+  bool isIPv4 = !ordered.isEmpty() && ordered.first().protocol() != QAbstractSocket::IPv4Protocol;
+
+  // interleave the families
+  while (!ipv4.isEmpty() || !ipv6.isEmpty()) {
+    auto& family = (isIPv4 && !ipv4.isEmpty()) || ipv6.isEmpty() ? ipv4 : ipv6;
+    ordered.append(family.takeFirst());
+    isIPv4 = !isIPv4;
+  }
+
+  // return the ordered addresses
+  return ordered;
+}
+
+/**
+ * @brief Race the connections to the addresses in the given
+ * order, any race in flight is cancelled
+ *
+ * @param addresses ordered addresses
+ * @param port port of the server
+ */
+void AddressRacer::race(const QList<QHostAddress>& addresses, quint16 port) {
+  // cancel the race in flight
+  this->cancel();
+
+  // set the race
+  m_addresses = addresses;
+  m_port      = port;
+  m_next      = 0;
+
+  // if nothing to race
+  if (m_addresses.isEmpty()) {
+    emit OnFailed(); return;
+  }
+
+  // give up after a while
+  m_deadline->start(constants::getAppConnectRaceTimeout());
+
+  // start the first attempt
+  this->startNext();
+}
+
+/**
+ * @brief Cancel the race in flight if any
+ */
+void AddressRacer::cancel() {
+  // stop the timers
+  m_stagger->stop();
+  m_deadline->stop();
+
+  // close the probes
+  for (auto socket : std::as_const(m_attempts)) {
+    socket->disconnect(this);
+    socket->abort();
+    socket->deleteLater();
+  }
+
+  // clear the race
+  m_attempts.clear();
+  m_addresses.clear();
+  m_next = 0;
+}
+
+/**
+ * @brief Is a race in flight
+ */
+bool AddressRacer::isRacing() const {
+  return !m_attempts.isEmpty();
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::network::syncing
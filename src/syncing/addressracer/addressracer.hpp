@@ -0,0 +1,124 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt headers
+#include <QHostAddress>
+#include <QList>
+#include <QObject>
+#include <QTcpSocket>
+#include <QTimer>
+
+// C++ headers
+#include <optional>
+
+// Local headers
+#include "constants/constants.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::syncing {
+/**
+ * @brief Races TCP connections to the addresses of a server with
+ * staggered starts like RFC 8305 Happy Eyeballs and reports the
+ * first address that accepted, the probe connections are closed
+ */
+class AddressRacer : public QObject {
+ signals:  // signals for this class
+  /// @brief On the first address that accepted the connection
+  void OnWinner(QHostAddress address);
+
+  /// @brief On none of the addresses accepted the connection
+  void OnFailed();
+
+ private:  // just for Qt
+
+  /// @brief Qt meta object
+  Q_OBJECT
+
+ private:  // disable copy and move
+
+  /// @brief Disable copy and move
+  Q_DISABLE_COPY_MOVE(AddressRacer)
+
+ private:  // Member variables
+
+  /// @brief addresses in the order of the attempts
+  QList<QHostAddress> m_addresses;
+
+  /// @brief port of the server
+  quint16 m_port = 0;
+
+  /// @brief index of the next address to attempt
+  qsizetype m_next = 0;
+
+  /// @brief connection attempts in flight
+  QList<QTcpSocket*> m_attempts;
+
+  /// @brief starts the next attempt if the current is slow
+  QTimer* m_stagger = new QTimer(this);
+
+  /// @brief gives up the race
+  QTimer* m_deadline = new QTimer(this);
+
+ private:  // private functions
+
+  /**
+   * @brief Start the attempt to the next address
+   */
+  void startNext();
+
+  /**
+   * @brief Handle the attempt that connected
+   */
+  void handleConnected(QHostAddress address);
+
+  /**
+   * @brief Handle the attempt that failed
+   */
+  void handleFailed(QTcpSocket* socket);
+
+ public:
+
+  /**
+   * @brief Construct a new Address Racer object
+   *
+   * @param parent parent object
+   */
+  explicit AddressRacer(QObject* parent = nullptr);
+
+  /**
+   * @brief Destroy the Address Racer object
+   */
+  ~AddressRacer() override;
+
+  /**
+   * @brief Order the addresses for the race, the preferred address
+   * first then the families interleaved starting with the other family
+   * or IPv6 as RFC 8305 suggests
+   *
+   * @param addresses addresses of the server
+   * @param preferred address that won last time if any
+   *
+   * @return ordered addresses
+   */
+  static QList<QHostAddress> order(
+    const QList<QHostAddress>& addresses, const std::optional<QHostAddress>& preferred
+  );
+
+  /**
+   * @brief Race the connections to the addresses in the given
+   * order, any race in flight is cancelled
+   *
+   * @param addresses ordered addresses
+   * @param port port of the server
+   */
+  void race(const QList<QHostAddress>& addresses, quint16 port);
+
+  /**
+   * @brief Cancel the race in flight if any
+   */
+  void cancel();
+
+  /**
+   * @brief Is a race in flight
+   */
+  bool isRacing() const;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::network::syncing
@@ -115,6 +115,10 @@ void Client::processAuthentication(const packets::Authentication& packet) {
   auto name = cert.subjectInfo(QSslCertificate::CommonName).constFirst();
   auto host = types::Device({addr, port, name});
 
+  // no longer dialing the last known endpoint
+  m_cached.reset();
+  m_cachedTimer->stop();
+
   // emit the signal
   emit OnServerStatusChanged(true, host);
 
@@ -178,6 +182,11 @@ void Client::processSyncingPacket(const packets::SyncingPacket& packet) {
     if (i.getPayloadLength()) items.append({i.getMimeType().toStdString().c_str(), i.getPayload()});;
   }
 
+  // the items before a stream are applied with the files
+  if (packet.getPacketType() == packets::SyncingPacket::PacketType::StreamItems) {
+    return m_fileReceiver->setItems(items);
+  }
+
   // is empty list
   if (items.isEmpty()) return;
 
@@ -185,6 +194,164 @@ void Client::processSyncingPacket(const packets::SyncingPacket& packet) {
   emit OnSyncRequest(items);
 }
 
+/**
+ * @brief Process the promise that has been received
+ * from the server and emit the signal
+ *
+ * @param packet Promise packet
+ */
+void Client::processPromisePacket(const packets::PromisePacket& packet) {
+  // known items and promised items
+  QVector<QPair<QString, QByteArray>> items;
+  QVector<QPair<QString, quint64>> promised;
+
+  // Get the items from the packet
+  for (auto i : packet.getItems()) {
+    const auto mime = QString::fromUtf8(i.getMimeType());
+    if (i.isLazy()) {
+      promised.append({mime, i.getPayloadHash()});
+    } else if (i.getPayloadLength()) {
+      items.append({mime, i.getPayload()});
+    }
+  }
+
+  // is empty list
+  if (items.isEmpty() && promised.isEmpty()) return;
+
+  // history entry is only added to the history
+  if (packet.getPacketType() == packets::PromisePacket::PacketType::HistoryPromise) {
+    return emit OnHistoryEntry(packet.getPromiseId(), items, promised, m_serverHistory);
+  }
+
+  // emit the signal
+  emit OnPromiseRequest(packet.getPromiseId(), items, promised);
+}
+
+/**
+ * @brief Process the history summary that has been received
+ * from the server and emit the signal
+ *
+ * @param packet History summary packet
+ */
+void Client::processHistorySummaryPacket(const packets::HistorySummaryPacket& packet) {
+  // remember the history of the server to place its entries
+  m_serverHistory = packet.getEntries();
+
+  // emit the signal
+  emit OnHistorySummary(packet.getEntries(), packet.getFreeSlots());
+}
+
+/**
+ * @brief Process the features of the server and answer
+ * with the features of the client
+ *
+ * @param packet Capability packet
+ */
+void Client::processCapabilityPacket(const packets::CapabilityPacket& packet) {
+  // using CapabilityPacket
+  using packets::CapabilityPacket;
+
+  // remember the features of the server
+  m_serverFeatures = packet.getFeatures();
+
+  // tell the server the features of the client
+  this->sendPacket(utility::functions::createPacket(utility::functions::params::CapabilityPacketParams{
+    CapabilityPacket::PacketType::Capability, constants::getAppFeatures()
+  }));
+}
+
+/**
+ * @brief Does the server understand the feature, servers
+ * that predate the capability packet understand none
+ */
+bool Client::hasFeature(types::enums::Feature feature) const {
+  return m_serverFeatures & feature;
+}
+
+/**
+ * @brief Process the payload request or response that
+ * has been received from the server
+ *
+ * @param packet Payload packet
+ */
+void Client::processPayloadPacket(const packets::PayloadPacket& packet) {
+  // using PayloadPacket
+  using packets::PayloadPacket;
+
+  // get the promise id and mime type
+  const auto id   = packet.getPromiseId();
+  const auto mime = QString::fromUtf8(packet.getMimeType());
+
+  // if it is response then notify the waiting fetch
+  if (packet.getPacketType() == PayloadPacket::PacketType::PayloadResponse) {
+    this->resolveFetch(id, mime, packet.getPayload());
+    return emit OnPayloadReceived(id, mime, packet.getPayload());
+  }
+
+  // get the payload, empty payload tells not available
+  const auto payload = this->getPromisedPayload(id, mime);
+
+  // create the response packet
+  auto response = utility::functions::createPacket(utility::functions::params::PayloadPacketParams{
+    PayloadPacket::PacketType::PayloadResponse, id, mime, payload
+  });
+
+  // send the response to the server
+  this->sendPacket(response);
+}
+
+/**
+ * @brief Call the callbacks of the fetch with the payload
+ *
+ * @param id promise id
+ * @param mime mime type
+ * @param payload payload or empty on failure
+ */
+void Client::resolveFetch(quint64 id, const QString& mime, const QByteArray& payload) {
+  for (const auto& callback : m_fetches.take(qMakePair(id, mime)).callbacks) {
+    callback(payload);
+  }
+}
+
+/**
+ * @brief Get the payload of the item that is promised by
+ * this client
+ *
+ * @return payload or empty if not found
+ */
+QByteArray Client::getPromisedPayload(quint64 id, const QString& mime) const {
+  for (auto promises : {&m_promises, &m_historyPromises}) {
+    for (const auto& [promiseId, items] : *promises) {
+      if (promiseId != id) continue;
+      for (const auto& [m, data] : items) {
+        if (m == mime) return data;
+      }
+    }
+  }
+
+  return QByteArray();
+}
+
+/**
+ * @brief Process the chunk of the files that are streamed
+ * from the server
+ *
+ * @param packet File stream packet
+ */
+void Client::processFileStreamPacket(const packets::FileStreamPacket& packet) {
+  m_fileReceiver->processPacket(packet);
+}
+
+/**
+ * @brief Process the files that are received from the
+ * server and emit the signal
+ *
+ * @param files local urls of the received files
+ */
+void Client::processFilesReceived(const QList<QUrl>& files) {
+  emit OnSyncRequest(QVector<QPair<QString, QByteArray>>{{"text/uri-list", FileReceiver::toUriList(files)}} + m_fileReceiver->takeItems());
+}
+
 /**
  * @brief Process Disconnection
  */
@@ -196,6 +363,18 @@ void Client::processDisconnection() {
   auto name = cert.subjectInfo(QSslCertificate::CommonName).constFirst();
   auto host = types::Device({addr, port, name});
 
+  // the next server tells its own features
+  m_serverFeatures = 0;
+
+  // the catch-up ends with the session
+  m_historyPromises.clear();
+  m_serverHistory.clear();
+
+  // fail the fetches in flight
+  for (const auto& key : m_fetches.keys()) {
+    this->resolveFetch(key.first, key.second, QByteArray());
+  }
+
   // emit the signal
   emit OnServerStatusChanged(false, host);
 
@@ -211,69 +390,165 @@ void Client::processDisconnection() {
  * from the server
  */
 void Client::processReadyRead() {
-  // using fromQByteArray to parse the packet
-  using utility::functions::fromQByteArray;
-
   // set the last read time property
   m_ssl_socket->setProperty(READ_TIME, QDateTime::currentDateTime());
 
   // get the first four bytes of the packet
   QDataStream get(m_ssl_socket);
 
-  // QByteArray to store the data
-  QByteArray data;
+  // process all the complete packets that are buffered
+  while (m_ssl_socket->bytesAvailable() > 0) {
+    // QByteArray to store the data
+    QByteArray data;
+
+    /// uploader QDataStream
+    QDataStream put(&data, QIODevice::WriteOnly);
+
+    // start the transaction
+    get.startTransaction();
+
+    // get the packet length
+    qint32 packetLength;
+
+    // read the packet length
+    get >> packetLength;
+
+    // write the packet length
+    put << packetLength;
+
+    // infer the read size
+    auto toRead = packetLength - data.length();
+
+    // check has enough bytes
+    if (m_ssl_socket->bytesAvailable() < toRead) {
+      return get.rollbackTransaction();
+    }
 
-  /// uploader QDataStream
-  QDataStream put(&data, QIODevice::WriteOnly);
+    // resize the data
+    data.resize(packetLength);
 
-  // start the transaction
-  get.startTransaction();
+    // read the data from the socket
+    auto start = data.data() + data.size() - toRead;
+    auto bytes = get.readRawData(start, toRead);
 
-  // get the packet length
-  qint32 packetLength;
+    // check for error
+    if (bytes == -1) {
+      return get.rollbackTransaction();
+    }
 
-  // read the packet length
-  get >> packetLength;
+    // update the toRead
+    toRead -= bytes;
 
-  // write the packet length
-  put << packetLength;
+    // if toRead is not zero then return
+    if (toRead) {
+      return get.rollbackTransaction();
+    }
 
-  // infer the read size
-  auto toRead = packetLength - data.length();
+    // commit the transaction
+    if (!get.commitTransaction()) {
+      return;
+    }
 
-  // check has enough bytes
-  if (m_ssl_socket->bytesAvailable() < toRead) {
-    return get.rollbackTransaction();
+    // process the packet
+    this->processPacket(data);
   }
+}
 
-  // resize the data
-  data.resize(packetLength);
+/**
+ * @brief Parse the packet and process it
+ */
+void Client::processPacket(const QByteArray &data) {
+  // using fromQByteArray to parse the packet
+  using utility::functions::fromQByteArray;
 
-  // read the data from the socket
-  auto start = data.data() + data.size() - toRead;
-  auto bytes = get.readRawData(start, toRead);
+  // try to parse the packet
+  try {
+    processAuthentication(fromQByteArray<packets::Authentication>(data));
+    return;
+  } catch (const types::except::MalformedPacket& e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (const types::except::NotThisPacket& e) {
+    qDebug() << (LOG(e.what()));
+  } catch (const std::exception& e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (...) {
+    qDebug() << (LOG("Unknown Error"));
+    return;
+  }
 
-  // check for error
-  if (bytes == -1) {
-    return get.rollbackTransaction();
+  // try to parse the packet
+  try {
+    processSyncingPacket(fromQByteArray<packets::SyncingPacket>(data));
+    return;
+  } catch (const types::except::MalformedPacket& e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (const types::except::NotThisPacket& e) {
+    qDebug() << (LOG(e.what()));
+  } catch (const std::exception& e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (...) {
+    qDebug() << (LOG("Unknown Error"));
+    return;
   }
 
-  // update the toRead
-  toRead -= bytes;
+  // try to parse the packet
+  try {
+    processPingPacket(fromQByteArray<packets::PingPacket>(data));
+    return;
+  } catch (const types::except::MalformedPacket& e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (const types::except::NotThisPacket& e) {
+    qDebug() << (LOG(e.what()));
+  } catch (const std::exception& e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (...) {
+    qDebug() << (LOG("Unknown Error"));
+    return;
+  }
 
-  // if toRead is not zero then return
-  if (toRead) {
-    return get.rollbackTransaction();
+  // try to parse the packet
+  try {
+    processFileStreamPacket(fromQByteArray<packets::FileStreamPacket>(data));
+    return;
+  } catch (const types::except::MalformedPacket& e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (const types::except::NotThisPacket& e) {
+    qDebug() << (LOG(e.what()));
+  } catch (const std::exception& e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (...) {
+    qDebug() << (LOG("Unknown Error"));
+    return;
   }
 
-  // commit the transaction
-  if (!get.commitTransaction()) {
+  // try to parse the packet
+  try {
+    processPromisePacket(fromQByteArray<packets::PromisePacket>(data));
+    return;
+  } catch (const types::except::MalformedPacket& e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (const types::except::NotThisPacket& e) {
+    qDebug() << (LOG(e.what()));
+  } catch (const std::exception& e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (...) {
+    qDebug() << (LOG("Unknown Error"));
     return;
   }
 
   // try to parse the packet
   try {
-    processAuthentication(fromQByteArray<packets::Authentication>(data));
+    processHistorySummaryPacket(fromQByteArray<packets::HistorySummaryPacket>(data));
     return;
   } catch (const types::except::MalformedPacket& e) {
     qDebug() << (LOG(e.what()));
@@ -290,7 +565,7 @@ void Client::processReadyRead() {
 
   // try to parse the packet
   try {
-    processSyncingPacket(fromQByteArray<packets::SyncingPacket>(data));
+    processCapabilityPacket(fromQByteArray<packets::CapabilityPacket>(data));
     return;
   } catch (const types::except::MalformedPacket& e) {
     qDebug() << (LOG(e.what()));
@@ -307,7 +582,7 @@ void Client::processReadyRead() {
 
   // try to parse the packet
   try {
-    processPingPacket(fromQByteArray<packets::PingPacket>(data));
+    processPayloadPacket(fromQByteArray<packets::PayloadPacket>(data));
     return;
   } catch (const types::except::MalformedPacket& e) {
     qDebug() << (LOG(e.what()));
@@ -379,6 +654,30 @@ void Client::processPongTimeout() {
   }
 }
 
+/**
+ * @brief Give up the dial of the last known endpoint that
+ * is not authenticated in time
+ */
+void Client::processCachedTimeout() {
+  // if not dialing the last known endpoint
+  if (!m_cached.has_value()) return;
+
+  // the server of the dial
+  const auto server  = *m_cached;
+
+  // a reached server reports its disconnection instead
+  const auto reached = !this->isConnecting();
+
+  // log the timeout
+  qInfo() << (LOG("Last known server timed out: " + server.name.toStdString()));
+
+  // stop dialing
+  this->cancelCachedServer();
+
+  // the server is not reachable
+  if (!reached) emit OnCachedServerFailed(server);
+}
+
 /**
  * @brief Construct a new Syncing Client object
  * and connect the signals and slots and start
@@ -388,10 +687,30 @@ void Client::processPongTimeout() {
  * @param parent Parent
  */
 Client::Client(QObject* parent) : service::mdnsBrowser(parent) {
+  // connect to the address that won the race
+  connect(
+    m_racer, &AddressRacer::OnWinner,
+    this, &Client::handleRaceWinner
+  );
+
+  // fallback to the primary address
+  connect(
+    m_racer, &AddressRacer::OnFailed,
+    this, &Client::handleRaceFailed
+  );
+
   // connect the signals and slots for the errorOccurred
   connect(
     m_ssl_socket, &QSslSocket::errorOccurred,
     [=]{
+      // the last known endpoint is not reachable, the user is not told
+      if (auto server = std::exchange(m_cached, std::nullopt)) {
+        qInfo() << (LOG(this->m_ssl_socket->errorString().toStdString()));
+        m_cachedTimer->stop();
+        return emit OnCachedServerFailed(*server);
+      }
+
+      // notify the error
       this->OnConnectionError(this->m_ssl_socket->errorString());
     }
   );
@@ -423,6 +742,23 @@ Client::Client(QObject* parent) : service::mdnsBrowser(parent) {
     m_pongTimer, &QTimer::timeout,
     this, &Client::processPongTimeout
   );
+
+  // the dial of the last known endpoint is given up once
+  m_cachedTimer->setSingleShot(true);
+
+  // Connect the timer to the callback function that
+  // gives up the dial of the last known endpoint
+  QObject::connect(
+    m_cachedTimer, &QTimer::timeout,
+    this, &Client::processCachedTimeout
+  );
+
+  // Connect the file receiver to the callback function
+  // that process the received files
+  QObject::connect(
+    m_fileReceiver, &FileReceiver::OnFilesReceived,
+    this, &Client::processFilesReceived
+  );
 }
 
 /**
@@ -452,16 +788,269 @@ void Client::syncItems(QVector<QPair<QString, QByteArray>> items) {
   }
 
   // using createPacket to create the packet
+  using packets::PromisePacket;
   using packets::SyncingPacket;
   using utility::functions::createPacket;
 
-  // create the packet
-  SyncingPacket packet = createPacket({
-    SyncingPacket::PacketType::SyncPacket, items
+  // QOI images as PNG if the server can't decode them
+  if (!this->hasFeature(types::enums::Feature::QOI_IMAGE)) {
+    items = utility::functions::qoiItemsToPng(items);
+  }
+
+  // the copied files are streamed instead of their uris
+  if (const auto files = FileSender::getLocalFiles(items); !files.isEmpty() && this->hasFeature(types::enums::Feature::FILE_STREAM)) {
+    // stop the stream in progress
+    for (auto sender : m_ssl_socket->findChildren<FileSender*>()) {
+      sender->cancel();
+    }
+
+    // the other items go right before the stream, even if none
+    this->sendPacket(createPacket({SyncingPacket::PacketType::StreamItems, FileSender::getOtherItems(items)}));
+
+    // start the stream
+    return (new FileSender(m_ssl_socket, files))->start();
+  }
+
+  // nothing left to send
+  if (items.isEmpty()) return;
+
+  // threshold above which the items are promised
+  const auto threshold = constants::getAppLazySyncThreshold();
+
+  // is the item large enough to promise
+  const auto isLarge = [=](const QPair<QString, QByteArray>& item) {
+    return quint32(item.second.size()) > threshold;
+  };
+
+  // if nothing to promise or the server can't take it then send the items
+  if (!m_lazySync || !this->hasFeature(types::enums::Feature::LAZY_SYNC) || std::none_of(items.begin(), items.end(), isLarge)) {
+    return this->sendPacket(createPacket({SyncingPacket::PacketType::SyncPacket, items}));
+  }
+
+  // promise params of the items
+  QVector<utility::functions::params::PromiseItemParams> params;
+
+  // large items are described without payload
+  for (const auto& item : items) {
+    const auto& [mime, data] = item;
+    params.append({mime, quint32(data.size()), utility::functions::xxh3(data), isLarge(item) ? QByteArray() : data});
+  }
+
+  // create the promise id
+  const auto id = QRandomGenerator::global()->generate64();
+
+  // remember the items to serve the requests
+  m_promises.append({id, items});
+
+  // remove the oldest promise
+  if (m_promises.size() > constants::getAppMaxPromises()) {
+    m_promises.removeFirst();
+  }
+
+  // send the promise to the server
+  this->sendPacket(createPacket({PromisePacket::PacketType::Promise, id, params}));
+}
+
+/**
+ * @brief Send the summary of the client history to the server,
+ * the server answers with the entries the client is missing and
+ * its own summary
+ *
+ * @param summary fingerprints of the client history newest first
+ * @param free entries the client can take from the server
+ */
+void Client::sendHistorySummary(QVector<quint64> summary, quint32 free) {
+  // check if the socket is connected and the server syncs history
+  if (!m_ssl_socket->isOpen() || !this->hasFeature(types::enums::Feature::HISTORY_SYNC)) {
+    return;
+  }
+
+  // using HistorySummaryPacket
+  using packets::HistorySummaryPacket;
+
+  // send the summary to the server
+  this->sendPacket(utility::functions::createPacket(utility::functions::params::HistorySummaryPacketParams{
+    HistorySummaryPacket::PacketType::HistorySummary, free, summary
+  }));
+}
+
+/**
+ * @brief Send the history entries the server is missing as
+ * history promises with large payloads promised
+ *
+ * @param entries missing entries oldest first
+ */
+void Client::syncHistory(QVector<QVector<QPair<QString, QByteArray>>> entries) {
+  // check if the socket is connected and the server syncs history
+  if (!m_ssl_socket->isOpen() || !this->hasFeature(types::enums::Feature::HISTORY_SYNC)) {
+    return;
+  }
+
+  // using createPacket to create the packet
+  using packets::PromisePacket;
+  using utility::functions::createPacket;
+
+  // threshold above which the items are promised
+  const auto threshold = constants::getAppLazySyncThreshold();
+
+  // can the server decode the QOI images
+  const auto qoi = this->hasFeature(types::enums::Feature::QOI_IMAGE);
+
+  // send the entries, payloads are fetched when pasted
+  for (const auto& entry : entries) {
+    QVector<utility::functions::params::PromiseItemParams> params;
+
+    // the items the server can decode
+    const auto items = qoi ? entry : utility::functions::qoiItemsToPng(entry);
+
+    for (const auto& [mime, data] : items) {
+      const auto isLarge = quint32(data.size()) > threshold;
+      params.append({mime, quint32(data.size()), utility::functions::xxh3(data), isLarge ? QByteArray() : data});
+    }
+
+    // create the promise id
+    const auto id = QRandomGenerator::global()->generate64();
+
+    // remember the items to serve the requests of this session
+    m_historyPromises.append({id, items});
+
+    // send the entry to the server
+    this->sendPacket(createPacket({PromisePacket::PacketType::HistoryPromise, id, params}));
+  }
+}
+
+/**
+ * @brief Set whether the items larger than the threshold are
+ * promised instead of sent, the payload is sent on request
+ *
+ * @param lazy lazy sync
+ */
+void Client::setLazySync(bool lazy) {
+  this->m_lazySync = lazy;
+}
+
+/**
+ * @brief Get whether the large items are promised
+ *
+ * @return bool
+ */
+bool Client::getLazySync() const {
+  return this->m_lazySync;
+}
+
+/**
+ * @brief Fetch the payload of the promised item from the
+ * server without blocking, the callback is called with the
+ * payload or empty on failure, disconnection or timeout
+ *
+ * @param id promise id
+ * @param mime mime type
+ * @param callback callback with the payload
+ */
+void Client::fetchPayload(quint64 id, const QString& mime, std::function<void(const QByteArray&)> callback) {
+  // if the promise is from this client
+  if (auto payload = this->getPromisedPayload(id, mime); !payload.isEmpty()) {
+    return callback(payload);
+  }
+
+  // if not connected
+  if (m_ssl_socket->state() != QAbstractSocket::ConnectedState) {
+    return callback(QByteArray());
+  }
+
+  // key of the fetch
+  const auto key = qMakePair(id, mime);
+
+  // if already requested then wait for the same response
+  if (m_fetches.contains(key)) {
+    return m_fetches[key].callbacks.append(callback);
+  }
+
+  // remember the fetch
+  const auto serial = ++m_fetchSerial;
+  m_fetches.insert(key, {serial, {callback}});
+
+  // fail on timeout if still the same fetch
+  QTimer::singleShot(constants::getAppLazyFetchTimeout(), this, [this, key, serial] {
+    if (m_fetches.value(key).serial == serial) this->resolveFetch(key.first, key.second, QByteArray());
   });
 
-  // send the packet to the server
-  this->sendPacket(packet);
+  // using PayloadPacket
+  using packets::PayloadPacket;
+
+  // send the request to the server
+  this->sendPacket(utility::functions::createPacket(utility::functions::params::PayloadPacketParams{
+    PayloadPacket::PacketType::PayloadRequest, id, mime, QByteArray()
+  }));
+}
+
+/**
+ * @brief Dial the server directly or race its addresses
+ * if it has more than one
+ */
+void Client::dialServer(types::Device server) {
+  // all the addresses of the server
+  auto addresses = m_addresses.value(server.name);
+
+  // stop the race in flight
+  m_racer->cancel();
+
+  // dialed by the discovery or user
+  m_cached.reset();
+  m_cachedTimer->stop();
+
+  // server being dialed
+  m_racing = server;
+
+  // the advertised features until the server tells them
+  m_serverFeatures = m_features.value(server.name, 0);
+
+  // dial directly if nothing to race
+  if (addresses.size() < 2) {
+    return this->handleRaceWinner(server.ip);
+  }
+
+  // the preferred address if any
+  std::optional<QHostAddress> preferred;
+
+  // if won before
+  if (m_preferred.contains(server.name)) {
+    preferred = m_preferred.value(server.name);
+  }
+
+  // race the addresses
+  m_racer->race(AddressRacer::order(addresses, preferred), server.port);
+}
+
+/**
+ * @brief Connect to the address that won the race
+ */
+void Client::handleRaceWinner(QHostAddress address) {
+  // remember the address for the next time
+  m_preferred.insert(m_racing.name, address);
+
+  // the listed server now has the winning address
+  for (auto& server : m_servers) {
+    if (server.name == m_racing.name) server.ip = address;
+  }
+
+  // create the host address
+  const auto host = address.toString();
+  const auto port = m_racing.port;
+
+  // log host and port
+  qInfo() << (LOG("Connecting to server: " + host.toStdString() + ":" + std::to_string(port)));
+
+  // connect to the server as encrypted
+  m_ssl_socket->connectToHostEncrypted(host, port);
+}
+
+/**
+ * @brief Fallback to the primary address if all lost
+ */
+void Client::handleRaceFailed() {
+  // the socket reports the error
+  m_ssl_socket->connectToHostEncrypted(m_racing.ip.toString(), m_racing.port);
 }
 
 /**
@@ -473,6 +1062,24 @@ QList<types::Device> Client::getServerList() const {
   return m_servers;
 }
 
+/**
+ * @brief Get the certificate fingerprint advertised by the server
+ *
+ * @return fingerprint or nullopt if the server advertised none
+ */
+std::optional<QByteArray> Client::getServerFingerprint(const types::Device& server) const {
+  // find the fingerprint
+  auto it = m_fingerprints.constFind(server.name);
+
+  // if not advertised
+  if (it == m_fingerprints.cend()) {
+    return std::nullopt;
+  }
+
+  // return the fingerprint
+  return *it;
+}
+
 /**
  * @brief Connect to the server with the given host and port
  * number
@@ -504,15 +1111,8 @@ void Client::connectToServer(types::Device server) {
   const auto slot_su   = &Client::processSslErrors;
   connect(m_ssl_socket, signal_su, this, slot_su);
 
-  // create the host address
-  const auto host = server.ip.toString();
-  const auto port = server.port;
-
-  // log host and port
-  qInfo() << (LOG("Connecting to server: " + host.toStdString() + ":" + std::to_string(port)));
-
-  // connect to the server as encrypted
-  m_ssl_socket->connectToHostEncrypted(host, port);
+  // connect to the server
+  this->dialServer(server);
 }
 
 /**
@@ -542,15 +1142,85 @@ void Client::connectToServerSecured(types::Device server) {
   const auto slot_ss   = &Client::processSslErrorsSecured;
   connect(m_ssl_socket, signal_ss, this, slot_ss);
 
-  // create the host address
-  const auto host = server.ip.toString();
-  const auto port = server.port;
+  // connect to the server
+  this->dialServer(server);
+}
 
-  // log host and port
-  qInfo() << (LOG("Connecting to server: " + host.toStdString() + ":" + std::to_string(port)));
+/**
+ * @brief Connect to the trusted server on its last known
+ * addresses before the discovery finds it
+ *
+ * @param server server with its primary address
+ * @param addresses all the last known addresses
+ */
+void Client::connectToCachedServer(types::Device server, QList<QHostAddress> addresses) {
+  // discovered addresses are fresher
+  if (!m_addresses.contains(server.name)) {
+    m_addresses.insert(server.name, addresses);
+  }
 
-  // connect to the server as encrypted
-  m_ssl_socket->connectToHostEncrypted(host, port);
+  // log the speculative dial
+  qInfo() << LOG("Connecting to last known server: " + server.name.toStdString());
+
+  // connect to the server
+  this->connectToServerSecured(server);
+
+  // dialing the last known endpoint for a short while
+  m_cached = server;
+  m_cachedTimer->start(constants::getAppCachedDialTimeout());
+}
+
+/**
+ * @brief Is the client dialing a server
+ */
+bool Client::isConnecting() const {
+  // state of the socket
+  const auto state = m_ssl_socket->state();
+
+  // racing or socket connecting
+  return m_racer->isRacing()
+      || state == QAbstractSocket::HostLookupState
+      || state == QAbstractSocket::ConnectingState;
+}
+
+/**
+ * @brief Is the client dialing the last known endpoint
+ */
+bool Client::isConnectingCached() const {
+  return m_cached.has_value();
+}
+
+/**
+ * @brief Stop dialing the last known endpoint without
+ * reporting it as failed
+ */
+void Client::cancelCachedServer() {
+  // if not dialing the last known endpoint
+  if (!m_cached.has_value()) return;
+
+  // no longer dialing
+  m_cached.reset();
+  m_cachedTimer->stop();
+
+  // stop the race and the socket
+  m_racer->cancel();
+  m_ssl_socket->abort();
+}
+
+/**
+ * @brief Get all the known addresses of the server
+ */
+QList<QHostAddress> Client::getServerAddresses(const types::Device& server) const {
+  // all the addresses
+  auto addresses = m_addresses.value(server.name);
+
+  // the given address is known too
+  if (!addresses.contains(server.ip)) {
+    addresses.prepend(server.ip);
+  }
+
+  // return the addresses
+  return addresses;
 }
 
 /**
@@ -599,18 +1269,39 @@ QSslCertificate Client::getConnectedServerCertificate() const{
  *
  * @param host Host address
  * @param port Port number
+ * @param addresses All the addresses of the server
+ * @param txt  TXT record of the service
  */
-void Client::onServiceAdded(types::Device server) {
+void Client::onServiceAdded(types::Device server, QList<QHostAddress> addresses, QMap<QString, QByteArray> txt) {
   // if Discover Configuration is null the return
   if (this->m_ssl_config.isNull()) {
     throw std::runtime_error("SSL Config Config is not set");
   }
 
+
   // if already found
   if (std::find(m_servers.begin(), m_servers.end(), server) != m_servers.end()) {
     return;
   }
 
+  // servers without version predates the TXT record
+  if (txt.contains("v") && txt.value("v").toUInt() != constants::getAppProtocolVersion()) {
+    qInfo() << LOG("Ignoring incompatible server: " + server.name.toStdString()); return;
+  }
+
+  // remember all the addresses to race
+  this->m_addresses.insert(server.name, addresses);
+
+  // remember the advertised certificate
+  if (txt.contains("fp")) {
+    this->m_fingerprints.insert(server.name, QByteArray::fromHex(txt.value("fp")));
+  } else {
+    this->m_fingerprints.remove(server.name);
+  }
+
+  // remember the advertised features
+  this->m_features.insert(server.name, txt.value("f").toUInt(nullptr, 16));
+
   // emit server found
   emit OnServerFound(server);
 
@@ -627,8 +1318,9 @@ void Client::onServiceAdded(types::Device server) {
  */
 void Client::onServiceRemoved(types::Device server) {
   // matcher to get the Device from servers list
+  // by name since the address may be the one that won the race
   auto matcher = [server](const types::Device& device) {
-    return device == server;
+    return device.name == server.name;
   };
 
   // start and end
@@ -646,6 +1338,11 @@ void Client::onServiceRemoved(types::Device server) {
   // emit server gone
   emit OnServerGone(*device);
 
+  // forget the advertised certificate & addresses
+  this->m_fingerprints.remove(device->name);
+  this->m_addresses.remove(device->name);
+  this->m_features.remove(device->name);
+
   // remove the server from the list
   m_servers.erase(device);
 
@@ -7,6 +7,7 @@
 #include <QDateTime>
 #include <QList>
 #include <QObject>
+#include <QRandomGenerator>
 #include <QSslConfiguration>
 #include <QSslKey>
 #include <QSslServer>
@@ -16,17 +17,24 @@
 #include <QNetworkReply>
 
 // standard headers
+#include <algorithm>
+#include <functional>
 #include <optional>
 #include <tuple>
 #include <utility>
 
 // Local headers
 #include "mdns/mdns.hpp"
+#include "syncing/addressracer/addressracer.hpp"
+#include "syncing/filereceiver/filereceiver.hpp"
+#include "syncing/filesender/filesender.hpp"
 #include "types/enums/enums.hpp"
 #include "types/device.hpp"
+#include "utility/functions/hash/hash.hpp"
 #include "utility/functions/ipconv/ipconv.hpp"
 #include "utility/functions/nbytes/nbytes.hpp"
 #include "utility/functions/packet/packet.hpp"
+#include "utility/functions/qoi/qoi.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::network::syncing {
 /**
@@ -54,10 +62,31 @@ class Client : public service::mdnsBrowser {
   /// @brief On Connection Error
   void OnConnectionError(QString error);
 
+ signals:  // signals for this class
+  /// @brief On the last known endpoint of the server not reachable
+  void OnCachedServerFailed(types::Device server);
+
  signals:  // signals for this class
   /// @brief On Sync Request
   void OnSyncRequest(QVector<QPair<QString, QByteArray>> items);
 
+ signals:  // signals for this class
+  /// @brief On Promise Request (items known and promised mime with hash)
+  void OnPromiseRequest(quint64 id, QVector<QPair<QString, QByteArray>> items, QVector<QPair<QString, quint64>> promised);
+
+ signals:  // signals for this class
+  /// @brief On History Summary of the server (fingerprints newest first and entries it can take)
+  void OnHistorySummary(QVector<quint64> entries, quint32 free);
+
+ signals:  // signals for this class
+  /// @brief On History Entry the client is missing (items known and promised mime with hash,
+  /// and the history of the sender newest first to place the entry by recency)
+  void OnHistoryEntry(quint64 id, QVector<QPair<QString, QByteArray>> items, QVector<QPair<QString, quint64>> promised, QVector<quint64> history);
+
+ signals:  // signals for this class
+  /// @brief On Payload of a promise received
+  void OnPayloadReceived(quint64 id, QString mime, QByteArray payload);
+
  signals:  // signals for this class
  /// @brief on InvalidPacket
   void OnInvalidPacket(int code, QString error);
@@ -83,6 +112,33 @@ class Client : public service::mdnsBrowser {
   /// @brief List of Found servers
   QList<types::Device> m_servers;
 
+  /// @brief Advertised certificate fingerprints by server name
+  QMap<QString, QByteArray> m_fingerprints;
+
+  /// @brief All the resolved addresses by server name
+  QMap<QString, QList<QHostAddress>> m_addresses;
+
+  /// @brief Advertised feature bits by server name
+  QMap<QString, quint32> m_features;
+
+  /// @brief Features of the server on the connection
+  quint32 m_serverFeatures = 0;
+
+  /// @brief Address that won the last race by server name
+  QMap<QString, QHostAddress> m_preferred;
+
+  /// @brief Races the addresses of the server to connect
+  AddressRacer* m_racer = new AddressRacer(this);
+
+  /// @brief Server whose addresses are raced
+  types::Device m_racing;
+
+  /// @brief Server dialed on its last known endpoint
+  std::optional<types::Device> m_cached;
+
+  /// @brief Timer to give up the dial of the last known endpoint
+  QTimer* m_cachedTimer = new QTimer(this);
+
   /// @brief Timer to send ping packet
   QTimer* m_pingTimer = new QTimer(this);
 
@@ -92,6 +148,37 @@ class Client : public service::mdnsBrowser {
   /// @brief property to hold read time
   const char* READ_TIME = "READ_TIME";
 
+  /// @brief Promise large items instead of sending them
+  bool m_lazySync = false;
+
+  /// @brief Items that are promised by this client
+  QList<QPair<quint64, QVector<QPair<QString, QByteArray>>>> m_promises;
+
+  /// @brief History entries that are promised by this client on the
+  /// catch-up of the current session
+  QList<QPair<quint64, QVector<QPair<QString, QByteArray>>>> m_historyPromises;
+
+  /// @brief History of the server newest first from its summary
+  QVector<quint64> m_serverHistory;
+
+  /// @brief Receiver of the files streamed by the server
+  FileReceiver* m_fileReceiver = new FileReceiver(this);
+
+  /**
+   * @brief Fetch of a promised payload in flight, the serial
+   * tells apart the timeout of an earlier fetch of the payload
+   */
+  struct Fetch {
+    quint64 serial;
+    QList<std::function<void(const QByteArray&)>> callbacks;
+  };
+
+  /// @brief Fetches in flight by promise id and mime type
+  QMap<QPair<quint64, QString>, Fetch> m_fetches;
+
+  /// @brief Serial of the last fetch
+  quint64 m_fetchSerial = 0;
+
  private:  // private functions
 
   /**
@@ -167,12 +254,90 @@ class Client : public service::mdnsBrowser {
    */
   void processSyncingPacket(const packets::SyncingPacket& packet);
 
+  /**
+   * @brief Process the promise that has been received
+   * from the server and emit the signal
+   *
+   * @param packet Promise packet
+   */
+  void processPromisePacket(const packets::PromisePacket& packet);
+
+  /**
+   * @brief Process the history summary that has been received
+   * from the server and emit the signal
+   *
+   * @param packet History summary packet
+   */
+  void processHistorySummaryPacket(const packets::HistorySummaryPacket& packet);
+
+  /**
+   * @brief Process the features of the server and answer
+   * with the features of the client
+   *
+   * @param packet Capability packet
+   */
+  void processCapabilityPacket(const packets::CapabilityPacket& packet);
+
+  /**
+   * @brief Does the server understand the feature, servers
+   * that predate the capability packet understand none
+   */
+  bool hasFeature(types::enums::Feature feature) const;
+
+  /**
+   * @brief Process the payload request or response that
+   * has been received from the server
+   *
+   * @param packet Payload packet
+   */
+  void processPayloadPacket(const packets::PayloadPacket& packet);
+
+  /**
+   * @brief Call the callbacks of the fetch with the payload
+   *
+   * @param id promise id
+   * @param mime mime type
+   * @param payload payload or empty on failure
+   */
+  void resolveFetch(quint64 id, const QString& mime, const QByteArray& payload);
+
+  /**
+   * @brief Get the payload of the item that is promised by
+   * this client
+   *
+   * @return payload or empty if not found
+   */
+  QByteArray getPromisedPayload(quint64 id, const QString& mime) const;
+
+  /**
+   * @brief Process the chunk of the files that are streamed
+   * from the server
+   *
+   * @param packet File stream packet
+   */
+  void processFileStreamPacket(const packets::FileStreamPacket& packet);
+
+  /**
+   * @brief Process the files that are received from the
+   * server and emit the signal
+   *
+   * @param files local urls of the received files
+   */
+  void processFilesReceived(const QList<QUrl>& files);
+
   /**
    * @brief Process the packet that has been received
    * from the server
    */
   void processReadyRead();
 
+  /**
+   * @brief Parse the packet and process it
+   *
+   * @param data packet
+   */
+  void processPacket(const QByteArray& data);
+
   /**
    * @brief function to process the timeout
    */
@@ -183,6 +348,28 @@ class Client : public service::mdnsBrowser {
    */
   void processPongTimeout();
 
+  /**
+   * @brief Give up the dial of the last known endpoint that
+   * is not authenticated in time
+   */
+  void processCachedTimeout();
+
+  /**
+   * @brief Dial the server directly or race its addresses
+   * if it has more than one
+   */
+  void dialServer(types::Device server);
+
+  /**
+   * @brief Connect to the address that won the race
+   */
+  void handleRaceWinner(QHostAddress address);
+
+  /**
+   * @brief Fallback to the primary address if all lost
+   */
+  void handleRaceFailed();
+
  public:
 
   /**
@@ -212,12 +399,57 @@ class Client : public service::mdnsBrowser {
 
   /**
    * @brief Send the items to the server to sync the
-   * clipboard data
+   * clipboard data, the copied local files are streamed
+   * after the other items
    *
    * @param items QVector<QPair<QString, QByteArray>>
    */
   void syncItems(QVector<QPair<QString, QByteArray>> items);
 
+  /**
+   * @brief Send the summary of the client history to the server,
+   * the server answers with the entries the client is missing and
+   * its own summary
+   *
+   * @param summary fingerprints of the client history newest first
+   * @param free entries the client can take from the server
+   */
+  void sendHistorySummary(QVector<quint64> summary, quint32 free);
+
+  /**
+   * @brief Send the history entries the server is missing as
+   * history promises with large payloads promised
+   *
+   * @param entries missing entries oldest first
+   */
+  void syncHistory(QVector<QVector<QPair<QString, QByteArray>>> entries);
+
+  /**
+   * @brief Set whether the items larger than the threshold are
+   * promised instead of sent, the payload is sent on request
+   *
+   * @param lazy lazy sync
+   */
+  void setLazySync(bool lazy);
+
+  /**
+   * @brief Get whether the large items are promised
+   *
+   * @return bool
+   */
+  bool getLazySync() const;
+
+  /**
+   * @brief Fetch the payload of the promised item from the
+   * server without blocking, the callback is called with the
+   * payload or empty on failure, disconnection or timeout
+   *
+   * @param id promise id
+   * @param mime mime type
+   * @param callback callback with the payload
+   */
+  void fetchPayload(quint64 id, const QString& mime, std::function<void(const QByteArray&)> callback);
+
   /**
    * @brief Get the Server List object
    *
@@ -225,6 +457,13 @@ class Client : public service::mdnsBrowser {
    */
   QList<types::Device> getServerList() const;
 
+  /**
+   * @brief Get the certificate fingerprint advertised by the server
+   *
+   * @return fingerprint or nullopt if the server advertised none
+   */
+  std::optional<QByteArray> getServerFingerprint(const types::Device& server) const;
+
   /**
    * @brief Connect to the server with the given host and port
    * number
@@ -243,6 +482,36 @@ class Client : public service::mdnsBrowser {
    */
   void connectToServer(types::Device client);
 
+  /**
+   * @brief Connect to the trusted server on its last known
+   * addresses before the discovery finds it
+   *
+   * @param server server with its primary address
+   * @param addresses all the last known addresses
+   */
+  void connectToCachedServer(types::Device server, QList<QHostAddress> addresses);
+
+  /**
+   * @brief Is the client dialing a server
+   */
+  bool isConnecting() const;
+
+  /**
+   * @brief Is the client dialing the last known endpoint
+   */
+  bool isConnectingCached() const;
+
+  /**
+   * @brief Stop dialing the last known endpoint without
+   * reporting it as failed
+   */
+  void cancelCachedServer();
+
+  /**
+   * @brief Get all the known addresses of the server
+   */
+  QList<QHostAddress> getServerAddresses(const types::Device& server) const;
+
   /**
    * @brief Get the Connection Host and Port object
    */
@@ -266,8 +535,10 @@ class Client : public service::mdnsBrowser {
    *
    * @param host Host address
    * @param port Port number
+   * @param addresses All the addresses of the server
+   * @param txt  TXT record of the service
    */
-  void onServiceAdded(types::Device server) override;
+  void onServiceAdded(types::Device server, QList<QHostAddress> addresses, QMap<QString, QByteArray> txt) override;
 
   /**
    * @brief On server removed function that That Called by the
@@ -0,0 +1,249 @@
+#include "filereceiver.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::syncing {
+/**
+ * @brief Start the new stream and drop the incomplete one
+ *
+ * @param streamId id of the stream
+ * @return true if started
+ */
+bool FileReceiver::startStream(quint64 streamId) {
+  // drop the incomplete stream
+  this->dropStream();
+
+  // staging directory of the stream
+  const auto staging = QString::fromStdString(constants::getAppStagingDir());
+  const auto name    = QString::number(streamId, 16);
+
+  // create the directory
+  if (!QDir().mkpath(QDir(staging).filePath(name))) {
+    return false;
+  }
+
+  // set the stream state
+  m_streamId  = streamId;
+  m_directory = QDir(QDir(staging).filePath(name));
+  m_index     = 0;
+  m_offset    = 0;
+
+  // remove the old streams
+  this->removeOldStreams();
+
+  // started
+  return true;
+}
+
+/**
+ * @brief Drop the stream in progress and its files
+ */
+void FileReceiver::dropStream() {
+  // if no stream in progress
+  if (!m_streamId.has_value()) return;
+
+  // close the file
+  if (m_file.isOpen()) m_file.close();
+
+  // remove the files
+  m_directory.removeRecursively();
+
+  // reset the state
+  m_streamId.reset();
+  m_files.clear();
+}
+
+/**
+ * @brief Create and pre allocate the file
+ *
+ * @param name name of the file from the peer
+ * @param size size of the file
+ * @return true if created
+ */
+bool FileReceiver::createFile(const QString& name, quint64 size) {
+  // strip any directory component from the peer
+  auto fileName = QFileInfo(name).fileName();
+
+  // fallback name
+  if (fileName.isEmpty() || fileName == "." || fileName == "..") {
+    fileName = QString("file-%1").arg(m_index);
+  }
+
+  // same name in the stream
+  if (m_directory.exists(fileName)) {
+    fileName = QString("%1-%2").arg(m_index).arg(fileName);
+  }
+
+  // set the file name
+  m_file.setFileName(m_directory.filePath(fileName));
+
+  // free space of the staging disk
+  const auto available = QStorageInfo(m_directory.absolutePath()).bytesAvailable();
+
+  // the peer can't fill the disk with the size it claims
+  if (available < 0 || size > quint64(available) || quint64(available) - size < constants::getAppMinFreeDiskSpace()) {
+    return false;
+  }
+
+  // open the file
+  if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+    return false;
+  }
+
+  // reserve the blocks up front to avoid fragmentation
+#ifdef __linux__
+  if (size && posix_fallocate(m_file.handle(), 0, off_t(size)) != 0) {
+    return false;
+  }
+#else
+  if (size && !m_file.resize(qint64(size))) {
+    return false;
+  }
+#endif
+
+  // created
+  return true;
+}
+
+/**
+ * @brief Remove the old staged streams beyond the limit
+ */
+void FileReceiver::removeOldStreams() const {
+  // staging directory
+  const auto staging = QDir(QString::fromStdString(constants::getAppStagingDir()));
+
+  // streams newest first
+  const auto streams = staging.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Time);
+
+  // remove the streams that are beyond the limit
+  for (auto i = constants::getAppMaxReceivedStreams(); i < streams.size(); ++i) {
+    if (streams[i].absoluteFilePath() != m_directory.absolutePath()) {
+      QDir(streams[i].absoluteFilePath()).removeRecursively();
+    }
+  }
+}
+
+/**
+ * @brief Construct a new File Receiver object
+ *
+ * @param parent parent object
+ */
+FileReceiver::FileReceiver(QObject* parent) : QObject(parent) {
+  // Nothing to do
+}
+
+/**
+ * @brief Destroy the File Receiver object and drop
+ * the incomplete stream
+ */
+FileReceiver::~FileReceiver() {
+  this->dropStream();
+}
+
+/**
+ * @brief Process the chunk of the file, the chunks of a stream
+ * are expected in order and the stream is dropped otherwise
+ *
+ * @param packet FileStreamPacket
+ */
+void FileReceiver::processPacket(const packets::FileStreamPacket& packet) {
+  // a new stream starts with the first chunk of the first file
+  if (m_streamId != packet.getStreamId()) {
+    // chunks of a cancelled stream that were already queued
+    if (packet.getFileIndex() != 0 || packet.getOffset() != 0) {
+      return;
+    }
+
+    if (!this->startStream(packet.getStreamId())) {
+      qWarning() << "Unable to create the staging directory";
+      return;
+    }
+  }
+
+  // chunks are expected in order
+  if (packet.getFileIndex() != m_index || packet.getOffset() != m_offset) {
+    return this->dropStream();
+  }
+
+  // create the file on the first chunk
+  if (m_offset == 0) {
+    const auto name = QString::fromUtf8(packet.getFileName());
+    if (!this->createFile(name, packet.getFileSize())) {
+      qWarning() << "Unable to create the file" << m_file.fileName();
+      return this->dropStream();
+    }
+  }
+
+  // write the chunk at its offset
+  const auto chunk = packet.getChunk();
+
+  // write the chunk
+  if (!m_file.seek(qint64(m_offset)) || m_file.write(chunk) != chunk.size()) {
+    qWarning() << "Unable to write the file" << m_file.fileName();
+    return this->dropStream();
+  }
+
+  // update the offset
+  m_offset += chunk.size();
+
+  // if the file is not completed
+  if (m_offset < packet.getFileSize()) {
+    return;
+  }
+
+  // file is completed
+  m_file.close();
+  m_files.append(QUrl::fromLocalFile(m_file.fileName()));
+  m_offset = 0;
+  m_index++;
+
+  // if the stream is not completed
+  if (m_index < packet.getFileCount()) {
+    return;
+  }
+
+  // stream is completed the files are kept
+  const auto files = m_files;
+  m_streamId.reset();
+  m_files.clear();
+
+  // notify the listeners
+  emit OnFilesReceived(files);
+}
+
+/**
+ * @brief Set the items the peer sent along with the next stream,
+ * the peer sends them right before the stream
+ *
+ * @param items items other than the files
+ */
+void FileReceiver::setItems(const QVector<QPair<QString, QByteArray>>& items) {
+  this->m_items = items;
+}
+
+/**
+ * @brief Take the items that are sent along with the stream
+ *
+ * @return items other than the files
+ */
+QVector<QPair<QString, QByteArray>> FileReceiver::takeItems() {
+  return std::exchange(this->m_items, {});
+}
+
+/**
+ * @brief Convert the urls to the text/uri-list payload
+ *
+ * @param urls urls of the files
+ * @return QByteArray
+ */
+QByteArray FileReceiver::toUriList(const QList<QUrl>& urls) {
+  // uri list
+  QByteArray list;
+
+  // each uri is terminated by CRLF
+  for (const auto& url : urls) {
+    list.append(url.toEncoded()).append("\r\n");
+  }
+
+  // return the list
+  return list;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::network::syncing
@@ -0,0 +1,149 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt headers
+#include <QByteArray>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QList>
+#include <QObject>
+#include <QPair>
+#include <QStorageInfo>
+#include <QString>
+#include <QUrl>
+#include <QVector>
+
+// standard headers
+#include <optional>
+#include <utility>
+
+// platform headers
+#ifdef __linux__
+#include <fcntl.h>
+#endif
+
+// Local headers
+#include "constants/constants.hpp"
+#include "packets/filestreampacket/filestreampacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::syncing {
+/**
+ * @brief Receives the FileStreamPacket of a socket and writes the
+ * files to the staging directory, the files are pre allocated on
+ * the first chunk so the disk space is reserved up front
+ */
+class FileReceiver : public QObject {
+ signals:  // signals for this class
+  /// @brief On all the files of the stream are received
+  void OnFilesReceived(QList<QUrl> files);
+
+ private:  // just for Qt
+
+  /// @brief Qt meta object
+  Q_OBJECT
+
+ private:  // disable copy and move
+
+  /// @brief Disable copy and move
+  Q_DISABLE_COPY_MOVE(FileReceiver)
+
+ private:  // Member variables
+
+  /// @brief id of the stream in progress
+  std::optional<quint64> m_streamId;
+
+  /// @brief directory of the stream
+  QDir m_directory;
+
+  /// @brief received files
+  QList<QUrl> m_files;
+
+  /// @brief index of the current file
+  quint32 m_index = 0;
+
+  /// @brief offset in the current file
+  quint64 m_offset = 0;
+
+  /// @brief current file
+  QFile m_file;
+
+  /// @brief items that are sent along with the next stream
+  QVector<QPair<QString, QByteArray>> m_items;
+
+ private:  // private functions
+
+  /**
+   * @brief Start the new stream and drop the incomplete one
+   *
+   * @param streamId id of the stream
+   * @return true if started
+   */
+  bool startStream(quint64 streamId);
+
+  /**
+   * @brief Drop the stream in progress and its files
+   */
+  void dropStream();
+
+  /**
+   * @brief Create and pre allocate the file
+   *
+   * @param name name of the file from the peer
+   * @param size size of the file
+   * @return true if created
+   */
+  bool createFile(const QString& name, quint64 size);
+
+  /**
+   * @brief Remove the old staged streams beyond the history size
+   */
+  void removeOldStreams() const;
+
+ public:
+
+  /**
+   * @brief Construct a new File Receiver object
+   *
+   * @param parent parent object
+   */
+  FileReceiver(QObject* parent = nullptr);
+
+  /**
+   * @brief Destroy the File Receiver object and drop
+   * the incomplete stream
+   */
+  ~FileReceiver() override;
+
+  /**
+   * @brief Process the chunk of the file, the chunks of a stream
+   * are expected in order and the stream is dropped otherwise
+   *
+   * @param packet FileStreamPacket
+   */
+  void processPacket(const packets::FileStreamPacket& packet);
+
+  /**
+   * @brief Set the items the peer sent along with the next stream,
+   * the peer sends them right before the stream
+   *
+   * @param items items other than the files
+   */
+  void setItems(const QVector<QPair<QString, QByteArray>>& items);
+
+  /**
+   * @brief Take the items that are sent along with the stream
+   *
+   * @return items other than the files
+   */
+  QVector<QPair<QString, QByteArray>> takeItems();
+
+  /**
+   * @brief Convert the urls to the text/uri-list payload
+   *
+   * @param urls urls of the files
+   * @return QByteArray
+   */
+  static QByteArray toUriList(const QList<QUrl>& urls);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::network::syncing
@@ -0,0 +1,224 @@
+#include "filesender.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::syncing {
+/**
+ * @brief Open the file at the current index
+ *
+ * @return true if opened
+ */
+bool FileSender::openCurrentFile() {
+  // close the previous file
+  if (m_file.isOpen()) m_file.close();
+
+  // set the file name
+  m_file.setFileName(m_files.at(m_index));
+
+  // open the file
+  return m_file.open(QIODevice::ReadOnly);
+}
+
+/**
+ * @brief Write the next chunk of the current file
+ *
+ * @return true if written
+ */
+bool FileSender::writeNextChunk() {
+  // using createPacket to create the packet
+  using packets::FileStreamPacket;
+  using utility::functions::createPacket;
+
+  // open the file on first chunk
+  if (m_offset == 0 && !openCurrentFile()) {
+    return false;
+  }
+
+  // size of the file and the chunk
+  const auto fileSize = quint64(m_file.size());
+  const auto length   = qMin<quint64>(constants::getAppFileChunkSize(), fileSize - m_offset);
+  const auto name     = QFileInfo(m_file.fileName()).fileName();
+  const auto count    = quint32(m_files.size());
+
+  // map the chunk and fallback to read for the files can't be mapped
+  auto mapped = length ? m_file.map(m_offset, length) : nullptr;
+  QByteArray chunk;
+
+  // wrap the mapped memory without copy
+  if (mapped != nullptr) {
+    chunk = QByteArray::fromRawData(reinterpret_cast<const char*>(mapped), length);
+  } else if (length) {
+    m_file.seek(m_offset); chunk = m_file.read(length);
+  }
+
+  // check the chunk
+  if (quint64(chunk.size()) != length) {
+    return false;
+  }
+
+  // create the packet
+  const auto packet = createPacket({
+    FileStreamPacket::PacketType::FileStream,
+    m_streamId, count, m_index, fileSize, m_offset, name, chunk
+  });
+
+  // write the header then the chunk so the chunk is only copied
+  // once into the socket buffer
+  const auto header  = packet.headerBytes();
+  const auto written = m_socket->write(header) == header.size()
+                    && m_socket->write(chunk.constData(), chunk.size()) == chunk.size();
+
+  // unmap the chunk
+  if (mapped != nullptr) m_file.unmap(mapped);
+
+  // check for error
+  if (!written) {
+    return false;
+  }
+
+  // update the offset
+  m_offset += length;
+
+  // move to next file
+  if (m_offset == fileSize) {
+    m_file.close(); m_offset = 0; m_index++;
+  }
+
+  // done
+  return true;
+}
+
+/**
+ * @brief Write the chunks until the window is full
+ */
+void FileSender::pump() {
+  // max bytes queued on the socket
+  const auto window = qint64(constants::getAppFileChunkSize()) * constants::getAppFileWindowSize();
+
+  // bytes queued on the socket
+  const auto queued = [this] {
+    return m_socket->bytesToWrite() + m_socket->encryptedBytesToWrite();
+  };
+
+  // write while the window is not full
+  while (m_index < quint32(m_files.size()) && queued() < window) {
+    // the receiver drops the incomplete stream
+    if (!writeNextChunk()) {
+      qWarning() << "Unable to stream the file" << m_files.at(m_index);
+      m_socket->disconnect(this);
+      return this->deleteLater();
+    }
+  }
+
+  // if all files are written
+  if (m_index == quint32(m_files.size())) {
+    m_socket->disconnect(this);
+    emit OnFinished(m_streamId);
+    this->deleteLater();
+  }
+}
+
+/**
+ * @brief Construct a new File Sender object the sender
+ * is parented to the socket
+ *
+ * @param socket socket to write the files
+ * @param files local files to send
+ */
+FileSender::FileSender(QSslSocket* socket, const QStringList& files)
+    : QObject(socket), m_socket(socket), m_files(files) {
+  // continue once the queued chunks are written
+  QObject::connect(
+    m_socket, &QSslSocket::bytesWritten,
+    this, &FileSender::pump
+  );
+
+  // stop on disconnection
+  QObject::connect(
+    m_socket, &QSslSocket::disconnected,
+    this, &FileSender::deleteLater
+  );
+}
+
+/**
+ * @brief Get the Stream Id object
+ *
+ * @return quint64
+ */
+quint64 FileSender::getStreamId() const noexcept {
+  return m_streamId;
+}
+
+/**
+ * @brief Start sending the files, the sender deletes
+ * itself once finished or the socket is disconnected
+ */
+void FileSender::start() {
+  this->pump();
+}
+
+/**
+ * @brief Stop sending the files, the chunks already
+ * queued on the socket are still written
+ */
+void FileSender::cancel() {
+  m_socket->disconnect(this);
+  this->deleteLater();
+}
+
+/**
+ * @brief Get the regular local files from the text/uri-list
+ * item of the clipboard items, the directories are skipped
+ *
+ * @param items clipboard items
+ *
+ * @return local files
+ */
+QStringList FileSender::getLocalFiles(const QVector<QPair<QString, QByteArray>>& items) {
+  // local files
+  QStringList files;
+
+  // find the uri list
+  for (const auto& [mime, data] : items) {
+    // not uri list
+    if (mime != "text/uri-list") continue;
+
+    // uri-list is CRLF separated and # starts a comment
+    for (const auto& line : data.split('\n')) {
+      const auto uri = line.trimmed();
+      if (uri.isEmpty() || uri.startsWith('#')) continue;
+
+      // only the local regular files can be streamed
+      const auto url = QUrl::fromEncoded(uri);
+      if (!url.isLocalFile()) continue;
+
+      // skip the directories and special files
+      if (QFileInfo(url.toLocalFile()).isFile()) {
+        files.append(url.toLocalFile());
+      }
+    }
+  }
+
+  // return the files
+  return files;
+}
+
+/**
+ * @brief Get the items other than the text/uri-list that are
+ * sent along with the streamed files
+ *
+ * @param items clipboard items
+ *
+ * @return items without the uri list
+ */
+QVector<QPair<QString, QByteArray>> FileSender::getOtherItems(const QVector<QPair<QString, QByteArray>>& items) {
+  // other items
+  QVector<QPair<QString, QByteArray>> others;
+
+  // skip the uri list
+  for (const auto& item : items) {
+    if (item.first != "text/uri-list") others.append(item);
+  }
+
+  // return the items
+  return others;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::network::syncing
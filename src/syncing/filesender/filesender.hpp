@@ -0,0 +1,141 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt headers
+#include <QByteArray>
+#include <QFile>
+#include <QFileInfo>
+#include <QList>
+#include <QObject>
+#include <QPair>
+#include <QPointer>
+#include <QRandomGenerator>
+#include <QSslSocket>
+#include <QString>
+#include <QStringList>
+#include <QUrl>
+#include <QVector>
+
+// Local headers
+#include "constants/constants.hpp"
+#include "utility/functions/nbytes/nbytes.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::network::syncing {
+/**
+ * @brief Streams the files to the socket as FileStreamPacket, the
+ * files are memory mapped one chunk at a time so the whole file is
+ * never loaded into the memory and the number of chunks queued on
+ * the socket is bounded by the window size
+ */
+class FileSender : public QObject {
+ signals:  // signals for this class
+  /// @brief On all the files are written to the socket
+  void OnFinished(quint64 streamId);
+
+ private:  // just for Qt
+
+  /// @brief Qt meta object
+  Q_OBJECT
+
+ private:  // disable copy and move
+
+  /// @brief Disable copy and move
+  Q_DISABLE_COPY_MOVE(FileSender)
+
+ private:  // Member variables
+
+  /// @brief Socket to write the files
+  QPointer<QSslSocket> m_socket;
+
+  /// @brief files to send
+  QStringList m_files;
+
+  /// @brief id of the stream
+  quint64 m_streamId = QRandomGenerator::global()->generate64();
+
+  /// @brief index of the current file
+  quint32 m_index = 0;
+
+  /// @brief offset in the current file
+  quint64 m_offset = 0;
+
+  /// @brief current file
+  QFile m_file;
+
+ private:  // private functions
+
+  /**
+   * @brief Open the file at the current index
+   *
+   * @return true if opened
+   */
+  bool openCurrentFile();
+
+  /**
+   * @brief Write the next chunk of the current file
+   *
+   * @return true if written
+   */
+  bool writeNextChunk();
+
+  /**
+   * @brief Write the chunks until the window is full
+   */
+  void pump();
+
+ public:
+
+  /**
+   * @brief Construct a new File Sender object the sender
+   * is parented to the socket
+   *
+   * @param socket socket to write the files
+   * @param files local files to send
+   */
+  FileSender(QSslSocket* socket, const QStringList& files);
+
+  /**
+   * @brief Destroy the File Sender object
+   */
+  ~FileSender() override = default;
+
+  /**
+   * @brief Get the Stream Id object
+   *
+   * @return quint64
+   */
+  quint64 getStreamId() const noexcept;
+
+  /**
+   * @brief Start sending the files, the sender deletes
+   * itself once finished or the socket is disconnected
+   */
+  void start();
+
+  /**
+   * @brief Stop sending the files, the chunks already
+   * queued on the socket are still written
+   */
+  void cancel();
+
+  /**
+   * @brief Get the regular local files from the text/uri-list
+   * item of the clipboard items, the directories are skipped
+   *
+   * @param items clipboard items
+   *
+   * @return local files
+   */
+  static QStringList getLocalFiles(const QVector<QPair<QString, QByteArray>>& items);
+
+  /**
+   * @brief Get the items other than the text/uri-list that are
+   * sent along with the streamed files
+   *
+   * @param items clipboard items
+   *
+   * @return items without the uri list
+   */
+  static QVector<QPair<QString, QByteArray>> getOtherItems(const QVector<QPair<QString, QByteArray>>& items);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::network::syncing
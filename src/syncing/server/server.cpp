@@ -113,6 +113,24 @@ void Server::processDisconnection() {
   // Remove the client from the list of clients
   m_clients.removeOne(client);
 
+  // fail the payloads that are pending on the client
+  for (auto &promise : m_promises) {
+    if (promise.owner != client) continue;
+    for (const auto &mime : promise.waiters.keys()) {
+      this->resolvePayload(&promise, mime, QByteArray());
+    }
+    promise.owner = nullptr;
+  }
+
+  // the catch-up with the client is over
+  auto catchUp = m_catchUps.take(client);
+
+  for (auto &promise : catchUp.promises) {
+    for (const auto &mime : promise.waiters.keys()) {
+      this->resolvePayload(&promise, mime, QByteArray());
+    }
+  }
+
   // Notify the listeners that the client is disconnected
   emit OnCLientStateChanged(device, false);
 
@@ -170,17 +188,450 @@ void Server::processSyncingPacket(const packets::SyncingPacket &packet) {
     if (i.getPayloadLength()) items.append({i.getMimeType().toStdString().c_str(), i.getPayload()});;
   }
 
+  // get the Sender of the packet
+  auto client = qobject_cast<QSslSocket *>(sender());
+
+  // the items before a stream are applied and relayed with the files
+  if (packet.getPacketType() == packets::SyncingPacket::PacketType::StreamItems) {
+    return this->receiverOf(client)->setItems(items);
+  }
+
+  // Notify the listeners to sync the data
+  if (!items.isEmpty()) emit OnSyncRequest(items);
+
+  // relay to the other clients, QOI images as PNG if not understood
+  for (auto other : m_clients) {
+    if (other == client) continue;
+    if (this->hasFeature(other, types::enums::Feature::QOI_IMAGE)) {
+      this->sendPacket(other, packet);
+    } else {
+      this->sendItems(other, items);
+    }
+  }
+}
+
+/**
+ * @brief Process the PromisePacket from the client
+ *
+ * @param packet PromisePacket
+ */
+void Server::processPromisePacket(const packets::PromisePacket &packet) {
+  // known items and promised items
+  QVector<QPair<QString, QByteArray>> items;
+  QVector<QPair<QString, quint64>> promised;
+
+  // Get the items from the packet
+  for (auto i : packet.getItems()) {
+    const auto mime = QString::fromUtf8(i.getMimeType());
+    if (i.isLazy()) {
+      promised.append({mime, i.getPayloadHash()});
+    } else if (i.getPayloadLength()) {
+      items.append({mime, i.getPayload()});
+    }
+  }
+
   // is empty list
-  if (items.isEmpty()) return;
+  if (items.isEmpty() && promised.isEmpty()) return;
+
+  // get the Sender of the packet
+  auto client = qobject_cast<QSslSocket *>(sender());
+
+  // history entry is only added to the history
+  if (packet.getPacketType() == packets::PromisePacket::PacketType::HistoryPromise) {
+    // catch-up with the client
+    auto &catchUp = m_catchUps[client];
+
+    // entries beyond what the server can take are dropped
+    if (catchUp.free <= 0) return;
+
+    // one less to take
+    catchUp.free--;
+
+    // remember the owner of the promise
+    catchUp.promises.append({packet.getPromiseId(), client, items, {}});
+
+    // Notify the listeners to add the entry
+    return emit OnHistoryEntry(packet.getPromiseId(), items, promised, catchUp.history);
+  }
+
+  // remember the owner of the promise
+  this->addPromise({packet.getPromiseId(), client, items, {}});
 
   // Notify the listeners to sync the data
-  emit OnSyncRequest(items);
+  emit OnPromiseRequest(packet.getPromiseId(), items, promised);
+
+  // is the mime a QOI image
+  const auto isQoi = [](const auto &item) { return item.first == "image/qoi"; };
+
+  // does the promise carry a QOI image
+  const auto hasQoi = std::any_of(items.begin(), items.end(), isQoi)
+                   || std::any_of(promised.begin(), promised.end(), isQoi);
+
+  // find the promise
+  auto promise = this->findPromise(packet.getPromiseId());
+
+  // relay the promise to the clients that can take it
+  for (auto other : m_clients) {
+    // skip the owner
+    if (other == client) continue;
+
+    // can the client fetch and decode the promise
+    const auto lazy = this->hasFeature(other, types::enums::Feature::LAZY_SYNC);
+    const auto qoi  = this->hasFeature(other, types::enums::Feature::QOI_IMAGE);
+
+    if (lazy && (qoi || !hasQoi)) {
+      this->sendPacket(other, packet);
+    } else {
+      promise->relays.append(other);
+    }
+  }
+
+  // nothing to fetch for the others
+  if (promise->relays.isEmpty()) return;
 
+  // fetch the promised payloads for the others
+  for (const auto &item : promised) {
+    this->requestPayload(promise, item.first);
+  }
+
+  // send if nothing is in flight
+  this->relayPromise(promise);
+}
+
+/**
+ * @brief Process the HistorySummaryPacket from the client
+ *
+ * @param packet HistorySummaryPacket
+ */
+void Server::processHistorySummaryPacket(const packets::HistorySummaryPacket &packet) {
   // get the Sender of the packet
   auto client = qobject_cast<QSslSocket *>(sender());
 
-  // send the response packet
-  this->sendPacket(packet, client);
+  // peer information of the client
+  auto cert = client->peerCertificate();
+  auto name = cert.subjectInfo(QSslCertificate::CommonName).constFirst();
+
+  // create the device
+  auto device = types::Device {
+    client->peerAddress(), client->peerPort(), name
+  };
+
+  // remember the history of the client to place its entries
+  m_catchUps[client].history = packet.getEntries();
+
+  // Notify the listeners to catch up the client
+  emit OnHistorySummary(device, packet.getEntries(), packet.getFreeSlots());
+}
+
+/**
+ * @brief Process the CapabilityPacket from the client
+ *
+ * @param packet CapabilityPacket
+ */
+void Server::processCapabilityPacket(const packets::CapabilityPacket &packet) {
+  // get the Sender of the packet
+  auto client = qobject_cast<QSslSocket *>(sender());
+
+  // remember the features of the client
+  client->setProperty(FEATURES, packet.getFeatures());
+}
+
+/**
+ * @brief Does the client understand the feature, clients
+ * that predate the capability packet understand none
+ */
+bool Server::hasFeature(QSslSocket *client, types::enums::Feature feature) const {
+  return client->property(FEATURES).toUInt() & feature;
+}
+
+/**
+ * @brief Send the items as SyncPacket to the client with the
+ * QOI images as PNG if the client can't decode them
+ */
+void Server::sendItems(QSslSocket *client, const QVector<QPair<QString, QByteArray>> &items) {
+  // using createPacket to create the packet
+  using packets::SyncingPacket;
+  using utility::functions::createPacket;
+
+  // the items the client can decode
+  const auto decodable = this->hasFeature(client, types::enums::Feature::QOI_IMAGE)
+                       ? items : utility::functions::qoiItemsToPng(items);
+
+  // nothing left to send
+  if (decodable.isEmpty()) return;
+
+  // send the items to the client
+  this->sendPacket(client, createPacket({SyncingPacket::PacketType::SyncPacket, decodable}));
+}
+
+/**
+ * @brief Send the fetched items of the promise to the clients
+ * that can't take the promise once no payload is in flight
+ */
+void Server::relayPromise(Promise *promise) {
+  // wait for the payloads in flight
+  if (!promise->waiters.isEmpty()) return;
+
+  // send the items that are fetched
+  for (auto client : std::exchange(promise->relays, {})) {
+    if (m_clients.contains(client)) this->sendItems(client.data(), promise->items);
+  }
+}
+
+/**
+ * @brief Process the FileStreamPacket from the client
+ *
+ * @param packet FileStreamPacket
+ */
+void Server::processFileStreamPacket(const packets::FileStreamPacket &packet) {
+  // get the Sender of the packet
+  auto client = qobject_cast<QSslSocket *>(sender());
+
+  // process the chunk
+  this->receiverOf(client)->processPacket(packet);
+}
+
+/**
+ * @brief Get the receiver of the files streamed by the client,
+ * it is created on first use and owned by the socket
+ *
+ * @param client client that streams
+ */
+FileReceiver *Server::receiverOf(QSslSocket *client) {
+  // receiver of the client is owned by the socket
+  auto receiver = client->findChild<FileReceiver *>();
+
+  // if already created
+  if (receiver != nullptr) return receiver;
+
+  // create the receiver
+  receiver = new FileReceiver(client);
+
+  // process the received files
+  QObject::connect(
+    receiver, &FileReceiver::OnFilesReceived, this,
+    [=](QList<QUrl> files) { this->processFilesReceived(client, files); }
+  );
+
+  // return the receiver
+  return receiver;
+}
+
+/**
+ * @brief Process the files that are received from the client
+ * and stream them to the other clients
+ *
+ * @param client client that sent the files
+ * @param files local urls of the received files
+ */
+void Server::processFilesReceived(QSslSocket *client, const QList<QUrl> &files) {
+  // the items that are sent along with the files
+  const auto others = this->receiverOf(client)->takeItems();
+
+  // Notify the listeners to sync the data
+  emit OnSyncRequest(QVector<QPair<QString, QByteArray>>{{"text/uri-list", FileReceiver::toUriList(files)}} + others);
+
+  // local files of the staged copy
+  QStringList localFiles;
+
+  // convert the urls to local files
+  for (const auto &url : files) {
+    localFiles.append(url.toLocalFile());
+  }
+
+  // stream the staged copy along with the other items, the clients
+  // that can't take a stream get the uris with the items
+  for (auto other : m_clients) {
+    if (other == client) continue;
+    if (this->hasFeature(other, types::enums::Feature::FILE_STREAM)) {
+      const auto decodable = this->hasFeature(other, types::enums::Feature::QOI_IMAGE) ? others : utility::functions::qoiItemsToPng(others);
+      this->streamFiles(other, localFiles, decodable);
+    } else {
+      this->sendItems(other, QVector<QPair<QString, QByteArray>>{{"text/uri-list", FileReceiver::toUriList(files)}} + others);
+    }
+  }
+}
+
+/**
+ * @brief Stream the files to the client and stop the
+ * stream in progress to the client, the other items go
+ * right before the stream and are applied with the files
+ *
+ * @param client client to stream
+ * @param files local files
+ * @param items other items of the copy
+ */
+void Server::streamFiles(QSslSocket *client, const QStringList &files, const QVector<QPair<QString, QByteArray>> &items) {
+  // using createPacket to create the packet
+  using packets::SyncingPacket;
+  using utility::functions::createPacket;
+
+  // stop the stream in progress
+  for (auto sender : client->findChildren<FileSender *>()) {
+    sender->cancel();
+  }
+
+  // the other items go right before the stream, even if none
+  this->sendPacket(client, createPacket({SyncingPacket::PacketType::StreamItems, items}));
+
+  // start the stream
+  (new FileSender(client, files))->start();
+}
+
+/**
+ * @brief Process the PayloadPacket from the client
+ *
+ * @param packet PayloadPacket
+ */
+void Server::processPayloadPacket(const packets::PayloadPacket &packet) {
+  // using PayloadPacket
+  using packets::PayloadPacket;
+
+  // get the Sender of the packet
+  auto client  = qobject_cast<QSslSocket *>(sender());
+
+  // get the promise id and mime type
+  const auto id   = packet.getPromiseId();
+  const auto mime = QString::fromUtf8(packet.getMimeType());
+  auto promise    = this->findPromise(id);
+
+  // if it is response from the owner then resolve it
+  if (packet.getPacketType() == PayloadPacket::PacketType::PayloadResponse) {
+    if (promise == nullptr || promise->owner != client) return;
+    return this->resolvePayload(promise, mime, packet.getPayload());
+  }
+
+  // the payload if it is already known
+  QByteArray payload;
+
+  // find the payload
+  if (promise != nullptr) {
+    for (const auto &[m, data] : promise->items) {
+      if (m == mime) payload = data;
+    }
+  }
+
+  // if not known then wait for the owner
+  if (promise != nullptr && payload.isEmpty() && this->requestPayload(promise, mime)) {
+    return promise->waiters[mime].append(client);
+  }
+
+  // create the response packet, empty payload tells not available
+  auto response = utility::functions::createPacket(utility::functions::params::PayloadPacketParams{
+    PayloadPacket::PacketType::PayloadResponse, id, mime, payload
+  });
+
+  // send the response to the client
+  this->sendPacket(client, response);
+}
+
+/**
+ * @brief Add the promise and remove the oldest one
+ */
+void Server::addPromise(const Promise &promise) {
+  // add the promise
+  m_promises.append(promise);
+
+  // if not full
+  if (m_promises.size() <= constants::getAppMaxPromises()) {
+    return;
+  }
+
+  // remove the oldest promise
+  auto oldest = m_promises.takeFirst();
+
+  // fail the payloads that are pending on it
+  for (const auto &mime : oldest.waiters.keys()) {
+    this->resolvePayload(&oldest, mime, QByteArray());
+  }
+}
+
+/**
+ * @brief Find the promise by id
+ *
+ * @return pointer to promise or nullptr
+ */
+Server::Promise *Server::findPromise(quint64 id) {
+  for (auto &promise : m_promises) {
+    if (promise.id == id) return &promise;
+  }
+
+  for (auto &catchUp : m_catchUps) {
+    for (auto &promise : catchUp.promises) {
+      if (promise.id == id) return &promise;
+    }
+  }
+
+  return nullptr;
+}
+
+/**
+ * @brief Request the payload from the owner of the promise if
+ * not already requested
+ *
+ * @return false if the payload can't be requested
+ */
+bool Server::requestPayload(Promise *promise, const QString &mime) {
+  // if already requested
+  if (promise->waiters.contains(mime)) {
+    return true;
+  }
+
+  // if the owner is gone or the promise is made by the server
+  if (promise->owner.isNull()) {
+    return false;
+  }
+
+  // using PayloadPacket
+  using packets::PayloadPacket;
+
+  // create the request packet
+  auto request = utility::functions::createPacket(utility::functions::params::PayloadPacketParams{
+    PayloadPacket::PacketType::PayloadRequest, promise->id, mime, QByteArray()
+  });
+
+  // mark as requested
+  promise->waiters.insert(mime, {});
+
+  // forward the request to the owner
+  this->sendPacket(promise->owner.data(), request);
+
+  // requested
+  return true;
+}
+
+/**
+ * @brief Send the payload to the waiting clients and notify
+ */
+void Server::resolvePayload(Promise *promise, const QString &mime, const QByteArray &payload) {
+  // cache the payload for other requests
+  if (!payload.isEmpty()) {
+    promise->items.append({mime, payload});
+  }
+
+  // using PayloadPacket
+  using packets::PayloadPacket;
+
+  // create the response packet
+  auto response = utility::functions::createPacket(utility::functions::params::PayloadPacketParams{
+    PayloadPacket::PacketType::PayloadResponse, promise->id, mime, payload
+  });
+
+  // send the response to the waiting clients
+  for (auto client : promise->waiters.take(mime)) {
+    if (m_clients.contains(client)) this->sendPacket(client.data(), response);
+  }
+
+  // call the local fetches
+  for (const auto &callback : promise->callbacks.take(mime)) {
+    callback(payload);
+  }
+
+  // send the items to the clients that can't take the promise
+  this->relayPromise(promise);
+
+  // Notify the listeners
+  emit OnPayloadReceived(promise->id, mime, payload);
 }
 
 /**
@@ -197,67 +648,168 @@ void Server::processReadyRead() {
   // if not authenticated then return
   if (!m_clients.contains(client)) return;
 
-  // using the fromQByteArray from namespace
-  using utility::functions::createPacket;
-  using utility::functions::fromQByteArray;
-
   // get the first four bytes of the packet
   QDataStream get(client);
 
-  // QByteArray to store the data
-  QByteArray data;
+  // process all the complete packets that are buffered
+  while (m_clients.contains(client) && client->bytesAvailable() > 0) {
+    // QByteArray to store the data
+    QByteArray data;
 
-  /// uploader QDataStream
-  QDataStream put(&data, QIODevice::WriteOnly);
+    /// uploader QDataStream
+    QDataStream put(&data, QIODevice::WriteOnly);
 
-  // start the transaction
-  get.startTransaction();
+    // start the transaction
+    get.startTransaction();
 
-  // get the packet length
-  qint32 packetLength;
+    // get the packet length
+    qint32 packetLength;
 
-  // read the packet length
-  get >> packetLength;
+    // read the packet length
+    get >> packetLength;
 
-  // write the packet length
-  put << packetLength;
+    // write the packet length
+    put << packetLength;
+
+    // infer the read size
+    qint32 toRead = packetLength - data.size();
+
+    // check has enough bytes
+    if (client->bytesAvailable() < toRead) {
+      return get.rollbackTransaction();
+    }
 
-  // infer the read size
-  qint32 toRead = packetLength - data.size();
+    // resize the data
+    data.resize(packetLength);
 
-  // check has enough bytes
-  if (client->bytesAvailable() < toRead) {
-    return get.rollbackTransaction();
+    // read the data from the socket
+    auto start = data.data() + data.size() - toRead;
+    auto bytes = get.readRawData(start, toRead);
+
+    // check for error
+    if (bytes == -1) {
+      return get.rollbackTransaction();
+    }
+
+    // update the toRead
+    toRead -= bytes;
+
+    // if toRead is not zero then return
+    if (toRead) {
+      return get.rollbackTransaction();
+    }
+
+    // commit the transaction
+    if (!get.commitTransaction()) {
+      return;
+    }
+
+    // process the packet
+    this->processPacket(client, data);
   }
+}
 
-  // resize the data
-  data.resize(packetLength);
+/**
+ * @brief Parse the packet and process it
+ */
+void Server::processPacket(QSslSocket *client, const QByteArray &data) {
+  // using the fromQByteArray from namespace
+  using utility::functions::createPacket;
+  using utility::functions::fromQByteArray;
 
-  // read the data from the socket
-  auto start = data.data() + data.size() - toRead;
-  auto bytes = get.readRawData(start, toRead);
+  // Deserialize the data to SyncingPacket
+  try {
+    this->processSyncingPacket(fromQByteArray<packets::SyncingPacket>(data));
+    return;
+  } catch (const types::except::MalformedPacket &e) {
+    const auto type = packets::InvalidRequest::PacketType::RequestFailed;
+    this->sendPacket(client, createPacket({type, e.getCode(), e.what()}));
+    return;
+  } catch (const types::except::NotThisPacket &e) {
+    qDebug() << (LOG(e.what()));
+  } catch (const std::exception &e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (...) {
+    qDebug() << (LOG("Unknown Error"));
+    return;
+  }
 
-  // check for error
-  if (bytes == -1) {
-    return get.rollbackTransaction();
+  // Deserialize the data to FileStreamPacket
+  try {
+    this->processFileStreamPacket(fromQByteArray<packets::FileStreamPacket>(data));
+    return;
+  } catch (const types::except::MalformedPacket &e) {
+    const auto type = packets::InvalidRequest::PacketType::RequestFailed;
+    this->sendPacket(client, createPacket({type, e.getCode(), e.what()}));
+    return;
+  } catch (const types::except::NotThisPacket &e) {
+    qDebug() << (LOG(e.what()));
+  } catch (const std::exception &e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (...) {
+    qDebug() << (LOG("Unknown Error"));
+    return;
   }
 
-  // update the toRead
-  toRead -= bytes;
+  // Deserialize the data to PromisePacket
+  try {
+    this->processPromisePacket(fromQByteArray<packets::PromisePacket>(data));
+    return;
+  } catch (const types::except::MalformedPacket &e) {
+    const auto type = packets::InvalidRequest::PacketType::RequestFailed;
+    this->sendPacket(client, createPacket({type, e.getCode(), e.what()}));
+    return;
+  } catch (const types::except::NotThisPacket &e) {
+    qDebug() << (LOG(e.what()));
+  } catch (const std::exception &e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (...) {
+    qDebug() << (LOG("Unknown Error"));
+    return;
+  }
 
-  // if toRead is not zero then return
-  if (toRead) {
-    return get.rollbackTransaction();
+  // Deserialize the data to HistorySummaryPacket
+  try {
+    this->processHistorySummaryPacket(fromQByteArray<packets::HistorySummaryPacket>(data));
+    return;
+  } catch (const types::except::MalformedPacket &e) {
+    const auto type = packets::InvalidRequest::PacketType::RequestFailed;
+    this->sendPacket(client, createPacket({type, e.getCode(), e.what()}));
+    return;
+  } catch (const types::except::NotThisPacket &e) {
+    qDebug() << (LOG(e.what()));
+  } catch (const std::exception &e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (...) {
+    qDebug() << (LOG("Unknown Error"));
+    return;
   }
 
-  // commit the transaction
-  if (!get.commitTransaction()) {
+  // Deserialize the data to CapabilityPacket
+  try {
+    this->processCapabilityPacket(fromQByteArray<packets::CapabilityPacket>(data));
+    return;
+  } catch (const types::except::MalformedPacket &e) {
+    const auto type = packets::InvalidRequest::PacketType::RequestFailed;
+    this->sendPacket(client, createPacket({type, e.getCode(), e.what()}));
+    return;
+  } catch (const types::except::NotThisPacket &e) {
+    qDebug() << (LOG(e.what()));
+  } catch (const std::exception &e) {
+    qDebug() << (LOG(e.what()));
+    return;
+  } catch (...) {
+    qDebug() << (LOG("Unknown Error"));
     return;
   }
 
-  // Deserialize the data to SyncingPacket
+  // Deserialize the data to PayloadPacket
   try {
-    this->processSyncingPacket(fromQByteArray<packets::SyncingPacket>(data));
+    this->processPayloadPacket(fromQByteArray<packets::PayloadPacket>(data));
     return;
   } catch (const types::except::MalformedPacket &e) {
     const auto type = packets::InvalidRequest::PacketType::RequestFailed;
@@ -387,8 +939,206 @@ Server::Server(QObject *parent) : service::mdnsRegister(parent) {
  * @param data QVector<QPair<QString, QByteArray>>
  */
 void Server::syncItems(QVector<QPair<QString, QByteArray>> items) {
-  const auto packType = packets::SyncingPacket::PacketType::SyncPacket;
-  this->sendPacket(utility::functions::createPacket({packType, items}));
+  // using createPacket to create the packet
+  using packets::PromisePacket;
+  using utility::functions::createPacket;
+  using types::enums::Feature;
+
+  // the copied files are streamed instead of their uris
+  const auto files  = FileSender::getLocalFiles(items);
+  const auto others = FileSender::getOtherItems(items);
+
+  // threshold above which the items are promised
+  const auto threshold = constants::getAppLazySyncThreshold();
+
+  // is the item large enough to promise
+  const auto isLarge = [=](const QPair<QString, QByteArray> &item) {
+    return quint32(item.second.size()) > threshold;
+  };
+
+  // is anything worth to promise
+  const auto promising = m_lazySync && std::any_of(items.begin(), items.end(), isLarge);
+
+  // does the copy carry a QOI image, only the clients that decode
+  // QOI can take it as promise like the relayed promises
+  const auto hasQoi = std::any_of(items.begin(), items.end(), [](const auto &item) {
+    return item.first == "image/qoi";
+  });
+
+  // the promise of the items, made once for all the lazy clients
+  std::optional<PromisePacket> promise;
+
+  // create the promise and remember the items to serve the requests
+  const auto promiseOf = [&]() -> const PromisePacket & {
+    // if already made
+    if (promise.has_value()) return *promise;
+
+    // promise params of the items
+    QVector<utility::functions::params::PromiseItemParams> params;
+
+    // large items are described without payload
+    for (const auto &item : items) {
+      const auto &[mime, data] = item;
+      params.append({mime, quint32(data.size()), utility::functions::xxh3(data), isLarge(item) ? QByteArray() : data});
+    }
+
+    // create the promise id
+    const auto id = QRandomGenerator::global()->generate64();
+
+    // remember the items to serve the requests
+    this->addPromise({id, nullptr, items, {}});
+
+    // create the promise
+    return promise.emplace(createPacket({PromisePacket::PacketType::Promise, id, params}));
+  };
+
+  // send to every client what it understands
+  for (auto client : m_clients) {
+    // the copied files are streamed to the clients that can take them
+    if (!files.isEmpty() && this->hasFeature(client, Feature::FILE_STREAM)) {
+      // the items the client can decode
+      const auto decodable = this->hasFeature(client, Feature::QOI_IMAGE) ? others : utility::functions::qoiItemsToPng(others);
+
+      // start the stream with the other items
+      this->streamFiles(client, files, decodable); continue;
+    }
+
+    // can the client fetch and decode the promise
+    const auto lazy = this->hasFeature(client, Feature::LAZY_SYNC);
+    const auto qoi  = this->hasFeature(client, Feature::QOI_IMAGE);
+
+    // the large items are promised to the clients that can take them
+    if (promising && lazy && (qoi || !hasQoi)) {
+      this->sendPacket(client, promiseOf()); continue;
+    }
+
+    // send the items
+    this->sendItems(client, items);
+  }
+}
+
+/**
+ * @brief Send the summary of the server history followed by the
+ * history entries the client is missing as history promises with
+ * large payloads promised, the client places the entries by the
+ * summary and sends back what the server is missing
+ *
+ * @param client client to catch up
+ * @param entries missing entries oldest first
+ * @param summary fingerprints of the server history newest first
+ * @param free entries the server can take from the client
+ */
+void Server::syncHistory(types::Device device, QVector<QVector<QPair<QString, QByteArray>>> entries, QVector<quint64> summary, quint32 free) {
+  // using createPacket to create the packet
+  using packets::HistorySummaryPacket;
+  using packets::PromisePacket;
+  using utility::functions::createPacket;
+
+  // matcher lambda function to find the client
+  const auto matcher = [&device](QSslSocket *c) {
+    return (c->peerAddress() == device.ip) && (c->peerPort() == device.port);
+  };
+
+  // find the client
+  auto itr = std::find_if(m_clients.begin(), m_clients.end(), matcher);
+
+  // if the client is gone or predates the history sync
+  if (itr == m_clients.end() || !this->hasFeature(*itr, types::enums::Feature::HISTORY_SYNC)) return;
+
+  // threshold above which the items are promised
+  const auto threshold = constants::getAppLazySyncThreshold();
+
+  // can the client decode the QOI images
+  const auto qoi = this->hasFeature(*itr, types::enums::Feature::QOI_IMAGE);
+
+  // catch-up with the client
+  auto &catchUp = m_catchUps[*itr];
+  catchUp.free  = free;
+
+  // send the summary so the client places the entries and sends what the server is missing
+  this->sendPacket(*itr, createPacket(utility::functions::params::HistorySummaryPacketParams{
+    HistorySummaryPacket::PacketType::HistorySummary, free, summary
+  }));
+
+  // send the entries, payloads are fetched when pasted
+  for (const auto &entry : entries) {
+    QVector<utility::functions::params::PromiseItemParams> params;
+
+    // the items the client can decode
+    const auto items = qoi ? entry : utility::functions::qoiItemsToPng(entry);
+
+    for (const auto &[mime, data] : items) {
+      const auto isLarge = quint32(data.size()) > threshold;
+      params.append({mime, quint32(data.size()), utility::functions::xxh3(data), isLarge ? QByteArray() : data});
+    }
+
+    // create the promise id
+    const auto id = QRandomGenerator::global()->generate64();
+
+    // remember the items to serve the requests
+    catchUp.promises.append({id, nullptr, items, {}});
+
+    // send the entry to the client
+    this->sendPacket(*itr, createPacket({PromisePacket::PacketType::HistoryPromise, id, params}));
+  }
+}
+
+/**
+ * @brief Set whether the items larger than the threshold are
+ * promised instead of sent, the payload is sent on request
+ *
+ * @param lazy lazy sync
+ */
+void Server::setLazySync(bool lazy) {
+  this->m_lazySync = lazy;
+}
+
+/**
+ * @brief Get whether the large items are promised
+ *
+ * @return bool
+ */
+bool Server::getLazySync() const {
+  return this->m_lazySync;
+}
+
+/**
+ * @brief Fetch the payload of the promised item from the
+ * owner client without blocking, the callback is called with
+ * the payload or empty on failure, disconnection or timeout
+ *
+ * @param id promise id
+ * @param mime mime type
+ * @param callback callback with the payload
+ */
+void Server::fetchPayload(quint64 id, const QString &mime, std::function<void(const QByteArray&)> callback) {
+  // find the promise
+  auto promise = this->findPromise(id);
+
+  // if not found
+  if (promise == nullptr) {
+    return callback(QByteArray());
+  }
+
+  // if the payload is known
+  for (const auto &[m, data] : promise->items) {
+    if (m == mime) return callback(data);
+  }
+
+  // request the payload from the owner
+  if (!this->requestPayload(promise, mime)) {
+    return callback(QByteArray());
+  }
+
+  // wait for the response
+  promise->callbacks[mime].append(callback);
+
+  // fail on timeout if the promise is still waiting
+  QTimer::singleShot(constants::getAppLazyFetchTimeout(), this, [this, id, mime] {
+    if (auto p = this->findPromise(id); p && p->waiters.contains(mime)) {
+      this->resolvePayload(p, mime, QByteArray());
+    }
+  });
 }
 
 /**
@@ -454,7 +1204,16 @@ types::Device Server::getServerInfo() const {
  * @param config SSL Configuration
  */
 void Server::setSslConfiguration(QSslConfiguration config) {
+  // certificate that is advertised
+  auto cert = m_server->sslConfiguration().localCertificate();
+
+  // set the configuration
   m_server->setSslConfiguration(config);
+
+  // advertise the new certificate
+  if (cert != config.localCertificate()) {
+    this->updateTxtRecord();
+  }
 }
 
 /**
@@ -600,6 +1359,14 @@ void Server::authSuccess(types::Device device) {
 
   // using AuthenticationParams
   using utility::functions::params::AuthenticationParams;
+  using utility::functions::params::CapabilityPacketParams;
+
+  // tell the features of the server before the client acts on the
+  // authentication, the client answers with its own features
+  this->sendPacket(client, utility::functions::createPacket(CapabilityPacketParams{
+    packets::CapabilityPacket::PacketType::Capability,
+    constants::getAppFeatures(),
+  }));
 
   // create the Authentication packet
   auto packet = utility::functions::createPacket(AuthenticationParams{
@@ -661,4 +1428,28 @@ void Server::authFailed(types::Device device) {
 quint16 Server::getPort() const {
   return m_server->serverPort();
 }
+
+/**
+ * @brief Get the TXT record with the protocol version, feature
+ * bits and the fingerprint of the server certificate
+ *
+ * @return QMap<QString, QByteArray>
+ */
+QMap<QString, QByteArray> Server::getTxtRecord() const {
+  // certificate of the server
+  auto cert = m_server->sslConfiguration().localCertificate();
+
+  // TXT record
+  QMap<QString, QByteArray> txt;
+
+  // protocol version & features
+  txt.insert("v", QByteArray::number(constants::getAppProtocolVersion()));
+  txt.insert("f", QByteArray::number(constants::getAppFeatures(), 16));
+
+  // fingerprint of the certificate
+  txt.insert("fp", storage::TrustStore::fingerprintOf(cert).toHex());
+
+  // return the record
+  return txt;
+}
 }  // namespace srilakshmikanthanp::clipbirdesk::network::syncing
@@ -3,18 +3,32 @@
 #include <QApplication>
 #include <QByteArray>
 #include <QList>
+#include <QMap>
 #include <QObject>
+#include <QPointer>
+#include <QRandomGenerator>
 #include <QSslConfiguration>
 #include <QSslServer>
 #include <QSslSocket>
+#include <QTimer>
 #include <QVector>
 
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <utility>
+
 #include "mdns/mdns.hpp"
+#include "store/truststore/truststore.hpp"
+#include "syncing/filereceiver/filereceiver.hpp"
+#include "syncing/filesender/filesender.hpp"
 #include "types/device.hpp"
 #include "types/enums/enums.hpp"
+#include "utility/functions/hash/hash.hpp"
 #include "utility/functions/ipconv/ipconv.hpp"
 #include "utility/functions/nbytes/nbytes.hpp"
 #include "utility/functions/packet/packet.hpp"
+#include "utility/functions/qoi/qoi.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::network::syncing {
 /**
@@ -39,6 +53,23 @@ class Server : public service::mdnsRegister {
   /// @brief On Sync Request
   void OnSyncRequest(QVector<QPair<QString, QByteArray>> items);
 
+ signals:  // signals
+  /// @brief On Promise Request (items known and promised mime with hash)
+  void OnPromiseRequest(quint64 id, QVector<QPair<QString, QByteArray>> items, QVector<QPair<QString, quint64>> promised);
+
+ signals:  // signals
+  /// @brief On Payload of a promise received
+  void OnPayloadReceived(quint64 id, QString mime, QByteArray payload);
+
+ signals:  // signals
+  /// @brief On History Summary of the client (fingerprints newest first and entries it can take)
+  void OnHistorySummary(types::Device client, QVector<quint64> entries, quint32 free);
+
+ signals:  // signals
+  /// @brief On History Entry the server is missing (items known and promised mime with hash,
+  /// and the history of the sender newest first to place the entry by recency)
+  void OnHistoryEntry(quint64 id, QVector<QPair<QString, QByteArray>> items, QVector<QPair<QString, quint64>> promised, QVector<quint64> history);
+
  signals:  // signals for this class
   /// @brief On Sync Request
   void OnClientListChanged(QList<types::Device> clients);
@@ -72,6 +103,42 @@ class Server : public service::mdnsRegister {
   /// @brief property to hold read time
   const char* READ_TIME = "READ_TIME";
 
+  /// @brief property to hold the features of the client
+  const char* FEATURES = "FEATURES";
+
+  /// @brief Promise large items instead of sending them
+  bool m_lazySync = false;
+
+  /**
+   * @brief Promise that is made by this server or relayed from
+   * the owner client, the payloads are cached once fetched and
+   * the clients waiting for the payload are tracked by mime, the
+   * clients that can't take the promise get the items once fetched
+   */
+  struct Promise {
+    quint64 id;
+    QPointer<QSslSocket> owner;
+    QVector<QPair<QString, QByteArray>> items;
+    QMap<QString, QList<QPointer<QSslSocket>>> waiters;
+    QList<QPointer<QSslSocket>> relays;
+    QMap<QString, QList<std::function<void(const QByteArray&)>>> callbacks;
+  };
+
+  /// @brief Promises that are known to the server
+  QList<Promise> m_promises;
+
+  /// @brief Catch-up of the history with a client, the history of
+  /// the client newest first, the number of entries the server still
+  /// takes from it and the promises of the entries exchanged with it
+  struct CatchUp {
+    QVector<quint64> history;
+    qsizetype free = 0;
+    QList<Promise> promises;
+  };
+
+  /// @brief Catch-up of the history by client, ends on disconnection
+  QMap<QSslSocket*, CatchUp> m_catchUps;
+
  private:  // some typedefs
 
   using MalformedPacket = types::except::MalformedPacket;
@@ -150,12 +217,126 @@ class Server : public service::mdnsRegister {
    */
   void processSyncingPacket(const packets::SyncingPacket& packet);
 
+  /**
+   * @brief Process the PromisePacket from the client
+   *
+   * @param packet PromisePacket
+   */
+  void processPromisePacket(const packets::PromisePacket& packet);
+
+  /**
+   * @brief Process the PayloadPacket from the client
+   *
+   * @param packet PayloadPacket
+   */
+  void processPayloadPacket(const packets::PayloadPacket& packet);
+
+  /**
+   * @brief Process the HistorySummaryPacket from the client
+   *
+   * @param packet HistorySummaryPacket
+   */
+  void processHistorySummaryPacket(const packets::HistorySummaryPacket& packet);
+
+  /**
+   * @brief Process the CapabilityPacket from the client
+   *
+   * @param packet CapabilityPacket
+   */
+  void processCapabilityPacket(const packets::CapabilityPacket& packet);
+
+  /**
+   * @brief Does the client understand the feature, clients
+   * that predate the capability packet understand none
+   */
+  bool hasFeature(QSslSocket* client, types::enums::Feature feature) const;
+
+  /**
+   * @brief Send the items as SyncPacket to the client with the
+   * QOI images as PNG if the client can't decode them
+   */
+  void sendItems(QSslSocket* client, const QVector<QPair<QString, QByteArray>>& items);
+
+  /**
+   * @brief Send the fetched items of the promise to the clients
+   * that can't take the promise once no payload is in flight
+   */
+  void relayPromise(Promise* promise);
+
+  /**
+   * @brief Process the FileStreamPacket from the client
+   *
+   * @param packet FileStreamPacket
+   */
+  void processFileStreamPacket(const packets::FileStreamPacket& packet);
+
+  /**
+   * @brief Get the receiver of the files streamed by the client,
+   * it is created on first use and owned by the socket
+   *
+   * @param client client that streams
+   */
+  FileReceiver* receiverOf(QSslSocket* client);
+
+  /**
+   * @brief Process the files that are received from the client
+   * and stream them to the other clients
+   *
+   * @param client client that sent the files
+   * @param files local urls of the received files
+   */
+  void processFilesReceived(QSslSocket* client, const QList<QUrl>& files);
+
+  /**
+   * @brief Stream the files to the client and stop the
+   * stream in progress to the client, the other items go
+   * right before the stream and are applied with the files
+   *
+   * @param client client to stream
+   * @param files local files
+   * @param items other items of the copy
+   */
+  void streamFiles(QSslSocket* client, const QStringList& files, const QVector<QPair<QString, QByteArray>>& items);
+
+  /**
+   * @brief Add the promise and remove the oldest one
+   */
+  void addPromise(const Promise& promise);
+
+  /**
+   * @brief Find the promise by id
+   *
+   * @return pointer to promise or nullptr
+   */
+  Promise* findPromise(quint64 id);
+
+  /**
+   * @brief Request the payload from the owner of the promise if
+   * not already requested
+   *
+   * @return false if the payload can't be requested
+   */
+  bool requestPayload(Promise* promise, const QString& mime);
+
+  /**
+   * @brief Send the payload to the waiting clients and notify
+   */
+  void resolvePayload(Promise* promise, const QString& mime, const QByteArray& payload);
+
   /**
    * @brief Callback function that process the ready
    * read from the client
    */
   void processReadyRead();
 
+  /**
+   * @brief Parse the packet and process it
+   *
+   * @param client client that sent the packet
+   * @param data packet
+   */
+  void processPacket(QSslSocket* client, const QByteArray& data);
+
   /**
    * @brief function to process the timeout
    */
@@ -184,12 +365,51 @@ class Server : public service::mdnsRegister {
   virtual ~Server() = default;
 
   /**
-   * @brief Request the clients to sync the clipboard items
+   * @brief Request the clients to sync the clipboard items, the
+   * copied local files are streamed after the other items
    *
    * @param data QVector<QPair<QString, QByteArray>>
    */
   void syncItems(QVector<QPair<QString, QByteArray>> items);
 
+  /**
+   * @brief Send the summary of the server history followed by the
+   * history entries the client is missing as history promises with
+   * large payloads promised
+   *
+   * @param client client to catch up
+   * @param entries missing entries oldest first
+   * @param summary fingerprints of the server history newest first
+   * @param free entries the server can take from the client
+   */
+  void syncHistory(types::Device client, QVector<QVector<QPair<QString, QByteArray>>> entries, QVector<quint64> summary, quint32 free);
+
+  /**
+   * @brief Set whether the items larger than the threshold are
+   * promised instead of sent, the payload is sent on request
+   *
+   * @param lazy lazy sync
+   */
+  void setLazySync(bool lazy);
+
+  /**
+   * @brief Get whether the large items are promised
+   *
+   * @return bool
+   */
+  bool getLazySync() const;
+
+  /**
+   * @brief Fetch the payload of the promised item from the
+   * owner client without blocking, the callback is called with
+   * the payload or empty on failure, disconnection or timeout
+   *
+   * @param id promise id
+   * @param mime mime type
+   * @param callback callback with the payload
+   */
+  void fetchPayload(quint64 id, const QString& mime, std::function<void(const QByteArray&)> callback);
+
   /**
    * @brief Get the Clients that are connected to the server
    */
@@ -276,5 +496,13 @@ class Server : public service::mdnsRegister {
    * @throw Any Exception If any error occurs
    */
   virtual quint16 getPort() const override;
+
+  /**
+   * @brief Get the TXT record with the protocol version, feature
+   * bits and the fingerprint of the server certificate
+   *
+   * @return QMap<QString, QByteArray>
+   */
+  virtual QMap<QString, QByteArray> getTxtRecord() const override;
 };
 }  // namespace srilakshmikanthanp::clipbirdesk::network::syncing
@@ -33,4 +33,25 @@ enum HostType: quint32 {
   CLIENT = 0x01,
   NONE   = 0x03
 };
+
+/// @brief Image codec used to encode clipboard images
+enum ImageCodec : quint32 {
+  PNG = 0x00,
+  QOI = 0x01
+};
+
+/// @brief Features advertised by the server
+enum Feature : quint32 {
+  LAZY_SYNC    = 0x01,
+  FILE_STREAM  = 0x02,
+  HISTORY_SYNC = 0x04,
+  QOI_IMAGE    = 0x08
+};
+
+/// @brief Key algorithm of the host identity
+enum KeyType : quint32 {
+  RSA     = 0x00,
+  ECDSA   = 0x01,
+  ED25519 = 0x02
+};
 }  // namespace srilakshmikanthanp::clipbirdesk::types::enums
@@ -0,0 +1,125 @@
+#include "clipdelegate.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::ui::gui::components {
+/**
+ * @brief Tile area of the row
+ */
+QRect ClipDelegate::tileRect(const QRect &rect) const {
+  return rect.adjusted(2, 2, -2, -2);
+}
+
+/**
+ * @brief Area of the copy button
+ */
+QRect ClipDelegate::copyRect(const QRect &rect) const {
+  const auto tile = this->tileRect(rect);
+  const auto x    = tile.right() - MARGIN - 2 * BUTTON - MARGIN;
+  const auto y    = tile.bottom() - MARGIN - BUTTON;
+  return QRect(x, y, BUTTON, BUTTON);
+}
+
+/**
+ * @brief Area of the delete button
+ */
+QRect ClipDelegate::deleteRect(const QRect &rect) const {
+  const auto tile = this->tileRect(rect);
+  const auto x    = tile.right() - MARGIN - BUTTON;
+  const auto y    = tile.bottom() - MARGIN - BUTTON;
+  return QRect(x, y, BUTTON, BUTTON);
+}
+
+/**
+ * @brief Construct a new Clip Delegate object
+ *
+ * @param parent
+ */
+ClipDelegate::ClipDelegate(QObject *parent) : QStyledItemDelegate(parent) {
+  // Nothing to do
+}
+
+/**
+ * @brief Paint the tile
+ */
+void ClipDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const {
+  // is dark theme
+  const auto scheme = QGuiApplication::styleHints()->colorScheme();
+  const auto isDark = scheme == Qt::ColorScheme::Dark;
+
+  // tile background same as the old tile style sheet
+  const auto tile = this->tileRect(option.rect);
+  QPainterPath path;
+  path.addRoundedRect(tile, RADIUS, RADIUS);
+
+  painter->save();
+  painter->setRenderHint(QPainter::Antialiasing);
+  painter->fillPath(path, isDark ? QColor("#2d2d2d") : QColor("#ededed"));
+
+  // hover highlight
+  if (option.state & QStyle::State_MouseOver) {
+    painter->fillPath(path, isDark ? QColor(255, 255, 255, 12) : QColor(0, 0, 0, 12));
+  }
+
+  // preview area
+  const QRect preview(tile.left() + MARGIN, tile.top() + MARGIN, tile.width() - 2 * MARGIN, PREVIEW);
+
+  // draw the image or the text
+  const auto image = index.data(Qt::DecorationRole).value<QImage>();
+
+  if (!image.isNull()) {
+    const auto size = image.size().scaled(preview.size(), Qt::KeepAspectRatio).boundedTo(image.size());
+    const QRect target(preview.topLeft() + QPoint(0, (preview.height() - size.height()) / 2), size);
+    painter->drawImage(target, image);
+  } else {
+    painter->setPen(option.palette.color(QPalette::Text));
+    painter->setFont(option.font);
+    painter->drawText(preview, Qt::AlignLeft | Qt::AlignTop | Qt::TextWordWrap, index.data(Qt::DisplayRole).toString());
+  }
+
+  // buttons
+  copyIcon.paint(painter, this->copyRect(option.rect));
+  deleteIcon.paint(painter, this->deleteRect(option.rect));
+
+  painter->restore();
+}
+
+/**
+ * @brief Size of the tile
+ */
+QSize ClipDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const {
+  return QSize(TILE_WIDTH, TILE_HEIGHT);
+}
+
+/**
+ * @brief Handle the clicks on the buttons
+ */
+bool ClipDelegate::editorEvent(QEvent *event, QAbstractItemModel *model, const QStyleOptionViewItem &option, const QModelIndex &index) {
+  // only the release of left button
+  if (event->type() != QEvent::MouseButtonRelease) {
+    return QStyledItemDelegate::editorEvent(event, model, option, index);
+  }
+
+  // position of the click
+  const auto mouse = static_cast<QMouseEvent *>(event);
+  const auto pos   = mouse->position().toPoint();
+
+  // if not left button
+  if (mouse->button() != Qt::LeftButton) {
+    return false;
+  }
+
+  // copy clicked
+  if (this->copyRect(option.rect).contains(pos)) {
+    emit onClipCopy(index.row());
+    return true;
+  }
+
+  // delete clicked
+  if (this->deleteRect(option.rect).contains(pos)) {
+    emit onClipDelete(index.row());
+    return true;
+  }
+
+  // not handled
+  return false;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::components
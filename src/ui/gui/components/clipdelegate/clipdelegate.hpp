@@ -0,0 +1,99 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QEvent>
+#include <QGuiApplication>
+#include <QIcon>
+#include <QImage>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPainterPath>
+#include <QStyledItemDelegate>
+#include <QStyleHints>
+
+namespace srilakshmikanthanp::clipbirdesk::ui::gui::components {
+/**
+ * @brief Paints a history row as a tile with the preview and the copy
+ * and delete buttons, the buttons are painted too so a row costs no
+ * widget and only the visible rows are painted
+ */
+class ClipDelegate : public QStyledItemDelegate {
+ private:  // disable copy and move for this class
+
+  Q_DISABLE_COPY_MOVE(ClipDelegate)
+
+ private:  // just for Qt
+
+  Q_OBJECT
+
+ private:  // Member variable
+
+  const int TILE_HEIGHT = 130;
+  const int TILE_WIDTH  = 320;
+  const int PREVIEW     = 80;
+  const int MARGIN      = 10;
+  const int BUTTON      = 20;
+  const int RADIUS      = 10;
+
+ private:  // Member variable
+
+  QIcon copyIcon   = QIcon(":/images/copy.png");
+  QIcon deleteIcon = QIcon(":/images/delete.png");
+
+ signals:  // signals
+
+  // called when the copy button of the row is clicked
+  void onClipCopy(int row);
+
+  // called when the delete button of the row is clicked
+  void onClipDelete(int row);
+
+ private:  // Member Functions
+
+  /**
+   * @brief Tile area of the row
+   */
+  QRect tileRect(const QRect &rect) const;
+
+  /**
+   * @brief Area of the copy button
+   */
+  QRect copyRect(const QRect &rect) const;
+
+  /**
+   * @brief Area of the delete button
+   */
+  QRect deleteRect(const QRect &rect) const;
+
+ public:  // Constructor and Destructor
+
+  /**
+   * @brief Construct a new Clip Delegate object
+   *
+   * @param parent
+   */
+  explicit ClipDelegate(QObject *parent = nullptr);
+
+  /**
+   * @brief Destroy the Clip Delegate object
+   */
+  ~ClipDelegate() = default;
+
+ public:  // QStyledItemDelegate
+
+  /**
+   * @brief Paint the tile
+   */
+  void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+  /**
+   * @brief Size of the tile
+   */
+  QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+  /**
+   * @brief Handle the clicks on the buttons
+   */
+  bool editorEvent(QEvent *event, QAbstractItemModel *model, const QStyleOptionViewItem &option, const QModelIndex &index) override;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::components
@@ -7,10 +7,17 @@ namespace srilakshmikanthanp::clipbirdesk::ui::gui::components {
  * @param parent
  */
 ClipHistory::ClipHistory(QWidget *parent) : QWidget(parent) {
-  // set alignment from start and center
-  clipListLayout->setAlignment(Qt::AlignTop);
-  clipListLayout->setContentsMargins(0, 0, 0, 0);
-  clipListLayout->setSpacing(0);
+  // the view lays out only the visible rows as all have same size
+  clipListView->setModel(model);
+  clipListView->setItemDelegate(delegate);
+  clipListView->setUniformItemSizes(true);
+  clipListView->setMouseTracking(true);
+  clipListView->setFrameShape(QFrame::NoFrame);
+  clipListView->setSelectionMode(QAbstractItemView::NoSelection);
+  clipListView->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+  clipListView->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+  clipListView->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+  clipListView->setObjectName("ClipList");
 
   // set alignment as center
   label->setAlignment(Qt::AlignCenter);
@@ -25,7 +32,7 @@ ClipHistory::ClipHistory(QWidget *parent) : QWidget(parent) {
   this->stackLayout->setAlignment(label, Qt::AlignCenter);
 
   // add the layout to the stack layout
-  this->stackLayout->addWidget(clipListWidget);
+  this->stackLayout->addWidget(clipListView);
 
   // set the layout
   this->setLayout(this->stackLayout);
@@ -36,10 +43,43 @@ ClipHistory::ClipHistory(QWidget *parent) : QWidget(parent) {
   // set up initial language
   this->setUpLanguage();
 
-  // create max clip tile
-  for (auto i = 0; i < constants::getAppMaxHistorySize(); i++) {
-    this->list.append(new ClipTile());
-  }
+  // connect the delete signal to this signal
+  QObject::connect(
+    delegate, &ClipDelegate::onClipDelete,
+    this, &ClipHistory::onClipDelete
+  );
+
+  // connect the copy signal to this signal
+  QObject::connect(
+    delegate, &ClipDelegate::onClipCopy,
+    this, &ClipHistory::onClipSelected
+  );
+
+  // show the label when empty
+  QObject::connect(
+    model, &QAbstractItemModel::rowsInserted,
+    this, &ClipHistory::updateView
+  );
+
+  QObject::connect(
+    model, &QAbstractItemModel::rowsRemoved,
+    this, &ClipHistory::updateView
+  );
+
+  QObject::connect(
+    model, &QAbstractItemModel::modelReset,
+    this, &ClipHistory::updateView
+  );
+
+  // initial view
+  this->updateView();
+}
+
+/**
+ * @brief Show the label when there is no history
+ */
+void ClipHistory::updateView() {
+  this->stackLayout->setCurrentIndex(model->rowCount() == 0 ? 0 : 1);
 }
 
 /**
@@ -50,126 +90,64 @@ void ClipHistory::setUpLanguage() {
 }
 
 /**
- * @brief on clipDelete Impl
+ * @brief Set the History, the clips are read only when shown
  */
-void ClipHistory::onClipDeleteImpl(int idx) {
-  auto tile = this->list.at(idx);
-  clipListLayout->removeWidget(tile);
-  tile->setVisible(false);
-  tile->setClip(QVector<QPair<QString, QByteArray>>());
-  tile->setVisible(false);
-  tile->disconnect();
-  tile->setParent(nullptr);
-
-  this->repaint();
-
-  QMetaObject::invokeMethod(
-    this, "onClipDelete", Qt::QueuedConnection, Q_ARG(int, idx)
-  );
+void ClipHistory::setHistory(int count, models::ClipHistoryModel::Reader reader) {
+  this->model->setHistory(count, reader);
+  this->clipListView->scrollToTop();
 }
 
 /**
- * @brief on clipCopy Impl
+ * @brief Insert the clip at the index
  */
-void ClipHistory::onClipCopyImpl(int idx) {
-  emit onClipSelected(idx);
+void ClipHistory::insertClip(int index, const QVector<QPair<QString, QByteArray>> &clip) {
+  // insert the clip
+  this->model->insertClip(index, clip);
+
+  // newest is on the top
+  if (index == 0) this->clipListView->scrollToTop();
 }
 
 /**
- * @brief Set the History
+ * @brief Remove the clip at the index
  */
-void ClipHistory::setHistory(const QList<QVector<QPair<QString, QByteArray>>> &history) {
-  // clear the layout
-  QLayoutItem* item;
-  while ((item = clipListLayout->takeAt(0)) != nullptr) {
-    auto tile = (ClipTile*) item->widget();
-    tile->setClip(QVector<QPair<QString, QByteArray>>());
-    tile->setVisible(false);
-    tile->disconnect();
-    tile->setParent(nullptr);
-    delete item;
-  }
-
-  // set history
-  this->history = history;
-
-  // set the history
-  for (auto idx = 0L; idx < history.size(); idx++) {
-    // get the tile from the list
-    ClipTile *tile  = this->list.at(idx);
-
-    // set the clip
-    tile->setClip(history.at(idx));
-
-    // connect the copy signal to this signal
-    QObject::connect(
-      tile, &components::ClipTile::onClipDelete,
-      [=]() { this->onClipDeleteImpl(idx); }
-    );
-
-    // connect the select signal to this signal
-    QObject::connect(
-      tile, &components::ClipTile::onClipCopy,
-      [=]() { this->onClipCopyImpl(idx); }
-    );
-
-    clipListLayout->addWidget(tile);
-
-    // set the visibility
-    tile->setVisible(true);
-  }
+void ClipHistory::removeClip(int index) {
+  this->model->removeClip(index);
+}
 
-  // update
-  this->repaint();
+/**
+ * @brief Update the clip at the index
+ */
+void ClipHistory::updateClip(int index, const QVector<QPair<QString, QByteArray>> &clip) {
+  this->model->updateClip(index, clip);
 }
 
 /**
  * @brief Clear the History
  */
 void ClipHistory::clearHistory() {
-  // clear the layout
-  QLayoutItem* item;
-  while ((item = clipListLayout->takeAt(0)) != nullptr) {
-    auto tile = (ClipTile*) item->widget();
-    tile->setClip(QVector<QPair<QString, QByteArray>>());
-    tile->setVisible(false);
-    tile->disconnect();
-    tile->setParent(nullptr);
-    delete item;
-  }
-
-  // update
-  this->repaint();
-
-  // clear the history
-  this->history.clear();
+  this->model->clearHistory();
 }
 
 /**
- * @brief get the History
+ * @brief Show only the clips at the index
  */
-QList<QVector<QPair<QString, QByteArray>>> ClipHistory::getHistory() {
-  return history;
+void ClipHistory::setFilter(const QVector<int> &indices) {
+  // index to show
+  const QSet<int> shown(indices.begin(), indices.end());
+
+  // rows are in the order of history
+  for (auto row = 0; row < model->rowCount(); row++) {
+    clipListView->setRowHidden(row, !shown.contains(row));
+  }
 }
 
 /**
- * @brief Destroy the Clip Hist object
+ * @brief Show all the clips
  */
-ClipHistory::~ClipHistory() {
-  // clear the layout
-  QLayoutItem* item;
-  while ((item = clipListLayout->takeAt(0)) != nullptr) {
-    auto tile = (ClipTile*) item->widget();
-    tile->disconnect();
-    tile->setClip(QVector<QPair<QString, QByteArray>>());
-    tile->setVisible(false);
-    tile->setParent(nullptr);
-    delete item;
-  }
-
-  // delete clipHist
-  for (auto clipHist: this->list) {
-    clipHist->deleteLater();
+void ClipHistory::clearFilter() {
+  for (auto row = 0; row < model->rowCount(); row++) {
+    clipListView->setRowHidden(row, false);
   }
 }
 
@@ -188,13 +166,6 @@ void ClipHistory::changeEvent(QEvent *event) {
  * @brief Paint event
  */
 void ClipHistory::paintEvent(QPaintEvent *event) {
-  // if the vertical layout is empty then add a label
-  if (clipListLayout->count() == 0) {
-    this->stackLayout->setCurrentIndex(0);
-  } else {
-    this->stackLayout->setCurrentIndex(1);
-  }
-
   // For Style sheet
   QStyleOption opt;
   opt.initFrom(this);
@@ -1,17 +1,16 @@
 #pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
 
 #include <QEvent>
-#include <QHBoxLayout>
 #include <QLabel>
-#include <QLineEdit>
+#include <QListView>
 #include <QPainter>
-#include <QStyle>
-#include <QPushButton>
+#include <QSet>
 #include <QStackedLayout>
+#include <QStyle>
 #include <QStyleOption>
 
-#include "constants/constants.hpp"
-#include "ui/gui/components/cliptile/cliptile.hpp"
+#include "ui/gui/components/clipdelegate/clipdelegate.hpp"
+#include "ui/gui/models/cliphistorymodel/cliphistorymodel.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::ui::gui::components {
 class ClipHistory : public QWidget {
@@ -25,11 +24,10 @@ class ClipHistory : public QWidget {
 
  private:  // Member variable
 
-  QStackedLayout* stackLayout = new QStackedLayout();
-  QWidget* clipListWidget     = new QWidget();
-  QVBoxLayout* clipListLayout = new QVBoxLayout(clipListWidget);
-  QList<ClipTile*> list       = QList<ClipTile*>();
-  QList<QVector<QPair<QString, QByteArray>>> history;
+  QStackedLayout* stackLayout      = new QStackedLayout();
+  QListView* clipListView          = new QListView();
+  models::ClipHistoryModel* model  = new models::ClipHistoryModel(this);
+  ClipDelegate* delegate           = new ClipDelegate(this);
 
  private:  // Member variable (With Text Info)
 
@@ -49,14 +47,9 @@ class ClipHistory : public QWidget {
  private:  // Member Functions
 
   /**
-   * @brief on clipDelete Impl
-   */
-  void onClipDeleteImpl(int idx);
-
-  /**
-   * @brief on clipCopy Impl
+   * @brief Show the label when there is no history
    */
-  void onClipCopyImpl(int idx);
+  void updateView();
 
   /**
    * @brief Function used to set up all text in the label, etc..
@@ -75,14 +68,29 @@ class ClipHistory : public QWidget {
   /**
    * @brief Destroy the Clip Hist object
    */
-  ~ClipHistory();
+  ~ClipHistory() = default;
 
  public:  // public member function
 
   /**
-   * @brief Set the History
+   * @brief Set the History, the clips are read only when shown
    */
-  void setHistory(const QList<QVector<QPair<QString, QByteArray>>> &);
+  void setHistory(int count, models::ClipHistoryModel::Reader reader);
+
+  /**
+   * @brief Insert the clip at the index
+   */
+  void insertClip(int index, const QVector<QPair<QString, QByteArray>> &clip);
+
+  /**
+   * @brief Remove the clip at the index
+   */
+  void removeClip(int index);
+
+  /**
+   * @brief Update the clip at the index
+   */
+  void updateClip(int index, const QVector<QPair<QString, QByteArray>> &clip);
 
   /**
    * @brief Clear the History
@@ -90,9 +98,14 @@ class ClipHistory : public QWidget {
   void clearHistory();
 
   /**
-   * @brief get the History
+   * @brief Show only the clips at the index
+   */
+  void setFilter(const QVector<int> &indices);
+
+  /**
+   * @brief Show all the clips
    */
-  QList<QVector<QPair<QString, QByteArray>>> getHistory();
+  void clearFilter();
 
  protected:  // protected member function
 
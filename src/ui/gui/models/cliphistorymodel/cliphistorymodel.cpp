@@ -0,0 +1,270 @@
+#include "cliphistorymodel.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::ui::gui::models {
+/**
+ * @brief Create the preview of the clip at the row
+ */
+ClipHistoryModel::Preview ClipHistoryModel::previewOf(
+  int row,
+  const QVector<QPair<QString, QByteArray>> &clip,
+  const QVector<QPair<QString, quint64>> &hashes
+) const {
+  // infer the data
+  for (const auto &[mime, data] : clip) {
+    // is image
+    const auto isImage = mime == MIME_TYPE_PNG || mime == MIME_TYPE_QOI;
+
+    // key of the image is the hash the store already has
+    const auto hash = std::find_if(hashes.begin(), hashes.end(), [&](const auto &item) {
+      return item.first == mime;
+    });
+
+    // has Image use the cached thumbnail or make it in background
+    if (isImage && hash != hashes.end()) {
+      const auto key   = hash->second;
+      const auto thumb = this->thumbnailer->cached(key);
+
+      if (!thumb.isNull()) {
+        return {QString(), thumb};
+      }
+
+      // the row waits for the thumbnail
+      this->waiting[key].append(QPersistentModelIndex(this->index(row)));
+
+      // the spilled image is looked up in the disk cache first
+      this->thumbnailer->request(key, mime, data);
+
+      return {QString(), this->placeholder};
+    }
+
+    // has Urls show the file names
+    if (mime == MIME_TYPE_URLS) {
+      QStringList names;
+      for (const auto &line : data.split('\n')) {
+        const auto url = QUrl::fromEncoded(line.trimmed());
+        if (!url.fileName().isEmpty()) names.append(url.fileName());
+      }
+      return {names.join("\n").left(TXT_SIZE), QImage()};
+    }
+
+    // has Text trim the text to 200 characters
+    if (mime == MIME_TYPE_TEXT) {
+      return {QString::fromUtf8(data.left(TXT_SIZE * 4)).left(TXT_SIZE), QImage()};
+    }
+  }
+
+  // nothing to preview
+  return {};
+}
+
+/**
+ * @brief Create the preview of the row, the spilled text is
+ * paged in while the spilled image is keyed by its hash
+ */
+ClipHistoryModel::Preview ClipHistoryModel::previewOf(int row) const {
+  // if nothing to read from
+  if (!this->reader) return {};
+
+  try {
+    // the clip as it is in memory with the hashes
+    QVector<QPair<QString, quint64>> hashes;
+    auto clip = this->reader(row, false, &hashes);
+
+    // is the text needed by the preview spilled
+    const auto spilled = std::any_of(clip.begin(), clip.end(), [this](const auto &item) {
+      return item.second.isNull() && (item.first == MIME_TYPE_TEXT || item.first == MIME_TYPE_URLS);
+    });
+
+    // page in only for the text
+    if (spilled) clip = this->reader(row, true, nullptr);
+
+    // make the preview
+    return this->previewOf(row, clip, hashes);
+  } catch (const std::exception &e) {
+    qWarning() << LOG(std::string("Failed to read clip: ") + e.what());
+    return {};
+  }
+}
+
+/**
+ * @brief Show the thumbnail on the rows waiting for it
+ */
+void ClipHistoryModel::handleThumbnailReady(quint64 key, QImage image) {
+  for (const auto &index : this->waiting.take(key)) {
+    // if the row is gone
+    if (!index.isValid() || !this->previews[index.row()]) continue;
+
+    // show the thumbnail
+    this->previews[index.row()]->image = image;
+
+    // notify the view
+    emit dataChanged(index, index, {Qt::DecorationRole});
+  }
+}
+
+/**
+ * @brief Page in the image of a row waiting for the thumbnail
+ * that is not cached and make it
+ */
+void ClipHistoryModel::handleThumbnailMissing(quint64 key) {
+  // rows waiting for the thumbnail
+  const auto rows = this->waiting.value(key);
+
+  // first row that is still there
+  const auto index = std::find_if(rows.begin(), rows.end(), [](const auto &index) {
+    return index.isValid();
+  });
+
+  // if no row is waiting
+  if (index == rows.end() || !this->reader) {
+    this->waiting.remove(key); return;
+  }
+
+  try {
+    // mime of the image with the key
+    QVector<QPair<QString, quint64>> hashes;
+    this->reader(index->row(), false, &hashes);
+
+    const auto hash = std::find_if(hashes.begin(), hashes.end(), [&](const auto &item) {
+      return item.second == key;
+    });
+
+    // page in the clip of the row and make the thumbnail
+    if (hash != hashes.end()) {
+      for (const auto &[mime, data] : this->reader(index->row(), true, nullptr)) {
+        if (mime == hash->first && !data.isEmpty()) return this->thumbnailer->request(key, mime, data);
+      }
+    }
+  } catch (const std::exception &e) {
+    qWarning() << LOG(std::string("Failed to read clip: ") + e.what());
+  }
+
+  // nothing to make the thumbnail from
+  this->waiting.remove(key);
+}
+
+/**
+ * @brief Construct a new Clip History Model object
+ *
+ * @param parent
+ */
+ClipHistoryModel::ClipHistoryModel(QObject *parent)
+    : QAbstractListModel(parent),
+      thumbnailer(new utilities::Thumbnailer(THUMB, this)),
+      placeholder(QImage(":/images/photo.png").scaled(30, 30, Qt::KeepAspectRatio)) {
+  // show the thumbnails when ready
+  QObject::connect(
+    this->thumbnailer, &utilities::Thumbnailer::OnThumbnailReady,
+    this, &ClipHistoryModel::handleThumbnailReady
+  );
+
+  // page in the images that are not cached
+  QObject::connect(
+    this->thumbnailer, &utilities::Thumbnailer::OnThumbnailMissing,
+    this, &ClipHistoryModel::handleThumbnailMissing
+  );
+}
+
+/**
+ * @brief Set the History, the clips are read only when shown
+ *
+ * @param count number of clips
+ * @param reader reads the clip at the row
+ */
+void ClipHistoryModel::setHistory(int count, Reader reader) {
+  this->beginResetModel();
+
+  this->reader = reader;
+  this->previews = QVector<std::optional<Preview>>(count);
+  this->waiting.clear();
+
+  this->endResetModel();
+}
+
+/**
+ * @brief Insert the clip at the index, the preview is made
+ * when the row is shown
+ */
+void ClipHistoryModel::insertClip(int index, const QVector<QPair<QString, QByteArray>> &clip) {
+  Q_UNUSED(clip);
+  this->beginInsertRows(QModelIndex(), index, index);
+  this->previews.insert(index, std::nullopt);
+  this->endInsertRows();
+}
+
+/**
+ * @brief Remove the clip at the index
+ */
+void ClipHistoryModel::removeClip(int index) {
+  // if no such clip
+  if (index < 0 || index >= this->previews.size()) return;
+
+  // remove the clip
+  this->beginRemoveRows(QModelIndex(), index, index);
+  this->previews.removeAt(index);
+  this->endRemoveRows();
+}
+
+/**
+ * @brief Update the clip at the index, the preview is made
+ * again when the row is shown
+ */
+void ClipHistoryModel::updateClip(int index, const QVector<QPair<QString, QByteArray>> &clip) {
+  // if no such clip
+  if (index < 0 || index >= this->previews.size()) return;
+
+  // forget the preview
+  Q_UNUSED(clip);
+  this->previews[index].reset();
+
+  // notify the view
+  emit dataChanged(this->index(index), this->index(index));
+}
+
+/**
+ * @brief Clear the History
+ */
+void ClipHistoryModel::clearHistory() {
+  this->beginResetModel();
+  this->previews.clear();
+  this->waiting.clear();
+  this->endResetModel();
+}
+
+/**
+ * @brief Number of clips
+ */
+int ClipHistoryModel::rowCount(const QModelIndex &parent) const {
+  return parent.isValid() ? 0 : this->previews.size();
+}
+
+/**
+ * @brief Text of the clip as DisplayRole and image as DecorationRole
+ */
+QVariant ClipHistoryModel::data(const QModelIndex &index, int role) const {
+  // if invalid index
+  if (!index.isValid() || index.row() >= this->previews.size()) {
+    return QVariant();
+  }
+
+  // make the preview when the row is first shown
+  auto &preview = this->previews[index.row()];
+
+  if (!preview.has_value() && (role == Qt::DisplayRole || role == Qt::DecorationRole)) {
+    preview = this->previewOf(index.row());
+  }
+
+  // if not shown yet
+  if (!preview.has_value()) return QVariant();
+
+  // return by role
+  switch (role) {
+    case Qt::DisplayRole:
+      return preview->text;
+    case Qt::DecorationRole:
+      return preview->image;
+    default:
+      return QVariant();
+  }
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::models
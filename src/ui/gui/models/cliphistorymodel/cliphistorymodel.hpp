@@ -0,0 +1,163 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QAbstractListModel>
+#include <QByteArray>
+#include <QHash>
+#include <QImage>
+#include <QList>
+#include <QPair>
+#include <QPersistentModelIndex>
+#include <QString>
+#include <QStringList>
+#include <QUrl>
+#include <QVector>
+
+// C++ header
+#include <algorithm>
+#include <functional>
+#include <optional>
+
+// Local header
+#include "ui/gui/utilities/thumbnailer/thumbnailer.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::ui::gui::models {
+/**
+ * @brief List model of the clipboard history, a row keeps only the
+ * preview of the clip (short text or small image) so the payloads are
+ * not held by the ui and the view renders only the visible rows, the
+ * preview is made when the row is first shown, the images are keyed
+ * by the stored hash and thumbnailed in background, the payload is
+ * paged in only if the thumbnail is not cached and a placeholder is
+ * shown until the thumbnail is ready
+ */
+class ClipHistoryModel : public QAbstractListModel {
+ public:  // types
+
+  /// @brief reads the clip at the row, the payloads spilled to the disk
+  /// are left empty unless paged in, the hashes are given if asked
+  using Reader = std::function<QVector<QPair<QString, QByteArray>>(
+    int row, bool pageIn, QVector<QPair<QString, quint64>> *hashes
+  )>;
+
+ private:  // disable copy and move for this class
+
+  Q_DISABLE_COPY_MOVE(ClipHistoryModel)
+
+ private:  // just for Qt
+
+  Q_OBJECT
+
+ private:  // types
+
+  /// @brief preview of the clip
+  struct Preview {
+    QString text;
+    QImage image;
+  };
+
+ private:  // Member variable
+
+  const QString MIME_TYPE_TEXT  = "text/plain";
+  const QString MIME_TYPE_PNG   = "image/png";
+  const QString MIME_TYPE_QOI   = "image/qoi";
+  const QString MIME_TYPE_URLS  = "text/uri-list";
+
+  const int TXT_SIZE = 200;
+  const int THUMB    = 100;
+
+ private:  // Member variable
+
+  mutable QVector<std::optional<Preview>> previews;
+  mutable QHash<quint64, QList<QPersistentModelIndex>> waiting;
+  utilities::Thumbnailer *thumbnailer;
+  QImage placeholder;
+  Reader reader;
+
+ private:  // Member Functions
+
+  /**
+   * @brief Create the preview of the clip at the row
+   */
+  Preview previewOf(
+    int row,
+    const QVector<QPair<QString, QByteArray>> &clip,
+    const QVector<QPair<QString, quint64>> &hashes
+  ) const;
+
+  /**
+   * @brief Create the preview of the row, the spilled text is
+   * paged in while the spilled image is keyed by its hash
+   */
+  Preview previewOf(int row) const;
+
+  /**
+   * @brief Show the thumbnail on the rows waiting for it
+   */
+  void handleThumbnailReady(quint64 key, QImage image);
+
+  /**
+   * @brief Page in the image of a row waiting for the thumbnail
+   * that is not cached and make it
+   */
+  void handleThumbnailMissing(quint64 key);
+
+ public:  // Constructor and Destructor
+
+  /**
+   * @brief Construct a new Clip History Model object
+   *
+   * @param parent
+   */
+  explicit ClipHistoryModel(QObject *parent = nullptr);
+
+  /**
+   * @brief Destroy the Clip History Model object
+   */
+  ~ClipHistoryModel() = default;
+
+ public:  // public member function
+
+  /**
+   * @brief Set the History, the clips are read only when shown
+   *
+   * @param count number of clips
+   * @param reader reads the clip at the row
+   */
+  void setHistory(int count, Reader reader);
+
+  /**
+   * @brief Insert the clip at the index, the preview is made
+   * when the row is shown
+   */
+  void insertClip(int index, const QVector<QPair<QString, QByteArray>> &clip);
+
+  /**
+   * @brief Remove the clip at the index
+   */
+  void removeClip(int index);
+
+  /**
+   * @brief Update the clip at the index, the preview is made
+   * again when the row is shown
+   */
+  void updateClip(int index, const QVector<QPair<QString, QByteArray>> &clip);
+
+  /**
+   * @brief Clear the History
+   */
+  void clearHistory();
+
+ public:  // QAbstractListModel
+
+  /**
+   * @brief Number of clips
+   */
+  int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+  /**
+   * @brief Text of the clip as DisplayRole and image as DecorationRole
+   */
+  QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::models
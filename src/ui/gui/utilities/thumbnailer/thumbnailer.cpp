@@ -0,0 +1,166 @@
+#include "thumbnailer.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::ui::gui::utilities {
+/**
+ * @brief Decode the image directly to the size (worker thread)
+ */
+QImage Thumbnailer::decodeAtSize(const QString &mime, const QByteArray &data, int size) {
+  // qoi has no reader plugin so decode and scale
+  if (mime == "image/qoi") {
+    const auto image = utility::functions::decodeQoi(data);
+    return image.isNull() ? image : image.scaled(size, size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+  }
+
+  // read from the memory
+  QBuffer buffer;
+  buffer.setData(data);
+  buffer.open(QIODevice::ReadOnly);
+
+  // create the reader
+  QImageReader reader(&buffer);
+  const auto full = reader.size();
+
+  // decode at the thumbnail size, codecs that support it like
+  // jpeg skip the full size decode entirely
+  if (full.isValid()) {
+    reader.setScaledSize(full.scaled(size, size, Qt::KeepAspectRatio).boundedTo(full));
+  }
+
+  // read the image
+  return reader.read();
+}
+
+/**
+ * @brief Read from the disk cache or decode and write to it (worker thread)
+ */
+QImage Thumbnailer::thumbnail(QDir dir, quint64 key, QString mime, QByteArray data, int size) {
+  // path of the thumbnail
+  const auto path = dir.filePath(fileName(key));
+
+  // read from the disk cache
+  if (QImage image(path); !image.isNull()) {
+    return image;
+  }
+
+  // decode the image
+  const auto image = decodeAtSize(mime, data, size);
+
+  // write to the disk cache
+  if (!image.isNull() && !image.save(path, "PNG")) {
+    qWarning() << LOG("Failed to cache thumbnail " + path.toStdString());
+  }
+
+  // return the image
+  return image;
+}
+
+/**
+ * @brief Remove the oldest thumbnails beyond the limit (worker thread)
+ */
+void Thumbnailer::prune(QDir dir, qsizetype limit) {
+  // thumbnails newest first
+  const auto files = dir.entryInfoList({"*.png"}, QDir::Files, QDir::Time);
+
+  // remove the oldest
+  for (auto i = limit; i < files.size(); ++i) {
+    QFile::remove(files.at(i).filePath());
+  }
+}
+
+/**
+ * @brief File name of the thumbnail
+ */
+QString Thumbnailer::fileName(quint64 key) {
+  return QString("%1.png").arg(key, 16, 16, QChar('0'));
+}
+
+/**
+ * @brief Construct a new Thumbnailer object
+ *
+ * @param size size of the thumbnail
+ * @param parent
+ */
+Thumbnailer::Thumbnailer(int size, QObject *parent)
+    : QObject(parent), dir(QString::fromStdString(constants::getAppThumbnailDir())), size(size) {
+  // memory cache cost is in bytes
+  this->memory.setMaxCost(constants::getAppThumbnailMemoryCache());
+
+  // leave the rest of the cores to the app
+  this->pool.setMaxThreadCount(qMax(1, QThread::idealThreadCount() / 2));
+
+  // create the directory
+  if (!this->dir.mkpath(".")) {
+    qWarning() << LOG("Failed to create thumbnail directory " + this->dir.path().toStdString());
+  }
+
+  // keep the disk cache bounded
+  Q_UNUSED(QtConcurrent::run(&this->pool, &Thumbnailer::prune, this->dir, constants::getAppThumbnailDiskCache()));
+}
+
+/**
+ * @brief Destroy the Thumbnailer object
+ */
+Thumbnailer::~Thumbnailer() {
+  this->pool.clear();
+  this->pool.waitForDone();
+}
+
+/**
+ * @brief Key of the image data
+ */
+quint64 Thumbnailer::keyOf(const QByteArray &data) {
+  return utility::functions::xxh3(data);
+}
+
+/**
+ * @brief Get the thumbnail from the memory cache or null image
+ */
+QImage Thumbnailer::cached(quint64 key) const {
+  const auto image = this->memory.object(key);
+  return image ? *image : QImage();
+}
+
+/**
+ * @brief Make the thumbnail in background, OnThumbnailReady
+ * is emitted when done, without data only the disk cache is
+ * read and OnThumbnailMissing is emitted if it is not there
+ */
+void Thumbnailer::request(quint64 key, const QString &mime, const QByteArray &data) {
+  // if already requested
+  if (this->pending.contains(key)) return;
+
+  // mark as pending
+  this->pending.insert(key);
+
+  // make the thumbnail in background
+  auto watcher = new QFutureWatcher<QImage>(this);
+  auto future  = QtConcurrent::run(&this->pool, &Thumbnailer::thumbnail, this->dir, key, mime, data, this->size);
+
+  // cache and notify when done
+  QObject::connect(watcher, &QFutureWatcher<QImage>::finished, this, [=] {
+    // the image
+    const auto image = watcher->result();
+
+    // done
+    this->pending.remove(key);
+    watcher->deleteLater();
+
+    // if not cached and nothing to decode
+    if (image.isNull() && data.isEmpty()) {
+      return emit OnThumbnailMissing(key);
+    }
+
+    // if failed
+    if (image.isNull()) return;
+
+    // cache in memory
+    this->memory.insert(key, new QImage(image), image.sizeInBytes());
+
+    // notify
+    emit OnThumbnailReady(key, image);
+  });
+
+  // watch the future
+  watcher->setFuture(future);
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::utilities
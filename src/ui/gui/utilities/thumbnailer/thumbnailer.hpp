@@ -0,0 +1,113 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QBuffer>
+#include <QByteArray>
+#include <QCache>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QImage>
+#include <QImageReader>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+// Local header
+#include "constants/constants.hpp"
+#include "utility/functions/hash/hash.hpp"
+#include "utility/functions/qoi/qoi.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::ui::gui::utilities {
+/**
+ * @brief Makes the thumbnails of the history images on a worker pool,
+ * the image is decoded straight to the thumbnail size where the codec
+ * can, the thumbnails are cached by the content hash in memory and
+ * on the disk so the same image is decoded only once
+ */
+class Thumbnailer : public QObject {
+ private:  // disable copy and move for this class
+
+  Q_DISABLE_COPY_MOVE(Thumbnailer)
+
+ private:  // just for Qt
+
+  Q_OBJECT
+
+ private:  // Member variable
+
+  QCache<quint64, QImage> memory;
+  QSet<quint64> pending;
+  QThreadPool pool;
+  QDir dir;
+  int size;
+
+ signals:  // signals
+
+  // called when the thumbnail is ready
+  void OnThumbnailReady(quint64 key, QImage image);
+
+  // called when the thumbnail is not cached and no data was given
+  void OnThumbnailMissing(quint64 key);
+
+ private:  // Member Functions
+
+  /**
+   * @brief Decode the image directly to the size (worker thread)
+   */
+  static QImage decodeAtSize(const QString &mime, const QByteArray &data, int size);
+
+  /**
+   * @brief Read from the disk cache or decode and write to it (worker thread)
+   */
+  static QImage thumbnail(QDir dir, quint64 key, QString mime, QByteArray data, int size);
+
+  /**
+   * @brief Remove the oldest thumbnails beyond the limit (worker thread)
+   */
+  static void prune(QDir dir, qsizetype limit);
+
+  /**
+   * @brief File name of the thumbnail
+   */
+  static QString fileName(quint64 key);
+
+ public:  // Constructor and Destructor
+
+  /**
+   * @brief Construct a new Thumbnailer object
+   *
+   * @param size size of the thumbnail
+   * @param parent
+   */
+  explicit Thumbnailer(int size, QObject *parent = nullptr);
+
+  /**
+   * @brief Destroy the Thumbnailer object
+   */
+  ~Thumbnailer();
+
+ public:  // public member function
+
+  /**
+   * @brief Key of the image data
+   */
+  static quint64 keyOf(const QByteArray &data);
+
+  /**
+   * @brief Get the thumbnail from the memory cache or null image
+   */
+  QImage cached(quint64 key) const;
+
+  /**
+   * @brief Make the thumbnail in background, OnThumbnailReady
+   * is emitted when done, without data only the disk cache is
+   * read and OnThumbnailMissing is emitted if it is not there
+   */
+  void request(quint64 key, const QString &mime, const QByteArray &data);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::utilities
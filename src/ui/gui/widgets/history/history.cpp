@@ -7,26 +7,25 @@ namespace srilakshmikanthanp::clipbirdesk::ui::gui::widgets {
  * @param parent
  */
 History::History(QWidget * parent) : QWidget(parent) {
-  auto scrollArea = new QScrollArea();
-  scrollArea->setAlignment(Qt::AlignTop);
-  scrollArea->setWidgetResizable(true);
-  scrollArea->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-  scrollArea->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
-  scrollArea->setWidget(clipHist);
-
-  // always set scroll bar at top
-  QObject::connect(
-    scrollArea->verticalScrollBar(), &QScrollBar::rangeChanged,
-    this, [scrollArea]() {
-      scrollArea->verticalScrollBar()->setValue(0);
-    }
-  );
-
   // create layout VBox
   auto vBox = new QVBoxLayout();
   vBox->setAlignment(Qt::AlignTop);
   vBox->addWidget(this->clipSend);
-  vBox->addWidget(scrollArea);
+  vBox->addWidget(this->search);
+  vBox->addWidget(this->clipHist);
+
+  // memory use of the history and its budget
+  auto hBox = new QHBoxLayout();
+  hBox->addWidget(this->memory, 1);
+  hBox->addWidget(this->budget);
+  vBox->addLayout(hBox);
+
+  // clear button for search
+  this->search->setClearButtonEnabled(true);
+
+  // budget in MiB
+  this->budget->setRange(16, 16 * 1024);
+  this->budget->setSingleStep(16);
 
   this->setLayout(vBox);
   this->setUpLanguage();
@@ -48,13 +47,78 @@ History::History(QWidget * parent) : QWidget(parent) {
     this->clipSend, &components::ClipSend::onClipSend,
     [this]() { emit onClipSend(); }
   );
+
+  // connect the search to this signal
+  QObject::connect(
+    this->search, &QLineEdit::textChanged,
+    this, &History::onSearchChanged
+  );
+
+  // connect the budget to this signal
+  QObject::connect(
+    this->budget, &QSpinBox::valueChanged,
+    [this](int mib) {
+      this->refreshMemory();
+      emit onMemoryBudgetChanged(quint64(mib) * 1024 * 1024);
+    }
+  );
+}
+
+/**
+ * @brief Set the History, the clips are read only when shown
+ */
+void History::setHistory(int count, models::ClipHistoryModel::Reader reader) {
+  this->clipHist->setHistory(count, reader);
+  this->refreshSearch();
+}
+
+/**
+ * @brief Insert the clip at the index
+ */
+void History::insertClip(int index, const QVector<QPair<QString, QByteArray>> &clip) {
+  this->clipHist->insertClip(index, clip);
+  this->refreshSearch();
+}
+
+/**
+ * @brief Remove the clip at the index
+ */
+void History::removeClip(int index) {
+  this->clipHist->removeClip(index);
+  this->refreshSearch();
 }
 
 /**
- * @brief Set the History
+ * @brief Update the clip at the index
  */
-void History::setHistory(const QList<QVector<QPair<QString, QByteArray>>> &hist) {
-  this->clipHist->setHistory(hist);
+void History::updateClip(int index, const QVector<QPair<QString, QByteArray>> &clip) {
+  this->clipHist->updateClip(index, clip);
+  this->refreshSearch();
+}
+
+/**
+ * @brief Apply the search again after the history changed
+ */
+void History::refreshSearch() {
+  if (!this->search->text().isEmpty()) {
+    emit onSearchChanged(this->search->text());
+  }
+}
+
+/**
+ * @brief Show the resident bytes against the budget
+ */
+void History::refreshMemory() {
+  const auto locale = QLocale();
+  const auto budget = quint64(this->budget->value()) * 1024 * 1024;
+
+  this->memory->setText(QObject::tr("In memory %1 of").arg(
+    locale.formattedDataSize(qint64(this->resident))
+  ));
+
+  this->memory->setToolTip(QObject::tr("Larger items beyond %1 are kept on the disk").arg(
+    locale.formattedDataSize(qint64(budget))
+  ));
 }
 
 /**
@@ -65,17 +129,48 @@ void History::clearHistory() {
 }
 
 /**
- * @brief get the history
+ * @brief Show only the clips at the index
+ */
+void History::setFilter(const QVector<int> &indices) {
+  if (this->search->text().isEmpty()) {
+    this->clipHist->clearFilter();
+  } else {
+    this->clipHist->setFilter(indices);
+  }
+}
+
+/**
+ * @brief get the search query
+ */
+QString History::getSearchQuery() const {
+  return this->search->text();
+}
+
+/**
+ * @brief Set the bytes of history payloads kept in memory
+ */
+void History::setMemoryBudget(quint64 bytes) {
+  const QSignalBlocker blocker(this->budget);
+  this->budget->setValue(int(bytes / 1024 / 1024));
+  this->refreshMemory();
+}
+
+/**
+ * @brief Set the bytes of history payloads in memory now
  */
-QList<QVector<QPair<QString, QByteArray>>> History::getHistory() const {
-  return this->clipHist->getHistory();
+void History::setResidentBytes(quint64 bytes) {
+  this->resident = bytes;
+  this->refreshMemory();
 }
 
 /**
  * @brief Function used to set up all text in the label, etc..
  */
 void History::setUpLanguage() {
-  // Nothing to do
+  this->search->setPlaceholderText(QObject::tr("Search"));
+  this->budget->setSuffix(QObject::tr(" MiB"));
+  this->budget->setToolTip(QObject::tr("Memory budget of the history"));
+  this->refreshMemory();
 }
 
 /**
@@ -6,8 +6,11 @@
 #include <QPainter>
 #include <QScreen>
 #include <QGuiApplication>
-#include <QScrollBar>
-#include <QScrollArea>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QLocale>
+#include <QSpinBox>
 #include <QStyleHints>
 #include <QVBoxLayout>
 
@@ -29,6 +32,10 @@ class History : public QWidget {
 
   components::ClipHistory *clipHist = new components::ClipHistory();
   components::ClipSend* clipSend    = new components::ClipSend();
+  QLineEdit* search                 = new QLineEdit();
+  QLabel* memory                    = new QLabel();
+  QSpinBox* budget                  = new QSpinBox();
+  quint64 resident                  = 0;
 
  signals:  // signals
 
@@ -41,6 +48,12 @@ class History : public QWidget {
   // on send
   void onClipSend();
 
+  // called when the search query is changed
+  void onSearchChanged(const QString &query);
+
+  // called when the memory budget is changed by the user
+  void onMemoryBudgetChanged(quint64 bytes);
+
  private:  // Member Functions
 
   /**
@@ -48,6 +61,16 @@ class History : public QWidget {
    */
   void setUpLanguage();
 
+  /**
+   * @brief Apply the search again after the history changed
+   */
+  void refreshSearch();
+
+  /**
+   * @brief Show the resident bytes against the budget
+   */
+  void refreshMemory();
+
  public:
 
  /**
@@ -62,10 +85,25 @@ class History : public QWidget {
    */
   virtual ~History() = default;
 
-    /**
-   * @brief Set the History
+  /**
+   * @brief Set the History, the clips are read only when shown
    */
-  void setHistory(const QList<QVector<QPair<QString, QByteArray>>> &);
+  void setHistory(int count, models::ClipHistoryModel::Reader reader);
+
+  /**
+   * @brief Insert the clip at the index
+   */
+  void insertClip(int index, const QVector<QPair<QString, QByteArray>> &clip);
+
+  /**
+   * @brief Remove the clip at the index
+   */
+  void removeClip(int index);
+
+  /**
+   * @brief Update the clip at the index
+   */
+  void updateClip(int index, const QVector<QPair<QString, QByteArray>> &clip);
 
   /**
    * @brief Clear the History
@@ -73,9 +111,24 @@ class History : public QWidget {
   void clearHistory();
 
   /**
-   * @brief get the History
+   * @brief Show only the clips at the index
+   */
+  void setFilter(const QVector<int> &indices);
+
+  /**
+   * @brief get the search query
+   */
+  QString getSearchQuery() const;
+
+  /**
+   * @brief Set the bytes of history payloads kept in memory
+   */
+  void setMemoryBudget(quint64 bytes);
+
+  /**
+   * @brief Set the bytes of history payloads in memory now
    */
-  QList<QVector<QPair<QString, QByteArray>>> getHistory() const;
+  void setResidentBytes(quint64 bytes);
 
   /**
    * @brief override set visible
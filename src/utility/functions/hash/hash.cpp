@@ -0,0 +1,63 @@
+#include "hash.hpp"
+
+// xxHash is used as header only library
+#define XXH_INLINE_ALL
+#include <xxhash.h>
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions {
+/**
+ * @brief Compute the 64 bit XXH3 hash of the data
+ *
+ * @param data data to hash
+ * @return quint64 hash
+ */
+quint64 xxh3(const QByteArray& data) {
+  return XXH3_64bits(data.constData(), data.size());
+}
+
+/**
+ * @brief Compute the fingerprint of the clipboard snapshot from
+ * the mime type and payload hash of the items, the fingerprint
+ * does not depend on the order of the items
+ *
+ * @param hashes mime type and payload hash of the items
+ * @return quint64 fingerprint
+ */
+quint64 fingerprint(QVector<QPair<QString, quint64>> hashes) {
+  // sort by mime type so the order does not matter
+  std::sort(hashes.begin(), hashes.end());
+
+  // streaming state on stack
+  XXH3_state_t state;
+  XXH3_64bits_reset(&state);
+
+  // hash the mime type and payload hash of the items
+  for (const auto& [mime, hash] : hashes) {
+    const auto name = mime.toUtf8();
+    XXH3_64bits_update(&state, name.constData(), name.size() + 1);
+    XXH3_64bits_update(&state, &hash, sizeof(hash));
+  }
+
+  // return the fingerprint
+  return XXH3_64bits_digest(&state);
+}
+
+/**
+ * @brief Compute the fingerprint of the clipboard items
+ *
+ * @param items mime type and payload of the items
+ * @return quint64 fingerprint
+ */
+quint64 fingerprint(const QVector<QPair<QString, QByteArray>>& items) {
+  // hashes of the items
+  QVector<QPair<QString, quint64>> hashes;
+
+  // hash the payloads
+  for (const auto& [mime, data] : items) {
+    hashes.append({mime, xxh3(data)});
+  }
+
+  // return the fingerprint
+  return fingerprint(hashes);
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
@@ -0,0 +1,41 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QByteArray>
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include <QtTypes>
+
+// standard header
+#include <algorithm>
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions {
+/**
+ * @brief Compute the 64 bit XXH3 hash of the data, XXH3 uses
+ * SIMD where available and hashes at memory bandwidth so it is
+ * cheap enough to run on every clipboard payload
+ *
+ * @param data data to hash
+ * @return quint64 hash
+ */
+quint64 xxh3(const QByteArray& data);
+
+/**
+ * @brief Compute the fingerprint of the clipboard snapshot from
+ * the mime type and payload hash of the items, the fingerprint
+ * does not depend on the order of the items
+ *
+ * @param hashes mime type and payload hash of the items
+ * @return quint64 fingerprint
+ */
+quint64 fingerprint(QVector<QPair<QString, quint64>> hashes);
+
+/**
+ * @brief Compute the fingerprint of the clipboard items
+ *
+ * @param items mime type and payload of the items
+ * @return quint64 fingerprint
+ */
+quint64 fingerprint(const QVector<QPair<QString, QByteArray>>& items);
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
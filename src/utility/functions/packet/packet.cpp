@@ -146,4 +146,234 @@ network::packets::PingPacket createPacket(params::PingPacketParams params) {
   // return the packet
   return packet;
 }
+
+/**
+ * @brief Create the PromiseItem
+ *
+ * @param mimeType
+ * @param payloadSize
+ * @param payloadHash
+ * @param payload
+ *
+ * @return PromiseItem
+ */
+network::packets::PromiseItem createPacket(params::PromiseItemParams params) {
+  // create the PromiseItem
+  network::packets::PromiseItem item;
+
+  // set the mime length
+  item.setMimeLength(params.mimeType.toUtf8().size());
+
+  // set the mime type
+  item.setMimeType(params.mimeType.toUtf8());
+
+  // set the payload size
+  item.setPayloadSize(params.payloadSize);
+
+  // set the payload hash
+  item.setPayloadHash(params.payloadHash);
+
+  // set the payload length
+  item.setPayloadLength(params.payload.size());
+
+  // set the payload
+  item.setPayload(params.payload);
+
+  // return the PromiseItem
+  return item;
+}
+
+/**
+ * @brief Create the PromisePacket
+ *
+ * @param packetType
+ * @param promiseId
+ * @param items
+ *
+ * @return PromisePacket
+ */
+network::packets::PromisePacket createPacket(params::PromisePacketParams params) {
+  // create the packet
+  network::packets::PromisePacket packet;
+
+  // set the packet type
+  packet.setPacketType(params.packetType);
+
+  // set the promise id
+  packet.setPromiseId(params.promiseId);
+
+  // set the item count
+  packet.setItemCount(params.items.size());
+
+  // Convert the items to PromiseItem
+  QVector<network::packets::PromiseItem> items;
+
+  // reserve the memory
+  items.reserve(params.items.size());
+
+  // convert the items
+  for (const auto& item : params.items) {
+    items.push_back(createPacket(item));
+  }
+
+  // set the items
+  packet.setItems(items);
+
+  // set the packet length
+  packet.setPacketLength(packet.size());
+
+  // return the packet
+  return packet;
+}
+
+/**
+ * @brief Create the PayloadPacket
+ *
+ * @param packetType
+ * @param promiseId
+ * @param mimeType
+ * @param payload
+ *
+ * @return PayloadPacket
+ */
+network::packets::PayloadPacket createPacket(params::PayloadPacketParams params) {
+  // create the packet
+  network::packets::PayloadPacket packet;
+
+  // set the packet type
+  packet.setPacketType(params.packetType);
+
+  // set the promise id
+  packet.setPromiseId(params.promiseId);
+
+  // set the mime length
+  packet.setMimeLength(params.mimeType.toUtf8().size());
+
+  // set the mime type
+  packet.setMimeType(params.mimeType.toUtf8());
+
+  // set the payload length
+  packet.setPayloadLength(params.payload.size());
+
+  // set the payload
+  packet.setPayload(params.payload);
+
+  // set the packet length
+  packet.setPacketLength(packet.size());
+
+  // return the packet
+  return packet;
+}
+
+/**
+ * @brief Create the FileStreamPacket
+ *
+ * @param packetType
+ * @param streamId
+ * @param fileCount
+ * @param fileIndex
+ * @param fileSize
+ * @param offset
+ * @param fileName
+ * @param chunk
+ *
+ * @return FileStreamPacket
+ */
+network::packets::FileStreamPacket createPacket(params::FileStreamPacketParams params) {
+  // create the packet
+  network::packets::FileStreamPacket packet;
+
+  // set the packet type
+  packet.setPacketType(params.packetType);
+
+  // set the stream id
+  packet.setStreamId(params.streamId);
+
+  // set the file count
+  packet.setFileCount(params.fileCount);
+
+  // set the file index
+  packet.setFileIndex(params.fileIndex);
+
+  // set the file size
+  packet.setFileSize(params.fileSize);
+
+  // set the offset
+  packet.setOffset(params.offset);
+
+  // set the name length
+  packet.setNameLength(params.fileName.toUtf8().size());
+
+  // set the file name
+  packet.setFileName(params.fileName.toUtf8());
+
+  // set the chunk length
+  packet.setChunkLength(params.chunk.size());
+
+  // set the chunk
+  packet.setChunk(params.chunk);
+
+  // set the packet length
+  packet.setPacketLength(packet.size());
+
+  // return the packet
+  return packet;
+}
+
+/**
+ * @brief Create the HistorySummaryPacket
+ *
+ * @param packetType
+ * @param freeSlots
+ * @param entries
+ *
+ * @return HistorySummaryPacket
+ */
+network::packets::HistorySummaryPacket createPacket(params::HistorySummaryPacketParams params) {
+  // create the packet
+  network::packets::HistorySummaryPacket packet;
+
+  // set the packet type
+  packet.setPacketType(params.packetType);
+
+  // set the free slots
+  packet.setFreeSlots(params.freeSlots);
+
+  // set the entry count
+  packet.setEntryCount(params.entries.size());
+
+  // set the entries
+  packet.setEntries(params.entries);
+
+  // set the packet length
+  packet.setPacketLength(packet.size());
+
+  // return the packet
+  return packet;
+}
+
+/**
+ * @brief Create the CapabilityPacket
+ *
+ * @param packetType
+ * @param features
+ *
+ * @return CapabilityPacket
+ */
+network::packets::CapabilityPacket createPacket(params::CapabilityPacketParams params) {
+  // create the packet
+  network::packets::CapabilityPacket packet;
+
+  // set the packet type
+  packet.setPacketType(params.packetType);
+
+  // set the features
+  packet.setFeatures(params.features);
+
+  // set the packet length
+  packet.setPacketLength(packet.size());
+
+  // return the packet
+  return packet;
+}
 }  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
@@ -10,8 +10,13 @@
 
 // Local header files
 #include "packets/authentication/authentication.hpp"
+#include "packets/capabilitypacket/capabilitypacket.hpp"
+#include "packets/filestreampacket/filestreampacket.hpp"
+#include "packets/historysummarypacket/historysummarypacket.hpp"
 #include "packets/invalidrequest/invalidrequest.hpp"
+#include "packets/payloadpacket/payloadpacket.hpp"
 #include "packets/pingpacket/pingpacket.hpp"
+#include "packets/promisepacket/promisepacket.hpp"
 #include "packets/syncingpacket/syncingpacket.hpp"
 #include "types/enums/enums.hpp"
 #include "utility/functions/ipconv/ipconv.hpp"
@@ -57,6 +62,67 @@ struct PingPacketParams {
   quint32 packetType;
   quint32 pingType;
 };
+
+/**
+ * @brief parameters for the PromiseItem, payload is empty
+ * if the item is lazy
+ */
+struct PromiseItemParams {
+  QString mimeType;
+  quint32 payloadSize;
+  quint64 payloadHash;
+  QByteArray payload;
+};
+
+/**
+ * @brief parameters for the PromisePacket
+ */
+struct PromisePacketParams {
+  quint32 packetType;
+  quint64 promiseId;
+  QVector<PromiseItemParams> items;
+};
+
+/**
+ * @brief parameters for the PayloadPacket
+ */
+struct PayloadPacketParams {
+  quint32 packetType;
+  quint64 promiseId;
+  const QString& mimeType;
+  const QByteArray& payload;
+};
+
+/**
+ * @brief parameters for the FileStreamPacket
+ */
+struct FileStreamPacketParams {
+  quint32 packetType;
+  quint64 streamId;
+  quint32 fileCount;
+  quint32 fileIndex;
+  quint64 fileSize;
+  quint64 offset;
+  const QString& fileName;
+  const QByteArray& chunk;
+};
+
+/**
+ * @brief parameters for the HistorySummaryPacket
+ */
+struct HistorySummaryPacketParams {
+  quint32 packetType;
+  quint32 freeSlots;
+  QVector<quint64> entries;
+};
+
+/**
+ * @brief parameters for the CapabilityPacket
+ */
+struct CapabilityPacketParams {
+  quint32 packetType;
+  quint32 features;
+};
 }  // namespace srilakshmikanthanp::clipbirdesk::utility::functions::params
 
 namespace srilakshmikanthanp::clipbirdesk::utility::functions {
@@ -110,4 +176,76 @@ network::packets::SyncingPacket createPacket(params::SyncingPacketParams params)
  * @return PingPacket
  */
 network::packets::PingPacket createPacket(params::PingPacketParams params);
+
+/**
+ * @brief Create the PromiseItem
+ *
+ * @param mimeType
+ * @param payloadSize
+ * @param payloadHash
+ * @param payload
+ *
+ * @return PromiseItem
+ */
+network::packets::PromiseItem createPacket(params::PromiseItemParams params);
+
+/**
+ * @brief Create the PromisePacket
+ *
+ * @param packetType
+ * @param promiseId
+ * @param items
+ *
+ * @return PromisePacket
+ */
+network::packets::PromisePacket createPacket(params::PromisePacketParams params);
+
+/**
+ * @brief Create the PayloadPacket
+ *
+ * @param packetType
+ * @param promiseId
+ * @param mimeType
+ * @param payload
+ *
+ * @return PayloadPacket
+ */
+network::packets::PayloadPacket createPacket(params::PayloadPacketParams params);
+
+/**
+ * @brief Create the FileStreamPacket
+ *
+ * @param packetType
+ * @param streamId
+ * @param fileCount
+ * @param fileIndex
+ * @param fileSize
+ * @param offset
+ * @param fileName
+ * @param chunk
+ *
+ * @return FileStreamPacket
+ */
+network::packets::FileStreamPacket createPacket(params::FileStreamPacketParams params);
+
+/**
+ * @brief Create the HistorySummaryPacket
+ *
+ * @param packetType
+ * @param freeSlots
+ * @param entries
+ *
+ * @return HistorySummaryPacket
+ */
+network::packets::HistorySummaryPacket createPacket(params::HistorySummaryPacketParams params);
+
+/**
+ * @brief Create the CapabilityPacket
+ *
+ * @param packetType
+ * @param features
+ *
+ * @return CapabilityPacket
+ */
+network::packets::CapabilityPacket createPacket(params::CapabilityPacketParams params);
 }  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
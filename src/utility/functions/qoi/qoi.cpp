@@ -0,0 +1,337 @@
+#include "qoi.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions {
+namespace {
+/// @brief QOI chunk tags and header constants
+constexpr quint8 QOI_OP_INDEX   = 0x00;
+constexpr quint8 QOI_OP_DIFF    = 0x40;
+constexpr quint8 QOI_OP_LUMA    = 0x80;
+constexpr quint8 QOI_OP_RUN     = 0xc0;
+constexpr quint8 QOI_OP_RGB     = 0xfe;
+constexpr quint8 QOI_OP_RGBA    = 0xff;
+constexpr quint8 QOI_MASK_2     = 0xc0;
+constexpr int QOI_HEADER_SIZE   = 14;
+constexpr int QOI_PADDING_SIZE  = 8;
+constexpr quint32 QOI_MAX_PIXEL = 400000000;
+
+/// @brief mime types of the images
+constexpr auto MIME_TYPE_QOI    = "image/qoi";
+constexpr auto MIME_TYPE_PNG    = "image/png";
+
+/// @brief PNG quality that is zlib level 1
+constexpr int IMAGE_PNG_QUALITY = 85;
+
+/// @brief end of stream marker
+constexpr quint8 QOI_PADDING[QOI_PADDING_SIZE] = {0, 0, 0, 0, 0, 0, 0, 1};
+
+/**
+ * @brief RGBA pixel
+ */
+struct Pixel {
+  quint8 r, g, b, a;
+
+  bool operator==(const Pixel& o) const {
+    return r == o.r && g == o.g && b == o.b && a == o.a;
+  }
+};
+
+/**
+ * @brief index position of the pixel in the running array
+ */
+inline int hashOf(const Pixel& p) {
+  return (p.r * 3 + p.g * 5 + p.b * 7 + p.a * 11) % 64;
+}
+
+/**
+ * @brief write 32 bit big endian
+ */
+inline void write32(quint8* bytes, int& p, quint32 v) {
+  bytes[p++] = (0xff000000 & v) >> 24;
+  bytes[p++] = (0x00ff0000 & v) >> 16;
+  bytes[p++] = (0x0000ff00 & v) >> 8;
+  bytes[p++] = (0x000000ff & v);
+}
+
+/**
+ * @brief read 32 bit big endian
+ */
+inline quint32 read32(const quint8* bytes, int& p) {
+  quint32 a = bytes[p++];
+  quint32 b = bytes[p++];
+  quint32 c = bytes[p++];
+  quint32 d = bytes[p++];
+  return a << 24 | b << 16 | c << 8 | d;
+}
+}  // namespace
+
+/**
+ * @brief Encode the image as QOI (Quite OK Image Format) it is a
+ * lossless format that encodes an order of magnitude faster than
+ * zlib based PNG, see https://qoiformat.org/qoi-specification.pdf
+ *
+ * @param image image to encode
+ * @return QByteArray encoded bytes or empty on failure
+ */
+QByteArray encodeQoi(const QImage& image) {
+  // if the image is null
+  if (image.isNull()) return QByteArray();
+
+  // RGBA8888 is laid out as R, G, B, A in memory on all platforms
+  const auto rgba   = image.convertToFormat(QImage::Format_RGBA8888);
+  const quint32 w   = rgba.width();
+  const quint32 h   = rgba.height();
+
+  // check the size limit from the specification
+  if (quint64(w) * h >= QOI_MAX_PIXEL) return QByteArray();
+
+  // worst case every pixel is QOI_OP_RGBA
+  const qsizetype maxSize = qsizetype(w) * h * 5 + QOI_HEADER_SIZE + QOI_PADDING_SIZE;
+
+  // output buffer
+  QByteArray data(maxSize, Qt::Uninitialized);
+  auto bytes = reinterpret_cast<quint8*>(data.data());
+  int p      = 0;
+
+  // header
+  bytes[p++] = 'q';
+  bytes[p++] = 'o';
+  bytes[p++] = 'i';
+  bytes[p++] = 'f';
+  write32(bytes, p, w);
+  write32(bytes, p, h);
+  bytes[p++] = 4;  // channels
+  bytes[p++] = 0;  // sRGB with linear alpha
+
+  // running state
+  Pixel index[64] = {};
+  Pixel prev      = {0, 0, 0, 255};
+  int run         = 0;
+
+  for (quint32 y = 0; y < h; y++) {
+    const auto line = rgba.constScanLine(y);
+    for (quint32 x = 0; x < w; x++) {
+      const auto s   = line + x * 4;
+      const Pixel px = {s[0], s[1], s[2], s[3]};
+      const bool end = (y == h - 1) && (x == w - 1);
+
+      // same as previous pixel
+      if (px == prev) {
+        if (++run == 62 || end) {
+          bytes[p++] = QOI_OP_RUN | (run - 1);
+          run        = 0;
+        }
+        continue;
+      }
+
+      // flush the pending run
+      if (run > 0) {
+        bytes[p++] = QOI_OP_RUN | (run - 1);
+        run        = 0;
+      }
+
+      // index of the pixel
+      const auto idx = hashOf(px);
+
+      if (index[idx] == px) {
+        bytes[p++] = QOI_OP_INDEX | idx;
+        prev       = px;
+        continue;
+      }
+
+      // remember the pixel
+      index[idx] = px;
+
+      // alpha changed so write the full pixel
+      if (px.a != prev.a) {
+        bytes[p++] = QOI_OP_RGBA;
+        bytes[p++] = px.r;
+        bytes[p++] = px.g;
+        bytes[p++] = px.b;
+        bytes[p++] = px.a;
+        prev       = px;
+        continue;
+      }
+
+      // difference to the previous pixel
+      const qint8 vr   = px.r - prev.r;
+      const qint8 vg   = px.g - prev.g;
+      const qint8 vb   = px.b - prev.b;
+      const qint8 vg_r = vr - vg;
+      const qint8 vg_b = vb - vg;
+
+      if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+        bytes[p++] = QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2);
+      } else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+        bytes[p++] = QOI_OP_LUMA | (vg + 32);
+        bytes[p++] = (vg_r + 8) << 4 | (vg_b + 8);
+      } else {
+        bytes[p++] = QOI_OP_RGB;
+        bytes[p++] = px.r;
+        bytes[p++] = px.g;
+        bytes[p++] = px.b;
+      }
+
+      prev = px;
+    }
+  }
+
+  // end marker
+  for (int i = 0; i < QOI_PADDING_SIZE; i++) {
+    bytes[p++] = QOI_PADDING[i];
+  }
+
+  // shrink to the encoded size
+  data.truncate(p);
+
+  // return the encoded data
+  return data;
+}
+
+/**
+ * @brief Decode the QOI bytes to the image
+ *
+ * @param data QOI encoded bytes
+ * @return QImage decoded image or null image on failure
+ */
+QImage decodeQoi(const QByteArray& data) {
+  // check the minimum size
+  if (data.size() < QOI_HEADER_SIZE + QOI_PADDING_SIZE) return QImage();
+
+  // header
+  const auto bytes = reinterpret_cast<const quint8*>(data.constData());
+  int p            = 0;
+
+  // check the magic
+  if (bytes[0] != 'q' || bytes[1] != 'o' || bytes[2] != 'i' || bytes[3] != 'f') {
+    return QImage();
+  }
+
+  // skip the magic
+  p += 4;
+
+  // read the header
+  const quint32 w       = read32(bytes, p);
+  const quint32 h       = read32(bytes, p);
+  const quint8 channels = bytes[p++];
+  const quint8 space    = bytes[p++];
+
+  // validate the header
+  if (w == 0 || h == 0 || channels < 3 || channels > 4 || space > 1) {
+    return QImage();
+  }
+
+  // check the size limit from the specification
+  if (quint64(w) * h >= QOI_MAX_PIXEL) return QImage();
+
+  // create the image
+  QImage image(w, h, QImage::Format_RGBA8888);
+
+  // if allocation failed
+  if (image.isNull()) return QImage();
+
+  // running state
+  Pixel index[64]    = {};
+  Pixel px           = {0, 0, 0, 255};
+  int run            = 0;
+  const int chunkEnd = data.size() - QOI_PADDING_SIZE;
+
+  for (quint32 y = 0; y < h; y++) {
+    const auto line = image.scanLine(y);
+    for (quint32 x = 0; x < w; x++) {
+      if (run > 0) {
+        run--;
+      } else if (p < chunkEnd) {
+        const quint8 b1 = bytes[p++];
+
+        if (b1 == QOI_OP_RGB) {
+          if (p + 3 > chunkEnd) return QImage();
+          px.r = bytes[p++];
+          px.g = bytes[p++];
+          px.b = bytes[p++];
+        } else if (b1 == QOI_OP_RGBA) {
+          if (p + 4 > chunkEnd) return QImage();
+          px.r = bytes[p++];
+          px.g = bytes[p++];
+          px.b = bytes[p++];
+          px.a = bytes[p++];
+        } else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX) {
+          px = index[b1];
+        } else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF) {
+          px.r += ((b1 >> 4) & 0x03) - 2;
+          px.g += ((b1 >> 2) & 0x03) - 2;
+          px.b += (b1 & 0x03) - 2;
+        } else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA) {
+          if (p + 1 > chunkEnd) return QImage();
+          const quint8 b2 = bytes[p++];
+          const int vg    = (b1 & 0x3f) - 32;
+          px.r += vg - 8 + ((b2 >> 4) & 0x0f);
+          px.g += vg;
+          px.b += vg - 8 + (b2 & 0x0f);
+        } else if ((b1 & QOI_MASK_2) == QOI_OP_RUN) {
+          run = (b1 & 0x3f);
+        }
+
+        index[hashOf(px)] = px;
+      } else {
+        return QImage();  // truncated stream
+      }
+
+      // write the pixel
+      const auto d = line + x * 4;
+      d[0]         = px.r;
+      d[1]         = px.g;
+      d[2]         = px.b;
+      d[3]         = px.a;
+    }
+  }
+
+  // return the image
+  return image;
+}
+
+/**
+ * @brief Encode the image as PNG with the fast zlib level
+ *
+ * @param image image to encode
+ * @return QByteArray encoded bytes or empty on failure
+ */
+QByteArray encodePng(const QImage& image) {
+  // if no image
+  if (image.isNull()) return QByteArray();
+
+  // encode the image
+  QByteArray data; QBuffer buffer(&data);
+  buffer.open(QIODevice::WriteOnly);
+  if (!image.save(&buffer, "PNG", IMAGE_PNG_QUALITY)) return QByteArray();
+  return data;
+}
+
+/**
+ * @brief Re-encode the QOI images of the items as PNG for the
+ * peers that don't understand QOI, other items are kept
+ *
+ * @param items mime type and payload
+ * @return items without QOI images
+ */
+QVector<QPair<QString, QByteArray>> qoiItemsToPng(const QVector<QPair<QString, QByteArray>>& items) {
+  // items without QOI
+  QVector<QPair<QString, QByteArray>> result;
+
+  for (const auto& [mime, data] : items) {
+    // keep the other items
+    if (mime != MIME_TYPE_QOI) {
+      result.append({mime, data}); continue;
+    }
+
+    // decode the image, drop if corrupt
+    const auto image = decodeQoi(data);
+    if (image.isNull()) continue;
+
+    // encode as PNG with fast zlib level
+    result.append({MIME_TYPE_PNG, encodePng(image)});
+  }
+
+  // return the items
+  return result;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
@@ -0,0 +1,49 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QBuffer>
+#include <QByteArray>
+#include <QImage>
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions {
+/**
+ * @brief Encode the image as QOI (Quite OK Image Format) it is a
+ * lossless format that encodes an order of magnitude faster than
+ * zlib based PNG, see https://qoiformat.org/qoi-specification.pdf
+ *
+ * @param image image to encode
+ * @return QByteArray encoded bytes or empty on failure
+ */
+QByteArray encodeQoi(const QImage& image);
+
+/**
+ * @brief Decode the QOI bytes to the image
+ *
+ * @param data QOI encoded bytes
+ * @return QImage decoded image or null image on failure
+ */
+QImage decodeQoi(const QByteArray& data);
+
+/**
+ * @brief Encode the image as PNG with the fast zlib level, Qt maps
+ * the quality to zlib level as (100 - quality) * 9 / 91 so 85 is
+ * level 1, the default is level 6 which is several times slower
+ * for screenshots while saving only a few percent
+ *
+ * @param image image to encode
+ * @return QByteArray encoded bytes or empty on failure
+ */
+QByteArray encodePng(const QImage& image);
+
+/**
+ * @brief Re-encode the QOI images of the items as PNG for the
+ * peers that don't understand QOI, other items are kept
+ *
+ * @param items mime type and payload
+ * @return items without QOI images
+ */
+QVector<QPair<QString, QByteArray>> qoiItemsToPng(const QVector<QPair<QString, QByteArray>>& items);
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
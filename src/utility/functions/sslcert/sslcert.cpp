@@ -2,51 +2,125 @@
 
 namespace srilakshmikanthanp::clipbirdesk::utility::functions::internal {
 /**
- *  @brief generates a EVP_PEY using RSA_generate_key_ex
+ * @brief Generate the key from the initialized keygen context
+ *
+ * @param ctx keygen context
+ *
+ * @return EVP_PKEY* - shared pointer to the key
+ */
+static std::shared_ptr<EVP_PKEY> keygen(EVP_PKEY_CTX *ctx) {
+  // generated key
+  EVP_PKEY *pkey = NULL;
+
+  // Try to generate the key
+  if (EVP_PKEY_keygen(ctx, &pkey) <= 0) {
+    throw std::runtime_error("Can't Generate Key");
+  }
+
+  // The key has been generated, return it
+  return std::shared_ptr<EVP_PKEY>(pkey, EVP_PKEY_free);
+}
+
+/**
+ *  @brief generates a RSA EVP_PKEY using EVP_PKEY_keygen
  *  @returns EVP_PKEY* - shared pointer to the key
  */
 std::shared_ptr<EVP_PKEY> generateRSAKey(int bits) {
   // create a shared pointer to handle the memory
-  std::shared_ptr<EVP_PKEY> pkey(EVP_PKEY_new(), EVP_PKEY_free);
+  std::shared_ptr<EVP_PKEY_CTX> ctx(EVP_PKEY_CTX_new_id(EVP_PKEY_RSA, NULL), EVP_PKEY_CTX_free);
 
-  // if pkey is null then throw an error
-  if (pkey.get() == NULL) {
-    throw std::runtime_error("Can't Create EVP_PKEY");
+  // if ctx is null then throw an error
+  if (ctx.get() == NULL) {
+    throw std::runtime_error("Can't Create EVP_PKEY_CTX");
   }
 
-  // rsa_key = RSA_new();
-  std::shared_ptr<RSA> rsa(RSA_new(), RSA_free);
+  // initialize the keygen
+  if (EVP_PKEY_keygen_init(ctx.get()) <= 0) {
+    throw std::runtime_error("Can't Initialize Keygen");
+  }
 
-  // if rsa is null then throw an error
-  if (rsa.get() == NULL) {
-    throw std::runtime_error("Can't Create RSA");
+  // Set the key size, exponent defaults to F4
+  if (EVP_PKEY_CTX_set_rsa_keygen_bits(ctx.get(), bits) <= 0) {
+    throw std::runtime_error("Can't Set RSA Key Size");
   }
 
-  // BIGNUM *bn_exp = BN_new();
-  std::shared_ptr<BIGNUM> bn_exp(BN_new(), BN_free);
+  // generate the key
+  return keygen(ctx.get());
+}
 
-  // if bn_exp is null then throw an error
-  if (bn_exp.get() == NULL) {
-    throw std::runtime_error("Can't Create BIGNUM");
+/**
+ *  @brief generates a ECDSA P-256 EVP_PKEY using EVP_PKEY_keygen
+ *  @returns EVP_PKEY* - shared pointer to the key
+ */
+std::shared_ptr<EVP_PKEY> generateECKey() {
+  // create a shared pointer to handle the memory
+  std::shared_ptr<EVP_PKEY_CTX> ctx(EVP_PKEY_CTX_new_id(EVP_PKEY_EC, NULL), EVP_PKEY_CTX_free);
+
+  // if ctx is null then throw an error
+  if (ctx.get() == NULL) {
+    throw std::runtime_error("Can't Create EVP_PKEY_CTX");
   }
 
-  // Set the exponent to F4
-  if (!BN_set_word(bn_exp.get(), RSA_F4)) {
-    throw std::runtime_error("Can't Set BIGNUM");
+  // initialize the keygen
+  if (EVP_PKEY_keygen_init(ctx.get()) <= 0) {
+    throw std::runtime_error("Can't Initialize Keygen");
   }
 
-  // Try to generate the key
-  if (!RSA_generate_key_ex(rsa.get(), bits, bn_exp.get(), NULL)) {
-    throw std::runtime_error("Can't Generate RSA Key");
+  // Set the curve to P-256
+  if (EVP_PKEY_CTX_set_ec_paramgen_curve_nid(ctx.get(), NID_X9_62_prime256v1) <= 0) {
+    throw std::runtime_error("Can't Set EC Curve");
   }
 
-  // Set the rsa key to the pkey
-  if (!EVP_PKEY_set1_RSA(pkey.get(), rsa.get())) {
-    throw std::runtime_error("Can't Assign RSA to EVP_PKEY");
+  // TLS peers only accept named curves
+  if (EVP_PKEY_CTX_set_ec_param_enc(ctx.get(), OPENSSL_EC_NAMED_CURVE) <= 0) {
+    throw std::runtime_error("Can't Set EC Param Encoding");
   }
 
-  // The key has been generated, return it
-  return pkey;
+  // generate the key
+  return keygen(ctx.get());
+}
+
+/**
+ *  @brief generates a Ed25519 EVP_PKEY using EVP_PKEY_keygen
+ *  @returns EVP_PKEY* - shared pointer to the key
+ */
+std::shared_ptr<EVP_PKEY> generateEd25519Key() {
+  // create a shared pointer to handle the memory
+  std::shared_ptr<EVP_PKEY_CTX> ctx(EVP_PKEY_CTX_new_id(EVP_PKEY_ED25519, NULL), EVP_PKEY_CTX_free);
+
+  // if ctx is null then throw an error
+  if (ctx.get() == NULL) {
+    throw std::runtime_error("Can't Create EVP_PKEY_CTX");
+  }
+
+  // initialize the keygen
+  if (EVP_PKEY_keygen_init(ctx.get()) <= 0) {
+    throw std::runtime_error("Can't Initialize Keygen");
+  }
+
+  // generate the key
+  return keygen(ctx.get());
+}
+
+/**
+ * @brief generates a EVP_PKEY of the given type
+ *
+ * @param type - key algorithm
+ * @param bits - RSA key size
+ *
+ * @return EVP_PKEY* - shared pointer to the key
+ */
+std::shared_ptr<EVP_PKEY> generateKey(types::enums::KeyType type, int bits) {
+  switch (type) {
+    case types::enums::KeyType::RSA:
+      return generateRSAKey(bits);
+    case types::enums::KeyType::ECDSA:
+      return generateECKey();
+    case types::enums::KeyType::ED25519:
+      return generateEd25519Key();
+  }
+
+  throw std::invalid_argument("Unknown Key Type");
 }
 
 /**
@@ -129,8 +203,11 @@ std::shared_ptr<X509> generateX509(std::shared_ptr<EVP_PKEY> pkey) {
   // Set the public key for our certificate.
   X509_set_pubkey(x509.get(), pkey.get());
 
+  // Ed25519 signs without a separate digest
+  const EVP_MD *md = EVP_PKEY_base_id(pkey.get()) == EVP_PKEY_ED25519 ? NULL : EVP_sha256();
+
   // Actually sign the certificate with our key.
-  if (!X509_sign(x509.get(), pkey.get(), EVP_sha1())) {
+  if (!X509_sign(x509.get(), pkey.get(), md)) {
     throw std::runtime_error("Can't Sign X509");
   }
 
@@ -142,12 +219,13 @@ std::shared_ptr<X509> generateX509(std::shared_ptr<EVP_PKEY> pkey) {
 namespace srilakshmikanthanp::clipbirdesk::utility::functions {
 /**
  * @brief Get the Q Ssl Configuration object
+ * @param type - key algorithm
  * @param bits - RSA key size
  * @return QSslConfiguration
  */
-QSslConfiguration getQSslConfiguration(int bits) {
-  // Generate the RSA key for the certificate
-  std::shared_ptr<EVP_PKEY> pkey = internal::generateRSAKey(bits);
+QSslConfiguration getQSslConfiguration(types::enums::KeyType type, int bits) {
+  // Generate the key for the certificate
+  std::shared_ptr<EVP_PKEY> pkey = internal::generateKey(type, bits);
 
   // Generate the certificate
   std::shared_ptr<X509> x509     = internal::generateX509(pkey);
@@ -174,7 +252,12 @@ QSslConfiguration getQSslConfiguration(int bits) {
   QByteArray key(QByteArray(pkey_buffer_memory->data, pkey_buffer_memory->length));
 
   // Create the QSslKey
-  QSslKey sslKey(key, QSsl::Rsa, QSsl::Pem, QSsl::PrivateKey);
+  QSslKey sslKey = toQSslKey(key);
+
+  // if the key is null then throw an error
+  if (sslKey.isNull()) {
+    throw std::runtime_error("Can't Create QSslKey");
+  }
 
   // Write the certificate to buffer
   BIO *x509_buffer = BIO_new(BIO_s_mem());
@@ -217,4 +300,106 @@ QSslConfiguration getQSslConfiguration(int bits) {
   // return the configuration
   return sslConfig;
 }
+
+/**
+ * @brief Create the QSslKey from the PEM encoded private key
+ * of any supported algorithm, Ed25519 keys are wrapped as
+ * Opaque keys since Qt can't parse them
+ *
+ * @param pem - PEM encoded private key
+ * @return QSslKey null if the key is not valid
+ */
+QSslKey toQSslKey(const QByteArray &pem) {
+  // read only buffer over the pem
+  std::shared_ptr<BIO> buffer(BIO_new_mem_buf(pem.constData(), pem.size()), BIO_free_all);
+
+  // if buffer is null then the key is not valid
+  if (buffer.get() == NULL) {
+    return QSslKey();
+  }
+
+  // read the key to find the algorithm
+  EVP_PKEY *pkey = PEM_read_bio_PrivateKey(buffer.get(), NULL, NULL, NULL);
+
+  // if pkey is null then the key is not valid
+  if (pkey == NULL) {
+    return QSslKey();
+  }
+
+  // Qt takes the ownership of the Opaque key
+  if (EVP_PKEY_base_id(pkey) == EVP_PKEY_ED25519) {
+    return QSslKey(Qt::HANDLE(pkey), QSsl::PrivateKey);
+  }
+
+  // algorithm of the key
+  const auto id = EVP_PKEY_base_id(pkey);
+
+  // the rest are parsed by Qt
+  EVP_PKEY_free(pkey);
+
+  // create the key from the pem
+  switch (id) {
+    case EVP_PKEY_RSA:
+      return QSslKey(pem, QSsl::Rsa, QSsl::Pem, QSsl::PrivateKey);
+    case EVP_PKEY_EC:
+      return QSslKey(pem, QSsl::Ec, QSsl::Pem, QSsl::PrivateKey);
+    default:
+      return QSslKey();
+  }
+}
+
+/**
+ * @brief Get the PEM encoded private key including Opaque keys
+ *
+ * @param key - private key
+ * @return QByteArray
+ */
+QByteArray toPem(const QSslKey &key) {
+  // Qt can encode the non Opaque keys
+  if (key.algorithm() != QSsl::Opaque) {
+    return key.toPem();
+  }
+
+  // Write the key to buffer
+  std::shared_ptr<BIO> buffer(BIO_new(BIO_s_mem()), BIO_free_all);
+
+  // if buffer is null then throw an error
+  if (buffer.get() == NULL) {
+    throw std::runtime_error("Can't Create BIO");
+  }
+
+  // Write the key to buffer
+  auto pkey = reinterpret_cast<EVP_PKEY *>(key.handle());
+
+  // if write failed then throw an error
+  if (!PEM_write_bio_PrivateKey(buffer.get(), pkey, NULL, NULL, 0, NULL, NULL)) {
+    throw std::runtime_error("Can't Write Key");
+  }
+
+  // Get the key from buffer
+  BUF_MEM *memory;
+
+  // Get the key from buffer
+  BIO_get_mem_ptr(buffer.get(), &memory);
+
+  // return the key
+  return QByteArray(memory->data, memory->length);
+}
+
+/**
+ * @brief Get the algorithm of the private key
+ *
+ * @param key - private key
+ * @return types::enums::KeyType
+ */
+types::enums::KeyType keyTypeOf(const QSslKey &key) {
+  switch (key.algorithm()) {
+    case QSsl::Ec:
+      return types::enums::KeyType::ECDSA;
+    case QSsl::Opaque:
+      return types::enums::KeyType::ED25519;
+    default:
+      return types::enums::KeyType::RSA;
+  }
+}
 }  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
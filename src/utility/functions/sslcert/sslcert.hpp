@@ -19,17 +19,42 @@
 #include <openssl/pem.h>
 #include <openssl/x509.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/ec.h>
 
 // local headers
 #include "constants/constants.hpp"
+#include "types/enums/enums.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::utility::functions::internal {
 /**
- *  @brief generates a EVP_PEY using RSA_generate_key_ex
+ *  @brief generates a RSA EVP_PKEY using EVP_PKEY_keygen
  *  @returns EVP_PKEY* - shared pointer to the key
  */
 std::shared_ptr<EVP_PKEY> generateRSAKey(int bits = 2048);
 
+/**
+ *  @brief generates a ECDSA P-256 EVP_PKEY using EVP_PKEY_keygen
+ *  @returns EVP_PKEY* - shared pointer to the key
+ */
+std::shared_ptr<EVP_PKEY> generateECKey();
+
+/**
+ *  @brief generates a Ed25519 EVP_PKEY using EVP_PKEY_keygen
+ *  @returns EVP_PKEY* - shared pointer to the key
+ */
+std::shared_ptr<EVP_PKEY> generateEd25519Key();
+
+/**
+ * @brief generates a EVP_PKEY of the given type
+ *
+ * @param type - key algorithm
+ * @param bits - RSA key size
+ *
+ * @return EVP_PKEY* - shared pointer to the key
+ */
+std::shared_ptr<EVP_PKEY> generateKey(types::enums::KeyType type, int bits = 2048);
+
 /**
  * @brief Generates a self-signed x509 certificate
  *
@@ -43,8 +68,37 @@ std::shared_ptr<X509> generateX509(std::shared_ptr<EVP_PKEY> pkey);
 namespace srilakshmikanthanp::clipbirdesk::utility::functions {
 /**
  * @brief Get the Q Ssl Configuration object
+ * @param type - key algorithm
  * @param bits - RSA key size
  * @return QSslConfiguration
  */
-QSslConfiguration getQSslConfiguration(int bits = 2048);
+QSslConfiguration getQSslConfiguration(
+  types::enums::KeyType type = types::enums::KeyType::ECDSA, int bits = 2048
+);
+
+/**
+ * @brief Create the QSslKey from the PEM encoded private key
+ * of any supported algorithm, Ed25519 keys are wrapped as
+ * Opaque keys since Qt can't parse them
+ *
+ * @param pem - PEM encoded private key
+ * @return QSslKey null if the key is not valid
+ */
+QSslKey toQSslKey(const QByteArray &pem);
+
+/**
+ * @brief Get the PEM encoded private key including Opaque keys
+ *
+ * @param key - private key
+ * @return QByteArray
+ */
+QByteArray toPem(const QSslKey &key);
+
+/**
+ * @brief Get the algorithm of the private key
+ *
+ * @param key - private key
+ * @return types::enums::KeyType
+ */
+types::enums::KeyType keyTypeOf(const QSslKey &key);
 }  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
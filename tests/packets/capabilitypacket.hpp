@@ -0,0 +1,74 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+
+// Local header files
+#include "packets/capabilitypacket/capabilitypacket.hpp"
+#include "types/enums/enums.hpp"
+#include "utility/functions/nbytes/nbytes.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the CapabilityPacket
+ */
+TEST(CapabilityPacket, TestingCapabilityPacket) {
+  // using the CapabilityPacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::CapabilityPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // using the Feature
+  using srilakshmikanthanp::clipbirdesk::types::enums::Feature;
+
+  // creating the packet
+  CapabilityPacket packet_send, packet_recv;
+
+  // constant values
+  const auto packetType = CapabilityPacket::PacketType::Capability;
+  const auto features   = quint32(Feature::LAZY_SYNC | Feature::QOI_IMAGE);
+
+  // create packet
+  packet_send = createPacket(params::CapabilityPacketParams{packetType, features});
+
+  // load the packet from network byte order
+  packet_recv = fromQByteArray<CapabilityPacket>(toQByteArray(packet_send));
+
+  // check the packet type
+  EXPECT_EQ(packet_recv.getPacketType(), packetType);
+
+  // check the packet length
+  EXPECT_EQ(packet_recv.getPacketLength(), packet_send.size());
+
+  // check the features
+  EXPECT_EQ(packet_recv.getFeatures(), features);
+}
+
+/**
+ * @brief testing the CapabilityPacket is not taken for another packet
+ */
+TEST(CapabilityPacket, TestingOtherPacket) {
+  // using the CapabilityPacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::CapabilityPacket;
+
+  // using the HistorySummaryPacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::HistorySummaryPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // using the NotThisPacket
+  using srilakshmikanthanp::clipbirdesk::types::except::NotThisPacket;
+
+  // create packet
+  const auto packet = createPacket(params::HistorySummaryPacketParams{
+    HistorySummaryPacket::PacketType::HistorySummary, 0, {1, 2}
+  });
+
+  // check the packet is rejected
+  EXPECT_THROW(fromQByteArray<CapabilityPacket>(toQByteArray(packet)), NotThisPacket);
+}
@@ -0,0 +1,106 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+
+// Local header files
+#include "packets/filestreampacket/filestreampacket.hpp"
+#include "types/enums/enums.hpp"
+#include "utility/functions/nbytes/nbytes.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the FileStreamPacket
+ */
+TEST(FileStreamPacket, TestingFileStreamPacket) {
+  // using the FileStreamPacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::FileStreamPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // creating the packet
+  FileStreamPacket packet_send, packet_recv;
+
+  // constant values
+  const auto packetType = FileStreamPacket::PacketType::FileStream;
+  const auto streamId   = quint64(0x0123456789abcdef);
+  const auto fileName   = QString("report.pdf");
+  const auto chunk      = QByteArray(4096, 'x');
+  const auto fileSize   = quint64(5) * 1024 * 1024 * 1024;
+  const auto offset     = fileSize - chunk.size();
+
+  // create packet
+  packet_send = createPacket(params::FileStreamPacketParams{
+    packetType, streamId, 3, 2, fileSize, offset, fileName, chunk
+  });
+
+  // load the packet from network byte order
+  packet_recv = fromQByteArray<FileStreamPacket>(toQByteArray(packet_send));
+
+  // check the packet
+  EXPECT_EQ(packet_recv.getPacketType(), packetType);
+  EXPECT_EQ(packet_recv.getPacketLength(), packet_send.size());
+  EXPECT_EQ(packet_recv.getStreamId(), streamId);
+  EXPECT_EQ(packet_recv.getFileCount(), 3u);
+  EXPECT_EQ(packet_recv.getFileIndex(), 2u);
+  EXPECT_EQ(packet_recv.getFileSize(), fileSize);
+  EXPECT_EQ(packet_recv.getOffset(), offset);
+  EXPECT_EQ(packet_recv.getFileName(), fileName.toUtf8());
+  EXPECT_EQ(packet_recv.getChunk(), chunk);
+}
+
+/**
+ * @brief testing the FileStreamPacket with chunk beyond the file
+ */
+TEST(FileStreamPacket, TestingChunkOutOfRange) {
+  // using the FileStreamPacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::FileStreamPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // constant values
+  const auto packetType = FileStreamPacket::PacketType::FileStream;
+  const auto fileName   = QString("a.txt");
+  const auto chunk      = QByteArray(16, 'x');
+
+  // chunk exceeds the file size
+  EXPECT_THROW(
+    createPacket(params::FileStreamPacketParams{packetType, 1, 1, 0, 8, 0, fileName, chunk}),
+    std::invalid_argument
+  );
+
+  // file index exceeds the file count
+  EXPECT_THROW(
+    createPacket(params::FileStreamPacketParams{packetType, 1, 1, 1, 16, 0, fileName, chunk}),
+    std::invalid_argument
+  );
+}
+
+/**
+ * @brief testing the header followed by the chunk is the packet
+ */
+TEST(FileStreamPacket, TestingHeaderBytes) {
+  // using the FileStreamPacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::FileStreamPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // constant values
+  const auto packetType = FileStreamPacket::PacketType::FileStream;
+  const auto fileName   = QString("a.txt");
+  const auto chunk      = QByteArray(64, 'x');
+
+  // create packet
+  const auto packet = createPacket(params::FileStreamPacketParams{
+    packetType, 1, 1, 0, 64, 0, fileName, chunk
+  });
+
+  // check the header and the chunk make the packet
+  EXPECT_EQ(packet.headerBytes() + chunk, toQByteArray(packet));
+}
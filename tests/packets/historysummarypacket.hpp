@@ -0,0 +1,78 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QVector>
+
+// Local header files
+#include "packets/historysummarypacket/historysummarypacket.hpp"
+#include "types/enums/enums.hpp"
+#include "utility/functions/nbytes/nbytes.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the HistorySummaryPacket
+ */
+TEST(HistorySummaryPacket, TestingHistorySummaryPacket) {
+  // using the HistorySummaryPacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::HistorySummaryPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // creating the packet
+  HistorySummaryPacket packet_send, packet_recv;
+
+  // constant values
+  const auto packetType = HistorySummaryPacket::PacketType::HistorySummary;
+  const auto freeSlots  = quint32(17);
+  const auto entries    = QVector<quint64>{0x0123456789abcdef, 0xfedcba9876543210, 0x42};
+
+  // create packet
+  packet_send = createPacket(params::HistorySummaryPacketParams{packetType, freeSlots, entries});
+
+  // load the packet from network byte order
+  packet_recv = fromQByteArray<HistorySummaryPacket>(toQByteArray(packet_send));
+
+  // check the packet type
+  EXPECT_EQ(packet_recv.getPacketType(), packetType);
+
+  // check the packet length
+  EXPECT_EQ(packet_recv.getPacketLength(), packet_send.size());
+
+  // check the free slots
+  EXPECT_EQ(packet_recv.getFreeSlots(), freeSlots);
+
+  // check the entries
+  EXPECT_EQ(packet_recv.getEntryCount(), entries.size());
+  EXPECT_EQ(packet_recv.getEntries(), entries);
+}
+
+/**
+ * @brief testing the HistorySummaryPacket with a count larger
+ * than the entries in the packet
+ */
+TEST(HistorySummaryPacket, TestingTruncatedPacket) {
+  // using the HistorySummaryPacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::HistorySummaryPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // using the MalformedPacket
+  using srilakshmikanthanp::clipbirdesk::types::except::MalformedPacket;
+
+  // create packet
+  const auto packet = createPacket(params::HistorySummaryPacketParams{
+    HistorySummaryPacket::PacketType::HistorySummary, 0, {1, 2, 3, 4}
+  });
+
+  // drop the last entry
+  const auto bytes = toQByteArray(packet);
+
+  // check the packet is rejected
+  EXPECT_THROW(fromQByteArray<HistorySummaryPacket>(bytes.left(bytes.size() - 8)), MalformedPacket);
+}
@@ -0,0 +1,54 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+
+// Local header files
+#include "packets/payloadpacket/payloadpacket.hpp"
+#include "types/enums/enums.hpp"
+#include "utility/functions/nbytes/nbytes.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the PayloadPacket
+ */
+TEST(PayloadPacket, TestingPayloadPacket) {
+  // using the PayloadPacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::PayloadPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // creating the packet
+  PayloadPacket packet_send, packet_recv;
+
+  // constant values
+  const auto packetType = PayloadPacket::PacketType::PayloadResponse;
+  const auto promiseId  = quint64(0x0123456789abcdef);
+  const auto mimeType   = QString("image/png");
+  const auto payload    = QByteArray(1024, 'x');
+
+  // create packet
+  packet_send = createPacket(params::PayloadPacketParams{packetType, promiseId, mimeType, payload});
+
+  // load the packet from network byte order
+  packet_recv = fromQByteArray<PayloadPacket>(toQByteArray(packet_send));
+
+  // check the packet type
+  EXPECT_EQ(packet_recv.getPacketType(), packetType);
+
+  // check the packet length
+  EXPECT_EQ(packet_recv.getPacketLength(), packet_send.size());
+
+  // check the promise id
+  EXPECT_EQ(packet_recv.getPromiseId(), promiseId);
+
+  // check the mime type
+  EXPECT_EQ(packet_recv.getMimeType(), mimeType.toUtf8());
+
+  // check the payload
+  EXPECT_EQ(packet_recv.getPayload(), payload);
+}
@@ -0,0 +1,75 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+
+// Local header files
+#include "packets/promisepacket/promisepacket.hpp"
+#include "types/enums/enums.hpp"
+#include "utility/functions/nbytes/nbytes.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the PromisePacket
+ */
+TEST(PromisePacket, TestingPromisePacket) {
+  // using the PromisePacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::PromiseItem;
+  using srilakshmikanthanp::clipbirdesk::network::packets::PromisePacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // creating the packet
+  PromisePacket packet_send, packet_recv;
+
+  // constant values
+  const auto packetType = PromisePacket::PacketType::Promise;
+  const auto promiseId  = quint64(0x0123456789abcdef);
+  const auto payload    = QByteArray("Hello World", 11);
+  const auto imageSize  = quint32(4 * 1024 * 1024);
+  const auto imageHash  = quint64(0xfedcba9876543210);
+
+  // create the items, text is sent and image is promised
+  QVector<params::PromiseItemParams> items = {
+    {"text/plain", quint32(payload.size()), 0x01, payload},
+    {"image/png", imageSize, imageHash, QByteArray()},
+  };
+
+  // create packet
+  packet_send = createPacket({packetType, promiseId, items});
+
+  // load the packet from network byte order
+  packet_recv = fromQByteArray<PromisePacket>(toQByteArray(packet_send));
+
+  // check the packet type
+  EXPECT_EQ(packet_recv.getPacketType(), packetType);
+
+  // check the packet length
+  EXPECT_EQ(packet_recv.getPacketLength(), packet_send.size());
+
+  // check the promise id
+  EXPECT_EQ(packet_recv.getPromiseId(), promiseId);
+
+  // check the item count
+  ASSERT_EQ(packet_recv.getItemCount(), 2);
+
+  // get the items
+  const auto text  = packet_recv.getItems().at(0);
+  const auto image = packet_recv.getItems().at(1);
+
+  // check the sent item
+  EXPECT_FALSE(text.isLazy());
+  EXPECT_EQ(text.getMimeType(), QByteArray("text/plain"));
+  EXPECT_EQ(text.getPayload(), payload);
+
+  // check the promised item
+  EXPECT_TRUE(image.isLazy());
+  EXPECT_EQ(image.getMimeType(), QByteArray("image/png"));
+  EXPECT_EQ(image.getPayloadSize(), imageSize);
+  EXPECT_EQ(image.getPayloadHash(), imageHash);
+  EXPECT_EQ(image.getPayloadLength(), 0);
+}
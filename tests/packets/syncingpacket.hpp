@@ -70,3 +70,31 @@ TEST(SyncingPacket, TestingSyncingPacket) {
     EXPECT_EQ(item.getPayload(), payload);
   }
 }
+
+/**
+ * @brief testing the items that are sent before a file stream
+ */
+TEST(SyncingPacket, TestingStreamItems) {
+  // using the ClipboardSyncPacket
+  using srilakshmikanthanp::clipbirdesk::network::packets::SyncingPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // constant values
+  const auto packetType = SyncingPacket::PacketType::StreamItems;
+  const auto items      = QVector<QPair<QString, QByteArray>>{{"text/html", "<b>files</b>"}};
+
+  // creating the packet
+  const auto packet_send = createPacket({packetType, items});
+
+  // load the packet from network byte order
+  const auto packet_recv = fromQByteArray<SyncingPacket>(toQByteArray(packet_send));
+
+  // the type tells the stream items apart from a sync
+  EXPECT_EQ(packet_recv.getPacketType(), packetType);
+
+  // check the items
+  ASSERT_EQ(packet_recv.getItemCount(), 1);
+  EXPECT_EQ(packet_recv.getItems().front().getPayload(), items.front().second);
+}
@@ -0,0 +1,82 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QDateTime>
+#include <QHostAddress>
+
+// Local header files
+#include "store/endpointcache/endpointcache.hpp"
+
+/**
+ * @brief Endpoint of the server seen the seconds after the epoch
+ */
+inline srilakshmikanthanp::clipbirdesk::storage::EndpointCache::Endpoint endpointCacheEntry(
+  const QString &name, qint64 seen
+) {
+  return {name, {QHostAddress("192.168.1.2"), QHostAddress("fe80::1")}, 4040, "fp", QDateTime::fromSecsSinceEpoch(seen)};
+}
+
+/**
+ * @brief testing the endpoint cache order and replace
+ */
+TEST(EndpointCache, TestingOrderAndReplace) {
+  // using the EndpointCache
+  using srilakshmikanthanp::clipbirdesk::storage::EndpointCache;
+
+  // cache the endpoints
+  EndpointCache cache(4);
+  cache.insert(endpointCacheEntry("a", 10));
+  cache.insert(endpointCacheEntry("b", 30));
+  cache.insert(endpointCacheEntry("c", 20));
+
+  // most recently seen first
+  auto endpoints = cache.endpoints();
+  ASSERT_EQ(endpoints.size(), 3);
+  EXPECT_EQ(endpoints.at(0).name, "b");
+  EXPECT_EQ(endpoints.at(1).name, "c");
+  EXPECT_EQ(endpoints.at(2).name, "a");
+  EXPECT_EQ(endpoints.at(0).addresses.size(), 2);
+
+  // seen again replaces the old one
+  cache.insert(endpointCacheEntry("a", 40));
+  EXPECT_EQ(cache.size(), 3);
+  EXPECT_EQ(cache.endpoints().constFirst().name, "a");
+
+  // remove the endpoint
+  cache.remove("b");
+  EXPECT_FALSE(cache.contains("b"));
+  EXPECT_EQ(cache.size(), 2);
+}
+
+/**
+ * @brief testing the endpoint cache eviction and expiry
+ */
+TEST(EndpointCache, TestingEvictAndExpire) {
+  // using the EndpointCache
+  using srilakshmikanthanp::clipbirdesk::storage::EndpointCache;
+
+  // cache over the capacity
+  EndpointCache cache(2);
+  cache.insert(endpointCacheEntry("a", 10));
+  cache.insert(endpointCacheEntry("b", 20));
+  cache.insert(endpointCacheEntry("c", 30));
+
+  // least recently seen is evicted
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_FALSE(cache.contains("a"));
+
+  // expire the endpoints seen before
+  EXPECT_TRUE(cache.expire(QDateTime::fromSecsSinceEpoch(25)));
+  EXPECT_FALSE(cache.contains("b"));
+  EXPECT_TRUE(cache.contains("c"));
+
+  // nothing to expire
+  EXPECT_FALSE(cache.expire(QDateTime::fromSecsSinceEpoch(25)));
+
+  // remove all
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
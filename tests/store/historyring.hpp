@@ -0,0 +1,95 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Local header files
+#include "store/historyring/historyring.hpp"
+
+/**
+ * @brief ids of the ring newest first
+ */
+inline QVector<quint64> idsOf(const srilakshmikanthanp::clipbirdesk::storage::HistoryRing &ring) {
+  QVector<quint64> ids;
+  for (qsizetype i = 0; i < ring.size(); ++i) ids.append(ring.at(i).id);
+  return ids;
+}
+
+/**
+ * @brief testing the ring evicts the oldest when full
+ */
+TEST(HistoryRing, TestingEviction) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // create the ring
+  HistoryRing ring(3);
+
+  // fill the ring
+  EXPECT_FALSE(ring.pushFront({1, {}}).has_value());
+  EXPECT_FALSE(ring.pushFront({2, {}}).has_value());
+  EXPECT_FALSE(ring.pushFront({3, {}}).has_value());
+
+  // check the eviction
+  const auto evicted = ring.pushFront({4, {{"text/plain", "four"}}});
+  ASSERT_TRUE(evicted.has_value());
+  EXPECT_EQ(evicted->id, 1u);
+  EXPECT_EQ(idsOf(ring), QVector<quint64>({4, 3, 2}));
+  EXPECT_EQ(ring.at(0).items.at(0).second, QByteArray("four"));
+}
+
+/**
+ * @brief testing the remove from both halves keeps the order
+ */
+TEST(HistoryRing, TestingTakeAt) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // create the ring that wraps around
+  HistoryRing ring(5);
+  for (quint64 id = 1; id <= 7; ++id) ring.pushFront({id, {}});
+
+  // remove from the newer half and the older half
+  EXPECT_EQ(ring.takeAt(1).id, 6u);
+  EXPECT_EQ(ring.takeAt(2).id, 4u);
+
+  // check the order
+  EXPECT_EQ(idsOf(ring), QVector<quint64>({7, 5, 3}));
+  EXPECT_EQ(ring.indexOf(3), 2);
+  EXPECT_THROW(ring.takeAt(3), std::out_of_range);
+
+  // add after the remove
+  ring.pushFront({8, {}});
+  ring.pushFront({9, {}});
+  ring.pushFront({10, {}});
+  EXPECT_EQ(idsOf(ring), QVector<quint64>({10, 9, 8, 7, 5}));
+}
+
+/**
+ * @brief testing the insert in both halves keeps the order
+ */
+TEST(HistoryRing, TestingInsert) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // create the ring that wraps around
+  HistoryRing ring(6);
+  for (quint64 id = 1; id <= 7; ++id) ring.pushFront({id, {}});
+  ring.takeAt(4);
+  ring.takeAt(4);
+
+  // insert into the newer half, the older half and the back
+  ring.insert(1, {8, {}});
+  EXPECT_EQ(idsOf(ring), QVector<quint64>({7, 8, 6, 5, 4}));
+  ring.insert(5, {9, {}});
+  EXPECT_EQ(idsOf(ring), QVector<quint64>({7, 8, 6, 5, 4, 9}));
+
+  // the full ring does not evict
+  EXPECT_THROW(ring.insert(0, {10, {}}), std::length_error);
+  EXPECT_THROW(ring.takeAt(6), std::out_of_range);
+
+  // remove and insert at the front
+  ring.takeAt(3);
+  ring.insert(0, {11, {}});
+  EXPECT_EQ(idsOf(ring), QVector<quint64>({11, 7, 8, 6, 4, 9}));
+}
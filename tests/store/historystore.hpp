@@ -0,0 +1,211 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QFile>
+#include <QTemporaryDir>
+
+// Local header files
+#include "store/historystore/historystore.hpp"
+
+/**
+ * @brief testing the history store keeps the entries across reopen
+ */
+TEST(HistoryStore, TestingReopen) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // temporary directory for the store
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  // entries to store
+  const QVector<QPair<QString, QByteArray>> first  = {{"text/plain", "first"}};
+  const QVector<QPair<QString, QByteArray>> second = {{"text/plain", "second"}, {"text/html", "<b>second</b>"}};
+  quint64 firstId, secondId;
+
+  // write the entries
+  {
+    HistoryStore store(dir.path(), 1024);
+    firstId  = store.append(first);
+    secondId = store.append(second);
+    store.update(firstId, {{"text/plain", "first"}, {"image/png", "png"}});
+  }
+
+  // read the entries
+  HistoryStore store(dir.path(), 1024);
+
+  // check the entries
+  EXPECT_EQ(store.entries(), QVector<quint64>({secondId, firstId}));
+  EXPECT_EQ(store.items(secondId), second);
+  EXPECT_EQ(store.items(firstId).size(), 2);
+  EXPECT_EQ(store.items(firstId).at(1).second, QByteArray("png"));
+}
+
+/**
+ * @brief testing the payloads are deduplicated by hash
+ */
+TEST(HistoryStore, TestingDeduplication) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // temporary directory for the store
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  // same payload many times
+  HistoryStore store(dir.path(), 1024 * 1024);
+  const QByteArray payload(4096, 'x');
+
+  for (int i = 0; i < 10; ++i) {
+    store.append({{"text/plain", payload}});
+  }
+
+  // check only one copy is on the disk
+  EXPECT_EQ(store.liveBytes(), quint64(payload.size()));
+  EXPECT_EQ(store.diskBytes(), quint64(payload.size()));
+}
+
+/**
+ * @brief testing the torn tail of the index is dropped
+ */
+TEST(HistoryStore, TestingTornIndex) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // temporary directory for the store
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  // write the entries
+  quint64 id;
+  {
+    HistoryStore store(dir.path(), 1024);
+    id = store.append({{"text/plain", "kept"}});
+    store.append({{"text/plain", "torn"}});
+  }
+
+  // tear the last record
+  QFile index(dir.filePath("index"));
+  ASSERT_TRUE(index.open(QIODevice::ReadWrite));
+  ASSERT_TRUE(index.resize(index.size() - 3));
+  index.close();
+
+  // read the entries
+  HistoryStore store(dir.path(), 1024);
+
+  // check only the complete record is kept
+  EXPECT_EQ(store.entries(), QVector<quint64>({id}));
+  EXPECT_EQ(store.items(id).at(0).second, QByteArray("kept"));
+}
+
+/**
+ * @brief testing the renewed entry is loaded back as newest
+ */
+TEST(HistoryStore, TestingRenew) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // temporary directory for the store
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  // entries to store
+  const QVector<QPair<QString, QByteArray>> older = {{"text/plain", "older"}};
+  const QVector<QPair<QString, QByteArray>> newer = {{"text/plain", "newer"}};
+  quint64 olderId, newerId;
+
+  // write the entries and move the older to the front
+  {
+    HistoryStore store(dir.path(), 1024);
+    olderId = store.append(older);
+    newerId = store.append(newer);
+    olderId = store.renew(olderId);
+    EXPECT_THROW(store.renew(olderId + 1), std::invalid_argument);
+  }
+
+  // read the entries
+  HistoryStore store(dir.path(), 1024);
+
+  // check the order and the payloads
+  EXPECT_EQ(store.entries(), QVector<quint64>({olderId, newerId}));
+  EXPECT_EQ(store.items(olderId), older);
+  EXPECT_EQ(store.items(newerId), newer);
+}
+
+/**
+ * @brief testing the compaction reclaims the dead payloads
+ */
+TEST(HistoryStore, TestingCompaction) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // temporary directory for the store
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  // small segments so the payloads span many
+  const quint64 segmentSize = 64 * 1024;
+  QVector<quint64> ids;
+
+  // fill and remove most of the entries
+  {
+    HistoryStore store(dir.path(), segmentSize);
+
+    for (int i = 0; i < 32; ++i) {
+      ids.append(store.append({{"text/plain", QByteArray(16 * 1024, char('a' + i % 26)) + QByteArray::number(i)}}));
+    }
+
+    for (int i = 0; i < 30; ++i) {
+      store.remove(ids.at(i));
+    }
+
+    store.waitForCompaction();
+    store.compact();
+    store.waitForCompaction();
+
+    // check the dead payloads are gone
+    EXPECT_LT(store.diskBytes(), 2 * store.liveBytes() + segmentSize / 4);
+    EXPECT_EQ(store.items(ids.at(31)).at(0).second.right(2), QByteArray("31"));
+  }
+
+  // read the entries
+  HistoryStore store(dir.path(), segmentSize);
+
+  // check the entries survived the compaction
+  EXPECT_EQ(store.entries(), QVector<quint64>({ids.at(31), ids.at(30)}));
+  EXPECT_EQ(store.items(ids.at(30)).at(0).second.right(2), QByteArray("30"));
+}
+
+/**
+ * @brief testing the large payloads can be left in the store
+ */
+TEST(HistoryStore, TestingLimitedRead) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // temporary directory for the store
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  // entry with a small and a large payload
+  const QVector<QPair<QString, QByteArray>> items = {{"text/plain", "small"}, {"image/png", QByteArray(8192, 'p')}};
+  HistoryStore store(dir.path(), 1024 * 1024);
+  const auto id = store.append(items);
+
+  // read with the limit
+  bool skipped = false;
+  const auto limited = store.items(id, 1024, &skipped);
+
+  // check only the large payload is skipped
+  EXPECT_TRUE(skipped);
+  EXPECT_EQ(limited.at(0).second, QByteArray("small"));
+  EXPECT_TRUE(limited.at(1).second.isNull());
+
+  // check the fingerprint does not need the payloads
+  EXPECT_EQ(fingerprint(store.hashes(id)), fingerprint(items));
+}
@@ -0,0 +1,72 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QString>
+
+// Local header files
+#include "store/searchindex/searchindex.hpp"
+
+/**
+ * @brief testing the search finds the substring ignoring case
+ */
+TEST(SearchIndex, TestingSearch) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // create the index
+  SearchIndex index(1024);
+  index.insert(1, "git commit --amend");
+  index.insert(2, "Hello World");
+  index.insert(3, "world peace");
+
+  // check the queries
+  EXPECT_EQ(index.search("WORLD"), QVector<quint64>({3, 2}));
+  EXPECT_EQ(index.search("commit"), QVector<quint64>({1}));
+  EXPECT_EQ(index.search("o"), QVector<quint64>({3, 2, 1}));
+  EXPECT_TRUE(index.search("dlrow").isEmpty());
+
+  // trigrams match but the text does not
+  index.insert(4, "abcd bcde");
+  EXPECT_TRUE(index.search("abcde").isEmpty());
+}
+
+/**
+ * @brief testing the index follows the insert and remove
+ */
+TEST(SearchIndex, TestingUpdate) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // create the index
+  SearchIndex index(1024);
+  index.insert(1, "first snippet");
+  index.insert(2, "second snippet");
+
+  // replace and remove
+  index.insert(1, "replaced");
+  index.remove(2);
+
+  // check the queries
+  EXPECT_TRUE(index.search("snippet").isEmpty());
+  EXPECT_EQ(index.search("replaced"), QVector<quint64>({1}));
+  EXPECT_EQ(index.size(), 1);
+}
+
+/**
+ * @brief testing only the leading text is indexed
+ */
+TEST(SearchIndex, TestingLimit) {
+  // using storage namespace
+  using namespace srilakshmikanthanp::clipbirdesk::storage;
+
+  // create the index
+  SearchIndex index(8);
+  index.insert(1, "visible hidden");
+
+  // check the queries
+  EXPECT_EQ(index.search("visible"), QVector<quint64>({1}));
+  EXPECT_TRUE(index.search("hidden").isEmpty());
+}
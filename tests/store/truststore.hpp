@@ -0,0 +1,105 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QSslCertificate>
+
+// Local header files
+#include "store/truststore/truststore.hpp"
+
+/**
+ * @brief Self signed certificates of two devices
+ */
+inline QSslCertificate trustStoreCert(int device) {
+  static const QByteArray pems[] = {
+    "-----BEGIN CERTIFICATE-----\n"
+    "MIIBfTCCASOgAwIBAgIURewn7+3uIX017/ie8TgG+jNOG6AwCgYIKoZIzj0EAwIw\n"
+    "EzERMA8GA1UEAwwIZGV2aWNlLWEwIBcNMjYxMDE4MTAzNjQzWhgPMjEyNjA5MjQx\n"
+    "MDM2NDNaMBMxETAPBgNVBAMMCGRldmljZS1hMFkwEwYHKoZIzj0CAQYIKoZIzj0D\n"
+    "AQcDQgAE/0rGHk1b6UnV86zGTwjqQ9tisRCyqo0L/IbllXHhbQhl1Gg/naHuVhRE\n"
+    "ZDn1ArZynRsmDhAxPOu2wFTlC6y6hqNTMFEwHQYDVR0OBBYEFP84Ww8PTfshs/O/\n"
+    "3sjbaOG2zHVjMB8GA1UdIwQYMBaAFP84Ww8PTfshs/O/3sjbaOG2zHVjMA8GA1Ud\n"
+    "EwEB/wQFMAMBAf8wCgYIKoZIzj0EAwIDSAAwRQIhALX13Z/4EQP+xg12sybfIF2P\n"
+    "dZsUfODMCqOnfSs508pTAiA1sP6iPbQTOgG0DyAf+xVCHXKA+YvJJX1rleobB48+\n"
+    "RQ==\n"
+    "-----END CERTIFICATE-----\n",
+    "-----BEGIN CERTIFICATE-----\n"
+    "MIIBfTCCASOgAwIBAgIUaRkCJBsyRAgRg6OmV8qRASVrpf8wCgYIKoZIzj0EAwIw\n"
+    "EzERMA8GA1UEAwwIZGV2aWNlLWIwIBcNMjYxMDE4MTAzNjQzWhgPMjEyNjA5MjQx\n"
+    "MDM2NDNaMBMxETAPBgNVBAMMCGRldmljZS1iMFkwEwYHKoZIzj0CAQYIKoZIzj0D\n"
+    "AQcDQgAEd9RY4NmnUO2pRY9HorKWdvkdnAmLvixllwGDeCS90UhDzY8Om0qyk0o4\n"
+    "vbGtx4eDQSfdtvASwrIL2TFn9bucgqNTMFEwHQYDVR0OBBYEFA8tCMSGyTSh0wIA\n"
+    "nx5vlxOoxAuXMB8GA1UdIwQYMBaAFA8tCMSGyTSh0wIAnx5vlxOoxAuXMA8GA1Ud\n"
+    "EwEB/wQFMAMBAf8wCgYIKoZIzj0EAwIDSAAwRQIgeyZh7bJ1B5Wz1qDXoBtH8+Uk\n"
+    "piYhC1FOgo8UaYc9qXgCIQDLhlMvZZSGWUuHOFcPD6vbB40GHHPXjAAnTKv0ff0W\n"
+    "4A==\n"
+    "-----END CERTIFICATE-----\n"
+  };
+
+  return QSslCertificate(pems[device], QSsl::Pem);
+}
+
+/**
+ * @brief testing the trust store lookups
+ */
+TEST(TrustStore, TestingLookup) {
+  // using the TrustStore
+  using srilakshmikanthanp::clipbirdesk::storage::TrustStore;
+
+  // certificates
+  const auto a = trustStoreCert(0), b = trustStoreCert(1);
+
+  // trust the device
+  TrustStore trust;
+  trust.insert("device-a", a);
+
+  // check the lookups
+  EXPECT_FALSE(a.isNull());
+  EXPECT_TRUE(trust.contains("device-a"));
+  EXPECT_TRUE(trust.contains(a));
+  EXPECT_FALSE(trust.contains(b));
+  EXPECT_TRUE(trust.isTrusted("device-a", a));
+  EXPECT_FALSE(trust.isTrusted("device-a", b));
+  EXPECT_FALSE(trust.isTrusted("device-b", a));
+  EXPECT_TRUE(trust.isTrusted("device-a", TrustStore::fingerprintOf(a)));
+  EXPECT_FALSE(trust.isTrusted("device-a", TrustStore::fingerprintOf(b)));
+  EXPECT_EQ(trust.certificate("device-a"), a);
+  EXPECT_THROW(trust.certificate("device-b"), std::invalid_argument);
+}
+
+/**
+ * @brief testing the trust store replace and remove
+ */
+TEST(TrustStore, TestingReplaceAndRemove) {
+  // using the TrustStore
+  using srilakshmikanthanp::clipbirdesk::storage::TrustStore;
+
+  // certificates
+  const auto a = trustStoreCert(0), b = trustStoreCert(1);
+
+  // trust the device then its new certificate
+  TrustStore trust;
+  trust.insert("device", a);
+  trust.insert("device", b);
+
+  // old certificate is no longer trusted
+  EXPECT_EQ(trust.size(), 1);
+  EXPECT_FALSE(trust.contains(a));
+  EXPECT_TRUE(trust.isTrusted("device", b));
+
+  // same certificate for two names
+  trust.insert("other", b);
+  trust.remove("device");
+
+  // still trusted for the other name
+  EXPECT_TRUE(trust.contains(b));
+  EXPECT_EQ(trust.certificates().size(), 1);
+
+  // remove all
+  trust.clear();
+  EXPECT_EQ(trust.size(), 0);
+  EXPECT_FALSE(trust.contains(b));
+}
@@ -0,0 +1,94 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QHostAddress>
+#include <QList>
+
+// C++ header files
+#include <optional>
+
+// Local header files
+#include "syncing/addressracer/addressracer.hpp"
+
+/**
+ * @brief Addresses of the server used by the order tests
+ */
+inline QList<QHostAddress> addressRacerAddresses(const QStringList &addresses) {
+  QList<QHostAddress> result;
+  for (const auto &address : addresses) result.append(QHostAddress(address));
+  return result;
+}
+
+/**
+ * @brief testing a single family keeps the order
+ */
+TEST(AddressRacer, TestingSingleFamily) {
+  // using the AddressRacer
+  using srilakshmikanthanp::clipbirdesk::network::syncing::AddressRacer;
+
+  // IPv4 only
+  const auto ipv4 = addressRacerAddresses({"192.168.1.2", "10.0.0.2", "172.16.0.2"});
+  EXPECT_EQ(AddressRacer::order(ipv4, std::nullopt), ipv4);
+
+  // IPv6 only
+  const auto ipv6 = addressRacerAddresses({"fe80::1", "fd00::1"});
+  EXPECT_EQ(AddressRacer::order(ipv6, std::nullopt), ipv6);
+
+  // nothing to order
+  EXPECT_TRUE(AddressRacer::order({}, std::nullopt).isEmpty());
+}
+
+/**
+ * @brief testing the families are interleaved starting with IPv6
+ */
+TEST(AddressRacer, TestingMixedFamilies) {
+  // using the AddressRacer
+  using srilakshmikanthanp::clipbirdesk::network::syncing::AddressRacer;
+
+  // interleaved starting with IPv6
+  const auto mixed = addressRacerAddresses({"192.168.1.2", "10.0.0.2", "fe80::1", "fd00::1"});
+  EXPECT_EQ(
+    AddressRacer::order(mixed, std::nullopt),
+    addressRacerAddresses({"fe80::1", "192.168.1.2", "fd00::1", "10.0.0.2"})
+  );
+
+  // the rest of the larger family goes last
+  const auto uneven = addressRacerAddresses({"192.168.1.2", "10.0.0.2", "172.16.0.2", "fe80::1"});
+  EXPECT_EQ(
+    AddressRacer::order(uneven, std::nullopt),
+    addressRacerAddresses({"fe80::1", "192.168.1.2", "10.0.0.2", "172.16.0.2"})
+  );
+}
+
+/**
+ * @brief testing the preferred address goes first followed by
+ * the other family
+ */
+TEST(AddressRacer, TestingPreferred) {
+  // using the AddressRacer
+  using srilakshmikanthanp::clipbirdesk::network::syncing::AddressRacer;
+
+  // addresses of the server
+  const auto mixed = addressRacerAddresses({"192.168.1.2", "10.0.0.2", "fe80::1", "fd00::1"});
+
+  // preferred IPv4 then IPv6
+  EXPECT_EQ(
+    AddressRacer::order(mixed, QHostAddress("10.0.0.2")),
+    addressRacerAddresses({"10.0.0.2", "fe80::1", "192.168.1.2", "fd00::1"})
+  );
+
+  // preferred IPv6 then IPv4
+  EXPECT_EQ(
+    AddressRacer::order(mixed, QHostAddress("fd00::1")),
+    addressRacerAddresses({"fd00::1", "192.168.1.2", "fe80::1", "10.0.0.2"})
+  );
+
+  // preferred that is no longer announced is ignored
+  EXPECT_EQ(
+    AddressRacer::order(mixed, QHostAddress("172.16.0.2")),
+    AddressRacer::order(mixed, std::nullopt)
+  );
+}
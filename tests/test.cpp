@@ -3,9 +3,22 @@
 
 // Local header files
 #include "packets/authentication.hpp"
+#include "packets/capabilitypacket.hpp"
+#include "packets/filestreampacket.hpp"
+#include "packets/historysummarypacket.hpp"
 #include "packets/invalidrequest.hpp"
+#include "packets/payloadpacket.hpp"
 #include "packets/pingpacket.hpp"
+#include "packets/promisepacket.hpp"
 #include "packets/syncingpacket.hpp"
+#include "store/endpointcache.hpp"
+#include "store/historyring.hpp"
+#include "store/historystore.hpp"
+#include "store/searchindex.hpp"
+#include "store/truststore.hpp"
+#include "syncing/addressracer.hpp"
+#include "utility/hash.hpp"
+#include "utility/qoi.hpp"
 
 /**
  * @brief Testing the clipbirdesk Application
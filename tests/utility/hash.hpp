@@ -0,0 +1,50 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+// Local header files
+#include "utility/functions/hash/hash.hpp"
+
+/**
+ * @brief testing the fingerprint does not depend on the item order
+ */
+TEST(Fingerprint, TestingOrderIndependent) {
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // items in different order
+  const QVector<QPair<QString, QByteArray>> a = {{"text/html", "<b>hi</b>"}, {"text/plain", "hi"}};
+  const QVector<QPair<QString, QByteArray>> b = {{"text/plain", "hi"}, {"text/html", "<b>hi</b>"}};
+
+  // check the fingerprint
+  EXPECT_EQ(fingerprint(a), fingerprint(b));
+}
+
+/**
+ * @brief testing the fingerprint changes with the content
+ */
+TEST(Fingerprint, TestingContentChange) {
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // base items
+  const QVector<QPair<QString, QByteArray>> base = {{"text/plain", "hi"}};
+
+  // payload, mime and item count changes
+  const QVector<QPair<QString, QByteArray>> payload = {{"text/plain", "ho"}};
+  const QVector<QPair<QString, QByteArray>> mime    = {{"text/html", "hi"}};
+  const QVector<QPair<QString, QByteArray>> more    = {{"text/plain", "hi"}, {"text/html", "hi"}};
+
+  // check the fingerprint
+  EXPECT_NE(fingerprint(base), fingerprint(payload));
+  EXPECT_NE(fingerprint(base), fingerprint(mime));
+  EXPECT_NE(fingerprint(base), fingerprint(more));
+  EXPECT_EQ(fingerprint(base), fingerprint(QVector<QPair<QString, quint64>>{{"text/plain", xxh3("hi")}}));
+}
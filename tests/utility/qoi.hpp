@@ -0,0 +1,127 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QImage>
+#include <QRandomGenerator>
+
+// Local header files
+#include "utility/functions/qoi/qoi.hpp"
+
+/**
+ * @brief Create a image that looks like a screenshot it has flat window
+ * areas, a gradient title bar and a noisy photo like region
+ */
+inline QImage createScreenshotLikeImage(int width, int height) {
+  QImage image(width, height, QImage::Format_RGBA8888);
+  QRandomGenerator rand(42);
+
+  for (int y = 0; y < height; y++) {
+    auto line = image.scanLine(y);
+    for (int x = 0; x < width; x++) {
+      auto px = line + x * 4;
+
+      if (y < height / 20) {                              // title bar
+        px[0] = x * 255 / width; px[1] = 80; px[2] = 160;
+      } else if (x > width / 2 && y > height / 2) {       // photo
+        px[0] = (x ^ y) & 0xff; px[1] = rand.bounded(256); px[2] = (x + y) & 0xff;
+      } else if ((x / 8 + y / 16) % 11 == 0) {            // text like pattern
+        px[0] = 20; px[1] = 20; px[2] = 20;
+      } else {                                            // window background
+        px[0] = 240; px[1] = 240; px[2] = 240;
+      }
+
+      px[3] = 255;
+    }
+  }
+
+  return image;
+}
+
+/**
+ * @brief testing the QOI encode and decode is lossless
+ */
+TEST(QoiCodec, TestingRoundTrip) {
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // create image with alpha
+  auto image = createScreenshotLikeImage(257, 131);
+
+  // vary the alpha
+  for (int y = 0; y < image.height(); y += 3) {
+    image.scanLine(y)[3] = y & 0xff;
+  }
+
+  // encode and decode
+  auto encoded = encodeQoi(image);
+  auto decoded = decodeQoi(encoded);
+
+  // check the image
+  EXPECT_FALSE(encoded.isEmpty());
+  EXPECT_EQ(decoded.size(), image.size());
+  EXPECT_EQ(decoded, image);
+}
+
+/**
+ * @brief testing the QOI decoder with invalid data
+ */
+TEST(QoiCodec, TestingInvalidData) {
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // encode valid image
+  auto encoded = encodeQoi(createScreenshotLikeImage(16, 16));
+
+  // check invalid data
+  EXPECT_TRUE(decodeQoi(QByteArray()).isNull());
+  EXPECT_TRUE(decodeQoi(QByteArray("not a qoi image at all")).isNull());
+  EXPECT_TRUE(decodeQoi(encoded.left(encoded.size() / 2)).isNull());
+}
+
+/**
+ * @brief testing the QOI items are re-encoded as PNG losslessly
+ */
+TEST(QoiCodec, TestingItemsToPng) {
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // create image
+  const auto image = createScreenshotLikeImage(64, 48);
+
+  // items with a QOI image
+  const QVector<QPair<QString, QByteArray>> items = {
+    {"text/plain", "hello"}, {"image/qoi", encodeQoi(image)}
+  };
+
+  // re-encode
+  const auto result = qoiItemsToPng(items);
+
+  // check the other items are kept
+  ASSERT_EQ(result.size(), 2);
+  EXPECT_EQ(result[0], items[0]);
+
+  // check the image is PNG and lossless
+  EXPECT_EQ(result[1].first, "image/png");
+  EXPECT_EQ(QImage::fromData(result[1].second, "PNG").convertToFormat(QImage::Format_RGBA8888), image);
+}
+
+/**
+ * @brief testing the PNG encoding is lossless and empty for no image
+ */
+TEST(QoiCodec, TestingEncodePng) {
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // create image
+  const auto image = createScreenshotLikeImage(64, 48);
+
+  // check the image is lossless
+  EXPECT_EQ(QImage::fromData(encodePng(image), "PNG").convertToFormat(QImage::Format_RGBA8888), image);
+
+  // check no image is not encoded
+  EXPECT_TRUE(encodePng(QImage()).isEmpty());
+}
@@ -0,0 +1,107 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Copyright (c) 2024 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Qt headers
+#include <QByteArray>
+#include <QPair>
+#include <QRandomGenerator>
+#include <QString>
+#include <QVector>
+#include <QtEndian>
+
+// C++ headers
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+namespace srilakshmikanthanp::clipbirdesk::tools {
+/// @brief mime of the item that carries the sequence number
+inline const QString SEQUENCE_MIME = "application/x-clipbird-bench";
+
+/**
+ * @brief Item of the payload mix, picked weight times per round
+ */
+struct MixEntry {
+  QString mime;
+  QByteArray payload;
+  int weight;
+};
+
+/**
+ * @brief Parse the payload mix "mime=bytes[xweight],..." with
+ * random payloads of the sizes
+ */
+inline std::vector<MixEntry> parseMix(const QString &mix) {
+  std::vector<MixEntry> entries;
+
+  for (const auto &entry : mix.split(',', Qt::SkipEmptyParts)) {
+    // mime and size with weight
+    const auto pair = entry.split('=');
+    if (pair.size() != 2) continue;
+
+    // size and weight
+    const auto size   = pair[1].split('x');
+    const auto bytes  = size[0].toLongLong();
+    const auto weight = size.size() > 1 ? size[1].toInt() : 1;
+    if (bytes <= 0 || weight <= 0) continue;
+
+    // random payload of the size
+    QByteArray payload(bytes, Qt::Uninitialized);
+    for (auto &byte : payload) byte = char(QRandomGenerator::global()->bounded(256));
+
+    entries.push_back({pair[0], payload, weight});
+  }
+
+  return entries;
+}
+
+/**
+ * @brief Entries of the mix repeated by weight for round robin
+ */
+inline std::vector<const MixEntry *> mixRounds(const std::vector<MixEntry> &mix) {
+  std::vector<const MixEntry *> rounds;
+
+  for (const auto &entry : mix) {
+    for (int i = 0; i < entry.weight; ++i) rounds.push_back(&entry);
+  }
+
+  return rounds;
+}
+
+/**
+ * @brief Percentile of the samples
+ */
+inline double percentile(std::vector<double> samples, double p) {
+  if (samples.empty()) return 0;
+  std::sort(samples.begin(), samples.end());
+  auto index = qsizetype(std::ceil(p * samples.size())) - 1;
+  return samples[std::clamp<qsizetype>(index, 0, samples.size() - 1)];
+}
+
+/**
+ * @brief Items of the sync tagged with the sequence number
+ */
+inline QVector<QPair<QString, QByteArray>> sequenceItems(quint64 sequence, const MixEntry &entry) {
+  QByteArray bytes(sizeof(quint64), Qt::Uninitialized);
+  qToBigEndian<quint64>(sequence, bytes.data());
+  return {{SEQUENCE_MIME, bytes}, {entry.mime, entry.payload}};
+}
+
+/**
+ * @brief Sequence number carried by the items if any
+ */
+inline std::optional<quint64> sequenceOf(const QVector<QPair<QString, QByteArray>> &items) {
+  for (const auto &[mime, payload] : items) {
+    if (mime == SEQUENCE_MIME && payload.size() == sizeof(quint64)) {
+      return qFromBigEndian<quint64>(payload.constData());
+    }
+  }
+
+  return std::nullopt;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::tools
@@ -0,0 +1,356 @@
+// Copyright (c) 2024 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Qt headers
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QProcess>
+#include <QTemporaryDir>
+#include <QTimer>
+
+// C++ headers
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// local headers
+#include "common/bench.hpp"
+#include "mdns/mdns.hpp"
+#include "syncing/client/client.hpp"
+#include "syncing/server/server.hpp"
+#include "utility/functions/sslcert/sslcert.hpp"
+
+using namespace srilakshmikanthanp::clipbirdesk;
+using namespace srilakshmikanthanp::clipbirdesk::tools;
+
+/**
+ * @brief Write the bytes to the file in the directory
+ */
+bool writeFile(const QDir &dir, const QString &name, const QByteArray &bytes) {
+  QFile file(dir.filePath(name));
+  return file.open(QIODevice::WriteOnly) && file.write(bytes) == bytes.size();
+}
+
+/**
+ * @brief Read the bytes of the file in the directory
+ */
+QByteArray readFile(const QDir &dir, const QString &name) {
+  QFile file(dir.filePath(name));
+  return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+}
+
+/**
+ * @brief Run the hub with the identity in the directory that trusts
+ * the clients in it, prints the port once listening and the CPU time
+ * once all the clients are gone, the discovery is kept in process
+ */
+int runHub(QCoreApplication &app, const QDir &dir, int lifetime) {
+  // identity of the hub
+  QSslConfiguration config;
+  config.setLocalCertificate(QSslCertificate(readFile(dir, "hub.crt"), QSsl::Pem));
+  config.setPrivateKey(utility::functions::toQSslKey(readFile(dir, "hub.key")));
+  config.setCaCertificates(QSslCertificate::fromData(readFile(dir, "clients.crt"), QSsl::Pem));
+  config.setPeerVerifyMode(QSslSocket::VerifyPeer);
+
+  // if the identity is not usable
+  if (config.localCertificate().isNull() || config.privateKey().isNull()) {
+    std::fprintf(stderr, "invalid hub identity\n"); return 2;
+  }
+
+  // not advertised on the network
+  network::service::mdnsLoopback loopback;
+
+  // the hub
+  network::syncing::Server server;
+  server.setBackend(&loopback);
+  server.setSslConfiguration(config);
+
+  // CPU and wall time of the hub
+  QElapsedTimer wall;
+  bool hadClients = false;
+
+  // print the usage and quit
+  const auto finish = [&] {
+    const double cpu = double(std::clock()) / CLOCKS_PER_SEC * 1000;
+    std::printf("cpu %.0f %lld\n", cpu, wall.elapsed());
+    std::fflush(stdout);
+    app.quit();
+  };
+
+  // quit once all the clients are gone
+  QObject::connect(&server, &network::syncing::Server::OnClientListChanged, [&](auto clients) {
+    if (!clients.isEmpty()) {
+      hadClients = true;
+    } else if (hadClients) {
+      finish();
+    }
+  });
+
+  // never outlive the generator
+  QTimer::singleShot(lifetime, &app, finish);
+
+  // start the hub
+  server.startServer();
+  wall.start();
+
+  // the generator waits for the port
+  std::printf("port %u\n", unsigned(server.getServerInfo().port));
+  std::fflush(stdout);
+
+  return app.exec();
+}
+
+/**
+ * @brief Open many authenticated connections to a hub in a child
+ * process and replay the clipboard traffic from some of them, the
+ * hub relays every copy to all the other clients
+ *
+ * usage: loadgen [--clients N] [--senders N] [--rate N] [--duration s]
+ *        [--mix mime=bytes[xweight],...] [--connect-timeout ms]
+ */
+auto main(int argc, char **argv) -> int {
+  QCoreApplication app(argc, argv);
+
+  // command line options
+  QCommandLineParser parser;
+  parser.addHelpOption();
+  parser.addOptions({
+    {"clients", "Number of clients.", "n", "200"},
+    {"senders", "Number of clients that copy.", "n", "1"},
+    {"rate", "Copies per second from all the senders.", "n", "10"},
+    {"duration", "Seconds to replay the traffic.", "s", "30"},
+    {"mix", "Payload mix mime=bytes[xweight],...", "mix", "text/plain=256x8,text/html=16384x2,image/png=262144"},
+    {"connect-timeout", "Fail if not all connected within ms.", "ms", "60000"},
+    {"hub", "Run as the hub with the identity in the directory.", "dir"},
+    {"hub-lifetime", "Max lifetime of the hub in ms.", "ms", "600000"},
+  });
+  parser.process(app);
+
+  // if running as the hub
+  if (parser.isSet("hub")) {
+    return runHub(app, QDir(parser.value("hub")), parser.value("hub-lifetime").toInt());
+  }
+
+  // options
+  const int clientCount = std::max(2, parser.value("clients").toInt());
+  const int senders     = std::clamp(parser.value("senders").toInt(), 1, clientCount);
+  const double rate     = std::max(0.1, parser.value("rate").toDouble());
+  const int duration    = std::max(1, parser.value("duration").toInt()) * 1000;
+  const auto mix        = parseMix(parser.value("mix"));
+  const auto rounds     = mixRounds(mix);
+
+  // nothing to sync
+  if (mix.empty()) {
+    std::fprintf(stderr, "invalid payload mix\n"); return 2;
+  }
+
+  // identities of the hub and the clients that trust each other
+  auto hubConfig = utility::functions::getQSslConfiguration();
+  std::vector<QSslConfiguration> clientConfigs;
+  QByteArray clientCerts;
+
+  for (int i = 0; i < clientCount; ++i) {
+    clientConfigs.push_back(utility::functions::getQSslConfiguration());
+    clientConfigs.back().setCaCertificates({hubConfig.localCertificate()});
+    clientCerts.append(clientConfigs.back().localCertificate().toPem());
+  }
+
+  // hand the identities to the hub
+  QTemporaryDir dir;
+  const auto isWritten = dir.isValid()
+    && writeFile(dir.path(), "hub.crt", hubConfig.localCertificate().toPem())
+    && writeFile(dir.path(), "hub.key", utility::functions::toPem(hubConfig.privateKey()))
+    && writeFile(dir.path(), "clients.crt", clientCerts);
+
+  if (!isWritten) {
+    std::fprintf(stderr, "unable to write the identities\n"); return 2;
+  }
+
+  // start the hub in a child process so its CPU is its own
+  QProcess hub;
+  hub.setProcessChannelMode(QProcess::ForwardedErrorChannel);
+  hub.start(QCoreApplication::applicationFilePath(), {"--hub", dir.path()});
+
+  // wait for the port
+  quint16 port = 0;
+  while (port == 0 && hub.waitForReadyRead(10000)) {
+    while (hub.canReadLine()) {
+      const auto line = hub.readLine().trimmed().split(' ');
+      if (line.size() == 2 && line[0] == "port") port = line[1].toUShort();
+    }
+  }
+
+  if (port == 0) {
+    std::fprintf(stderr, "hub did not start\n"); return 1;
+  }
+
+  // the hub on this host
+  const auto hubDevice = types::Device({QHostAddress(QHostAddress::LocalHost), port, "hub"});
+
+  // the clients
+  std::vector<std::unique_ptr<network::syncing::Client>> clients;
+
+  // measurements
+  QElapsedTimer clock;
+  std::vector<double> connects, latencies;
+  std::vector<std::vector<double>> clientLatencies(clientCount);
+  QHash<quint64, QPair<qint64, int>> pending;  // sent time and receivers left
+  quint64 next = 0, deliveredBytes = 0, deliveries = 0;
+  qint64 trafficStart = 0, trafficEnd = 0;
+  int authenticated = 0;
+  bool failed = false;
+
+  // timers of the run
+  QTimer traffic, drain;
+  drain.setSingleShot(true);
+
+  // hub usage from its last line
+  double hubCpu = -1, hubWall = -1;
+
+  // print the report and quit
+  const auto report = [&] {
+    const double seconds = (trafficEnd - trafficStart) / 1e9;
+    quint64 expected = next * quint64(clientCount - 1), lost = 0;
+
+    // deliveries still pending are lost
+    for (const auto &[sent, left] : std::as_const(pending)) lost += left;
+
+    // p99 of each client
+    std::vector<double> clientP99;
+    for (const auto &samples : clientLatencies) {
+      if (!samples.empty()) clientP99.push_back(percentile(samples, 0.99));
+    }
+
+    std::printf("clients          %d (%d senders)\n", clientCount, senders);
+    std::printf("connect          p50 %.1f ms, all %.1f ms\n", percentile(connects, 0.5), percentile(connects, 1.0));
+    std::printf("copies           %llu at %.1f/s\n", (unsigned long long) next, seconds > 0 ? next / seconds : 0);
+    std::printf("deliveries       %llu of %llu, %llu lost\n", (unsigned long long) deliveries, (unsigned long long) expected, (unsigned long long) lost);
+    std::printf("latency          p50 %.2f ms, p90 %.2f ms, p99 %.2f ms, max %.2f ms\n", percentile(latencies, 0.5), percentile(latencies, 0.9), percentile(latencies, 0.99), percentile(latencies, 1.0));
+    std::printf("client p99       best %.2f ms, median %.2f ms, worst %.2f ms\n", percentile(clientP99, 0.0), percentile(clientP99, 0.5), percentile(clientP99, 1.0));
+    std::printf("fan-out          %.1f deliveries/s, %.2f MB/s\n", seconds > 0 ? deliveries / seconds : 0, seconds > 0 ? deliveredBytes / 1e6 / seconds : 0);
+
+    if (hubCpu >= 0 && hubWall > 0) {
+      std::printf("hub cpu          %.0f ms, %.1f%% of a core\n", hubCpu, hubCpu / hubWall * 100);
+    } else {
+      std::printf("hub cpu          unknown\n");
+    }
+
+    app.exit(failed || lost ? 1 : 0);
+  };
+
+  // the hub reports its usage when all the clients are gone
+  QObject::connect(&hub, &QProcess::finished, [&] {
+    for (const auto &line : hub.readAllStandardOutput().split('\n')) {
+      const auto parts = line.trimmed().split(' ');
+      if (parts.size() == 3 && parts[0] == "cpu") {
+        hubCpu  = parts[1].toDouble();
+        hubWall = parts[2].toDouble();
+      }
+    }
+    report();
+  });
+
+  // disconnect all and wait for the hub to report
+  bool isFinishing = false;
+  const auto finish = [&] {
+    if (std::exchange(isFinishing, true)) return;
+    traffic.stop();
+    drain.stop();
+    for (auto &client : clients) client->disconnectFromServer();
+    QTimer::singleShot(10000, &hub, [&] { hub.kill(); });
+  };
+
+  // a client got the items
+  const auto delivered = [&](int index, const QVector<QPair<QString, QByteArray>> &items) {
+    // find the copy
+    const auto sequence = sequenceOf(items);
+    if (!sequence.has_value() || !pending.contains(*sequence)) return;
+
+    // latency and bytes of the delivery
+    auto &[sent, left] = pending[*sequence];
+    const auto latency = (clock.nsecsElapsed() - sent) / 1e6;
+    latencies.push_back(latency);
+    clientLatencies[index].push_back(latency);
+    for (const auto &item : items) deliveredBytes += item.second.size();
+    ++deliveries;
+
+    // wait for the rest of the clients
+    if (--left > 0) return;
+
+    // the copy is delivered to all
+    pending.remove(*sequence);
+    trafficEnd = clock.nsecsElapsed();
+
+    // all delivered after the traffic
+    if (!traffic.isActive() && pending.isEmpty() && drain.isActive()) {
+      finish();
+    }
+  };
+
+  // one copy from the next sender
+  QObject::connect(&traffic, &QTimer::timeout, [&] {
+    // stop after the duration
+    if (clock.nsecsElapsed() - trafficStart >= qint64(duration) * 1000000) {
+      traffic.stop();
+      if (pending.isEmpty()) return finish();
+      return drain.start(10000);
+    }
+
+    // copy from the sender
+    const auto items = sequenceItems(next, *rounds[next % rounds.size()]);
+    pending.insert(next, {clock.nsecsElapsed(), clientCount - 1});
+    clients[next % senders]->syncItems(items);
+    ++next;
+  });
+
+  // give up waiting for the deliveries
+  QObject::connect(&drain, &QTimer::timeout, finish);
+
+  // start the traffic once all are authenticated
+  const auto start = [&] {
+    trafficStart = trafficEnd = clock.nsecsElapsed();
+    traffic.setTimerType(Qt::PreciseTimer);
+    traffic.start(std::max(1, int(1000 / rate)));
+  };
+
+  // create and connect the clients
+  for (int i = 0; i < clientCount; ++i) {
+    auto client = clients.emplace_back(std::make_unique<network::syncing::Client>()).get();
+    client->setSslConfiguration(clientConfigs[i]);
+
+    // count the authenticated clients
+    QObject::connect(client, &network::syncing::Client::OnServerStatusChanged, [&](bool connected) {
+      if (!connected) return;
+      connects.push_back(clock.nsecsElapsed() / 1e6);
+      if (++authenticated == clientCount) start();
+    });
+
+    // deliveries to the client
+    QObject::connect(client, &network::syncing::Client::OnSyncRequest, [&, i](auto items) {
+      delivered(i, items);
+    });
+  }
+
+  // give up if not all are connected
+  QTimer::singleShot(parser.value("connect-timeout").toInt(), &app, [&] {
+    if (authenticated < clientCount) {
+      std::fprintf(stderr, "only %d of %d clients connected\n", authenticated, clientCount);
+      failed = true; finish();
+    }
+  });
+
+  // connect all at once, the connect time is from here
+  clock.start();
+  for (auto &client : clients) client->connectToServerSecured(hubDevice);
+
+  // run the load
+  return app.exec();
+}
@@ -0,0 +1,232 @@
+// Copyright (c) 2024 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Qt headers
+#include <QBuffer>
+#include <QByteArray>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QRandomGenerator>
+#include <QStringList>
+
+// C++ headers
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// local headers
+#include "packets/filestreampacket/filestreampacket.hpp"
+#include "store/searchindex/searchindex.hpp"
+#include "utility/functions/packet/packet.hpp"
+#include "utility/functions/qoi/qoi.hpp"
+
+using namespace srilakshmikanthanp::clipbirdesk;
+
+/**
+ * @brief Create a image that looks like a screenshot it has flat window
+ * areas, a gradient title bar and a noisy photo like region
+ */
+QImage createScreenshotLikeImage(int width, int height) {
+  QImage image(width, height, QImage::Format_RGBA8888);
+  QRandomGenerator rand(42);
+
+  for (int y = 0; y < height; y++) {
+    auto line = image.scanLine(y);
+    for (int x = 0; x < width; x++) {
+      auto px = line + x * 4;
+
+      if (y < height / 20) {                              // title bar
+        px[0] = x * 255 / width; px[1] = 80; px[2] = 160;
+      } else if (x > width / 2 && y > height / 2) {       // photo
+        px[0] = (x ^ y) & 0xff; px[1] = rand.bounded(256); px[2] = (x + y) & 0xff;
+      } else if ((x / 8 + y / 16) % 11 == 0) {            // text like pattern
+        px[0] = 20; px[1] = 20; px[2] = 20;
+      } else {                                            // window background
+        px[0] = 240; px[1] = 240; px[2] = 240;
+      }
+
+      px[3] = 255;
+    }
+  }
+
+  return image;
+}
+
+/**
+ * @brief Encode + transfer + decode of a 4K screenshot with the
+ * default PNG, fast PNG and QOI, the transfer time is estimated
+ * for a 100 Mbit/s LAN
+ */
+bool benchCodec() {
+  using namespace utility::functions;
+
+  // 100 Mbit/s in bytes per millisecond
+  constexpr double bytesPerMs = 100.0 * 1000 * 1000 / 8 / 1000;
+
+  // create the image
+  const auto image = createScreenshotLikeImage(3840, 2160);
+  bool lossless    = true;
+
+  // encode the image as png with quality
+  const auto encodePng = [](const QImage &img, int quality) {
+    QByteArray data; QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    img.save(&buffer, "PNG", quality);
+    return data;
+  };
+
+  // measure the codec
+  const auto measure = [&](const char *name, auto encode, auto decode) {
+    QElapsedTimer timer;
+
+    timer.start();
+    const QByteArray data = encode();
+    const auto encodeMs   = timer.nsecsElapsed() / 1e6;
+
+    timer.restart();
+    const QImage result   = decode(data);
+    const auto decodeMs   = timer.nsecsElapsed() / 1e6;
+
+    const auto transferMs = data.size() / bytesPerMs;
+
+    std::printf(
+      "%-12s %10lld %12.2f %12.2f %12.2f %12.2f\n", name, (long long) data.size() / 1024,
+      encodeMs, transferMs, decodeMs, encodeMs + transferMs + decodeMs
+    );
+
+    lossless = lossless && result.convertToFormat(QImage::Format_RGBA8888) == image;
+  };
+
+  // print the header
+  std::printf("%-12s %10s %12s %12s %12s %12s\n", "codec", "KiB", "encode(ms)", "transfer(ms)", "decode(ms)", "total(ms)");
+
+  // png with default zlib level
+  measure("PNG default", [&] { return encodePng(image, -1); }, [](auto d) {
+    return QImage::fromData(d, "PNG");
+  });
+
+  // png with zlib level 1
+  measure("PNG fast", [&] { return encodePng(image, 85); }, [](auto d) {
+    return QImage::fromData(d, "PNG");
+  });
+
+  // qoi
+  measure("QOI", [&] { return encodeQoi(image); }, [](auto d) {
+    return decodeQoi(d);
+  });
+
+  // the codecs are lossless
+  if (!lossless) std::fprintf(stderr, "codec round trip is not lossless\n");
+
+  return lossless;
+}
+
+/**
+ * @brief Chunk framing throughput for a multi GB file, this is
+ * the per chunk cost on top of the socket write
+ */
+bool benchFraming() {
+  using network::packets::FileStreamPacket;
+  using namespace utility::functions;
+
+  // constant values
+  const auto packetType = FileStreamPacket::PacketType::FileStream;
+  const auto fileName   = QString("disk.img");
+  const auto chunk      = QByteArray(1024 * 1024, 'x');
+  const auto fileSize   = quint64(2) * 1024 * 1024 * 1024;
+
+  // elapsed timer
+  QElapsedTimer timer;
+  timer.start();
+
+  // encode and decode every chunk of the file
+  for (quint64 offset = 0; offset < fileSize; offset += chunk.size()) {
+    const auto bytes = toQByteArray(createPacket(params::FileStreamPacketParams{
+      packetType, 1, 1, 0, fileSize, offset, fileName, chunk
+    }));
+
+    if (fromQByteArray<FileStreamPacket>(bytes).getOffset() != offset) {
+      std::fprintf(stderr, "chunk at %llu is not framed\n", (unsigned long long) offset);
+      return false;
+    }
+  }
+
+  // elapsed time
+  const auto elapsedMs = std::max(timer.nsecsElapsed() / 1e6, 1e-3);
+
+  std::printf("%-12s %12s %12s\n", "framing", "time(ms)", "MiB/s");
+  std::printf("%-12s %12.2f %12.2f\n", "2 GiB", elapsedMs, (fileSize / 1024.0 / 1024.0) * 1000 / elapsedMs);
+
+  return true;
+}
+
+/**
+ * @brief Query latency over thousands of history entries
+ */
+bool benchSearch() {
+  // random words
+  QRandomGenerator rand(42);
+  const auto word = [&] {
+    QString w;
+    for (int i = 0, n = 3 + rand.bounded(6); i < n; ++i) w.append(QChar('a' + rand.bounded(26)));
+    return w;
+  };
+
+  // create the index with entries of 200 words
+  storage::SearchIndex index(64 * 1024);
+
+  for (quint64 key = 0; key < 5000; ++key) {
+    QStringList words;
+    for (int i = 0; i < 200; ++i) words.append(word());
+    index.insert(key, words.join(' '));
+  }
+
+  // measure the query
+  QElapsedTimer timer;
+  timer.start();
+
+  for (int i = 0; i < 100; ++i) {
+    index.search(word());
+  }
+
+  const auto perQuery = timer.nsecsElapsed() / 100 / 1e3;
+
+  std::printf("%-12s %12s\n", "search", "query(us)");
+  std::printf("%-12s %12.2f\n", "5000 entries", perQuery);
+
+  return true;
+}
+
+/**
+ * @brief Benchmark the image codecs, the file stream framing and
+ * the history search that are too slow for the unit tests
+ *
+ * usage: microbench [codec] [framing] [search]
+ */
+auto main(int argc, char **argv) -> int {
+  QCoreApplication app(argc, argv);
+
+  // benchmarks by name
+  const std::vector<std::pair<QString, std::function<bool()>>> benches = {
+    {"codec", benchCodec},
+    {"framing", benchFraming},
+    {"search", benchSearch},
+  };
+
+  // selected or all
+  auto selected = app.arguments().mid(1);
+  bool passed   = true;
+
+  for (const auto &[name, bench] : benches) {
+    if (!selected.isEmpty() && !selected.contains(name)) continue;
+    passed = bench() && passed;
+    std::printf("\n");
+  }
+
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+// Copyright (c) 2024 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Qt headers
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QSslServer>
+#include <QSslSocket>
+#include <QTimer>
+
+// C++ headers
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+// local headers
+#include "constants/constants.hpp"
+#include "utility/functions/sslcert/sslcert.hpp"
+
+using namespace srilakshmikanthanp::clipbirdesk;
+
+/**
+ * @brief Median of the samples in milliseconds
+ */
+double median(std::vector<double> samples) {
+  std::sort(samples.begin(), samples.end());
+  return samples.empty() ? 0 : samples[samples.size() / 2];
+}
+
+/**
+ * @brief Time one mutually authenticated handshake over loopback
+ * like the server and client do, returns -1 on failure
+ */
+double handshake(const QSslConfiguration &config) {
+  // both sides trust the same identity
+  auto peer = config;
+  peer.setCaCertificates({config.localCertificate()});
+  peer.setPeerVerifyMode(QSslSocket::VerifyPeer);
+
+  // server side
+  QSslServer server;
+  server.setSslConfiguration(peer);
+
+  // listen on loopback
+  if (!server.listen(QHostAddress::LocalHost)) {
+    return -1;
+  }
+
+  // client side
+  QSslSocket client;
+  client.setSslConfiguration(peer);
+
+  // done when both sides are encrypted
+  QEventLoop loop;
+  bool serverDone = false, clientDone = false, failed = false;
+
+  // finish the loop if both are done
+  const auto finish = [&] {
+    if ((serverDone && clientDone) || failed) loop.quit();
+  };
+
+  QObject::connect(&server, &QSslServer::pendingConnectionAvailable, [&] {
+    serverDone = true; finish();
+  });
+
+  QObject::connect(&server, &QSslServer::errorOccurred, [&] {
+    failed = true; finish();
+  });
+
+  QObject::connect(&client, &QSslSocket::encrypted, [&] {
+    clientDone = true; finish();
+  });
+
+  QObject::connect(&client, &QSslSocket::errorOccurred, [&] {
+    failed = true; finish();
+  });
+
+  // give up after a while
+  QTimer::singleShot(10000, &loop, [&] { failed = true; loop.quit(); });
+
+  // start the handshake
+  QElapsedTimer timer;
+  timer.start();
+
+  // certificate is issued for the host name
+  const auto name = QString::fromStdString(constants::getMDnsServiceName());
+  client.connectToHostEncrypted(QHostAddress(QHostAddress::LocalHost).toString(), server.serverPort(), name);
+
+  // wait for the handshake
+  loop.exec();
+
+  // return the elapsed time
+  return failed ? -1 : timer.nsecsElapsed() / 1e6;
+}
+
+/**
+ * @brief Compare the key generation and handshake latency of the
+ * host identity key types
+ *
+ * usage: sslbench [iterations]
+ */
+auto main(int argc, char **argv) -> int {
+  QCoreApplication app(argc, argv);
+
+  // number of iterations per key type
+  const int iterations = argc > 1 ? std::max(1, QString(argv[1]).toInt()) : 20;
+
+  // key types to compare
+  const std::vector<std::pair<const char *, types::enums::KeyType>> keyTypes = {
+    {"RSA-2048", types::enums::KeyType::RSA},
+    {"ECDSA-P256", types::enums::KeyType::ECDSA},
+    {"Ed25519", types::enums::KeyType::ED25519},
+  };
+
+  // print the header
+  std::printf("%-12s %14s %16s\n", "key", "keygen (ms)", "handshake (ms)");
+
+  for (const auto &[label, type] : keyTypes) {
+    std::vector<double> keygen, handshakes;
+    QSslConfiguration config;
+
+    // time the identity generation
+    for (int i = 0; i < iterations; ++i) {
+      QElapsedTimer timer;
+      timer.start();
+      config = utility::functions::getQSslConfiguration(type);
+      keygen.push_back(timer.nsecsElapsed() / 1e6);
+    }
+
+    // time the handshakes with the last identity
+    for (int i = 0; i < iterations; ++i) {
+      if (auto elapsed = handshake(config); elapsed >= 0) {
+        handshakes.push_back(elapsed);
+      }
+    }
+
+    // no handshake succeeded
+    if (handshakes.empty()) {
+      std::printf("%-12s %14.2f %16s\n", label, median(keygen), "failed");
+      continue;
+    }
+
+    // print the medians
+    std::printf("%-12s %14.2f %16.2f\n", label, median(keygen), median(handshakes));
+  }
+
+  return 0;
+}
@@ -0,0 +1,218 @@
+// Copyright (c) 2024 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Qt headers
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QTimer>
+
+// C++ headers
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+// local headers
+#include "common/bench.hpp"
+#include "mdns/mdns.hpp"
+#include "syncing/client/client.hpp"
+#include "syncing/server/server.hpp"
+#include "utility/functions/sslcert/sslcert.hpp"
+
+using namespace srilakshmikanthanp::clipbirdesk;
+using namespace srilakshmikanthanp::clipbirdesk::tools;
+
+/**
+ * @brief Run a server and clients in one process over loopback TLS
+ * with the loopback discovery, sync the payload mix and report the
+ * connect time, copy-to-delivery latency and throughput
+ *
+ * usage: syncbench [--clients N] [--iterations N] [--window N]
+ *        [--mix mime=bytes[xweight],...] [--source server|client]
+ *        [--max-p99 ms] [--timeout ms]
+ */
+auto main(int argc, char **argv) -> int {
+  QCoreApplication app(argc, argv);
+
+  // command line options
+  QCommandLineParser parser;
+  parser.addHelpOption();
+  parser.addOptions({
+    {"clients", "Number of clients.", "n", "4"},
+    {"iterations", "Number of syncs.", "n", "500"},
+    {"window", "Syncs in flight.", "n", "1"},
+    {"mix", "Payload mix mime=bytes[xweight],...", "mix", "text/plain=256x8,text/html=16384x2,image/png=1048576"},
+    {"source", "Who copies, server or client.", "who", "server"},
+    {"max-p99", "Fail if the p99 latency is above ms, 0 to skip.", "ms", "0"},
+    {"timeout", "Fail if not done within ms.", "ms", "60000"},
+  });
+  parser.process(app);
+
+  // options
+  const int clientCount = std::max(1, parser.value("clients").toInt());
+  const int iterations  = std::max(1, parser.value("iterations").toInt());
+  const int window      = std::max(1, parser.value("window").toInt());
+  const bool fromClient = parser.value("source") == "client";
+  const double maxP99   = parser.value("max-p99").toDouble();
+  const auto mix        = parseMix(parser.value("mix"));
+
+  // nothing to sync
+  if (mix.empty()) {
+    std::fprintf(stderr, "invalid payload mix\n"); return 2;
+  }
+
+  // items picked by weight round robin
+  const auto rounds = mixRounds(mix);
+
+  // identities of the hosts that trust each other
+  auto serverConfig = utility::functions::getQSslConfiguration();
+  std::vector<QSslConfiguration> clientConfigs;
+  QList<QSslCertificate> clientCerts;
+
+  for (int i = 0; i < clientCount; ++i) {
+    clientConfigs.push_back(utility::functions::getQSslConfiguration());
+    clientCerts.append(clientConfigs.back().localCertificate());
+  }
+
+  serverConfig.setCaCertificates(clientCerts);
+
+  for (auto &config : clientConfigs) {
+    config.setCaCertificates({serverConfig.localCertificate()});
+  }
+
+  // the discovery in process, outlives the hosts
+  network::service::mdnsLoopback loopback;
+
+  // the hub
+  network::syncing::Server server;
+  server.setBackend(&loopback);
+  server.setSslConfiguration(serverConfig);
+
+  // the clients
+  std::vector<std::unique_ptr<network::syncing::Client>> clients;
+
+  // receivers of every sync, all the clients or the hub and the other clients
+  const int receivers = clientCount;
+
+  // measurements
+  QElapsedTimer clock;
+  std::vector<double> connects, latencies;
+  QHash<quint64, QPair<qint64, int>> pending;  // sent time and receivers left
+  qint64 firstSent = -1, lastDelivered = -1;
+  quint64 deliveredBytes = 0, next = 0, done = 0;
+  int authenticated = 0;
+
+  // send the syncs up to the window
+  const auto send = [&] {
+    while (pending.size() < window && next < quint64(iterations)) {
+      // items of the round
+      const auto items = sequenceItems(next, *rounds[next % rounds.size()]);
+
+      // track and send
+      pending.insert(next++, {clock.nsecsElapsed(), receivers});
+      if (firstSent < 0) firstSent = clock.nsecsElapsed();
+
+      if (fromClient) {
+        clients.front()->syncItems(items);
+      } else {
+        server.syncItems(items);
+      }
+    }
+  };
+
+  // print the report and quit
+  const auto report = [&](bool timedOut) {
+    const double seconds = (lastDelivered - firstSent) / 1e9;
+    const double mbps    = seconds > 0 ? deliveredBytes / 1e6 / seconds : 0;
+    const double p99     = percentile(latencies, 0.99);
+
+    std::printf("%-10s %10s %12s %12s %12s %12s %10s\n", "clients", "syncs", "connect(ms)", "p50(ms)", "p99(ms)", "max(ms)", "MB/s");
+    std::printf(
+      "%-10d %10llu %12.2f %12.3f %12.3f %12.3f %10.2f\n", clientCount, (unsigned long long) done,
+      percentile(connects, 1.0), percentile(latencies, 0.50), p99, percentile(latencies, 1.0), mbps
+    );
+
+    // regressions fail the run
+    if (timedOut) {
+      std::fprintf(stderr, "timed out with %llu of %d syncs delivered\n", (unsigned long long) done, iterations);
+      return app.exit(1);
+    }
+
+    if (maxP99 > 0 && p99 > maxP99) {
+      std::fprintf(stderr, "p99 %.3f ms is above %.3f ms\n", p99, maxP99);
+      return app.exit(1);
+    }
+
+    app.exit(0);
+  };
+
+  // a receiver got the items
+  const auto delivered = [&](const QVector<QPair<QString, QByteArray>> &items) {
+    // find the sync
+    const auto sequence = sequenceOf(items);
+    if (!sequence.has_value() || !pending.contains(*sequence)) return;
+
+    // latency and bytes of the delivery
+    auto &[sent, left] = pending[*sequence];
+    latencies.push_back((clock.nsecsElapsed() - sent) / 1e6);
+    for (const auto &item : items) deliveredBytes += item.second.size();
+    lastDelivered = clock.nsecsElapsed();
+
+    // wait for the rest of the receivers
+    if (--left > 0) return;
+
+    // the sync is done
+    pending.remove(*sequence);
+
+    // all done
+    if (++done == quint64(iterations)) {
+      return report(false);
+    }
+
+    // send the next
+    send();
+  };
+
+  // create the clients
+  for (int i = 0; i < clientCount; ++i) {
+    auto client = clients.emplace_back(std::make_unique<network::syncing::Client>()).get();
+    client->setBackend(&loopback);
+    client->setSslConfiguration(clientConfigs[i]);
+
+    // connect to the hub once found
+    QObject::connect(client, &network::syncing::Client::OnServerFound, [=](types::Device device) {
+      client->connectToServerSecured(device);
+    });
+
+    // start syncing when all are authenticated
+    QObject::connect(client, &network::syncing::Client::OnServerStatusChanged, [&](bool connected) {
+      if (!connected) return;
+      connects.push_back(clock.nsecsElapsed() / 1e6);
+      if (++authenticated == clientCount) send();
+    });
+
+    // the source does not receive its own copy
+    if (!fromClient || i != 0) {
+      QObject::connect(client, &network::syncing::Client::OnSyncRequest, delivered);
+    }
+  }
+
+  // the hub receives the copies of the source client
+  if (fromClient) {
+    QObject::connect(&server, &network::syncing::Server::OnSyncRequest, delivered);
+  }
+
+  // give up after a while
+  QTimer::singleShot(parser.value("timeout").toInt(), &app, [&] { report(true); });
+
+  // register the hub and browse, the connect time is from here
+  clock.start();
+  server.startServer();
+  for (auto &client : clients) client->startBrowsing();
+
+  // run the benchmark
+  return app.exec();
+}